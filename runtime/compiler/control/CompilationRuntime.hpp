@@ -689,6 +689,11 @@ public:
    TR_MethodToBeCompiled *addOutOfProcessMethodToBeCompiled(JITServer::ServerStream *stream);
 #endif /* defined(J9VM_OPT_JITSERVER) */
    void                   queueEntry(TR_MethodToBeCompiled *entry);
+   void                   dequeueEntry(TR_MethodToBeCompiled *entry);
+   TR_MethodToBeCompiled *findQueuedEntry(TR::IlGeneratorMethodDetails &details, TR_FrontEnd *fe);
+   // Queued entries whose J9Method hashes to the same bucket are chained through _nextInMethodBucket
+   TR_MethodToBeCompiled *getFirstQueuedEntryInMethodBucket(J9Method *method) const { return _methodQueueHT[methodQueueHash(method)]; }
+   static uint32_t        methodQueueHash(J9Method *method) { return ((uintptr_t)method >> 3) & (METHOD_QUEUE_HT_SIZE - 1); }
    void                   recycleCompilationEntry(TR_MethodToBeCompiled *cur);
 #if defined(J9VM_OPT_JITSERVER)
    void                   requeueOutOfProcessEntry(TR_MethodToBeCompiled *entry);
@@ -698,6 +703,7 @@ public:
                                                            TR_Hotness newOptLevel, bool useProfiling,
                                                            CompilationPriority priority, TR_J9VMBase *fe);
    void changeCompReqFromAsyncToSync(J9Method * method);
+   // Returns 1 if the request was promoted, 0 if the method is being compiled and -1 otherwise
    int32_t                promoteMethodInAsyncQueue(J9Method * method, void *pc);
    TR_MethodToBeCompiled *getNextMethodToBeCompiled(TR::CompilationInfoPerThread *compInfoPT, bool compThreadCameOutOfSleep, TR_CompThreadActions*);
    TR_MethodToBeCompiled *peekNextMethodToBeCompiled();
@@ -1131,6 +1137,32 @@ private:
    //char *buildMethodString(TR_ResolvedMethod *method);
 
    static const size_t DLT_HASHSIZE = 123;
+   static const uint32_t METHOD_QUEUE_HT_SIZE = 1024; // power of two for cheap modulo
+   static const int32_t MAX_QUEUE_PRIORITY_LEVELS = 32;
+   static const int32_t QUEUE_LATENCY_HISTOGRAM_SIZE = 16; // log2 buckets of milliseconds
+   // Priority bands of the queue latency histograms, each starting at the CompilationPriority it is named after
+   enum QueueLatencyPriority
+      {
+      LATENCY_SYNC = 0,
+      LATENCY_ASYNC_MAX,
+      LATENCY_ASYNC_BELOW_MAX,
+      LATENCY_ASYNC_ABOVE_NORMAL,
+      LATENCY_ASYNC_NORMAL,
+      LATENCY_ASYNC_BELOW_NORMAL,
+      LATENCY_ASYNC_MIN,
+      LATENCY_NUM_PRIORITIES
+      };
+
+   // Last queued entry for each distinct priority present in _methodQueue
+   struct QueuePriorityLevel
+      {
+      uint16_t _priority;
+      TR_MethodToBeCompiled *_last;
+      };
+
+   int32_t findQueuePriorityLevel(uint16_t priority, bool &found) const;
+   void recordQueueLatency(TR_MethodToBeCompiled *entry);
+   void printQueueLatencyHistograms();
 
    static TR::CompilationInfo * _compilationRuntime;
 
@@ -1141,7 +1173,10 @@ private:
    TR::CompilationInfoPerThread **_arrayOfCompilationInfoPerThread; // First NULL entry means end of the array
    TR::CompilationInfoPerThread *_compInfoForDiagnosticCompilationThread; // compinfo for dump compilation thread
    TR::CompilationInfoPerThreadBase *_compInfoForCompOnAppThread; // This is NULL for separate compilation thread
-   TR_MethodToBeCompiled *_methodQueue;
+   TR_MethodToBeCompiled *_methodQueue; // ordered by decreasing priority, FIFO within the same priority
+   TR_MethodToBeCompiled *_methodQueueHT[METHOD_QUEUE_HT_SIZE]; // index of _methodQueue by J9Method
+   QueuePriorityLevel     _queuePriorityLevels[MAX_QUEUE_PRIORITY_LEVELS]; // sorted by decreasing priority
+   int32_t                _numQueuePriorityLevels;
    TR_MethodToBeCompiled *_methodPool;
    int32_t                _methodPoolSize; // shouldn't this and _methodPool be static?
 
@@ -1210,6 +1245,7 @@ private:
    uint32_t               _statNumDowngradeInterpretedMethod;
    uint32_t               _statNumUpgradeJittedMethod;
    uint32_t               _statNumQueuePromotions;
+   uint32_t               _statQueueLatency[LATENCY_NUM_PRIORITIES][QUEUE_LATENCY_HISTOGRAM_SIZE]; // enqueue to start of processing
    uint32_t               _statNumGCRInducedCompilations;
    uint32_t               _statNumSamplingJProfilingBodies;
    uint32_t               _statNumJProfilingBodies;
@@ -1541,9 +1541,9 @@ TR::CompilationInfo::getMethodBytecodeSize(J9Method* method)
       {
          {
          ClientSessionData *clientSessionData = TR::compInfoPT->getClientData();
-         OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
-         auto it = clientSessionData->getJ9MethodMap().find(method);
-         if (it != clientSessionData->getJ9MethodMap().end())
+         ClientSessionData::J9MethodMapCriticalSection methodMap(clientSessionData, method);
+         auto it = methodMap.map().find(method);
+         if (it != methodMap.map().end())
             {
             return getMethodBytecodeSize(it->second._romMethod);
             }
@@ -1569,9 +1569,9 @@ TR::CompilationInfo::isJSR292(J9Method *j9method)
       {
          {
          ClientSessionData *clientSessionData = TR::compInfoPT->getClientData();
-         OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
-         auto it = clientSessionData->getJ9MethodMap().find(j9method);
-         if (it != clientSessionData->getJ9MethodMap().end())
+         ClientSessionData::J9MethodMapCriticalSection methodMap(clientSessionData, j9method);
+         auto it = methodMap.map().find(j9method);
+         if (it != methodMap.map().end())
             {
             return isJSR292(it->second._romMethod);
             }
@@ -1962,7 +1962,6 @@ void TR::CompilationInfo::invalidateRequestsForNativeMethods(J9Class * clazz, J9
 
    // if compiling on app thread, there is no compilation queue
    TR_MethodToBeCompiled *cur = _methodQueue;
-   TR_MethodToBeCompiled *prev = NULL;
    while (cur)
       {
       TR_MethodToBeCompiled *next = cur->_next;
@@ -1987,20 +1986,13 @@ void TR::CompilationInfo::invalidateRequestsForNativeMethods(J9Class * clazz, J9
             }
 
          // detach from queue
-         if (prev)
-            prev->_next = cur->_next;
-         else
-            _methodQueue = cur->_next;
+         dequeueEntry(cur);
          updateCompQueueAccountingOnDequeue(cur);
          // decrease the queue weight
          decreaseQueueWeightBy(cur->_weight);
          // put back into the pool
          recycleCompilationEntry(cur);
          }
-      else
-         {
-         prev = cur;
-         }
       cur = next;
       }
    // LPQ does not need to be checked because JNI thunk requests cannot be put in LPQ
@@ -2057,7 +2049,6 @@ void TR::CompilationInfo::invalidateRequestsForUnloadedMethods(TR_OpaqueClassBlo
       } // end for
    // if compiling on app thread, there is no compilation queue
    TR_MethodToBeCompiled *cur  = _methodQueue;
-   TR_MethodToBeCompiled *prev = NULL;
    bool verboseDetails = TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerboseHookDetails);
    while (cur)
       {
@@ -2098,24 +2089,13 @@ void TR::CompilationInfo::invalidateRequestsForUnloadedMethods(TR_OpaqueClassBlo
                   }
                }
             // detach from queue
-            if (prev)
-               prev->_next = cur->_next;
-            else
-               _methodQueue = cur->_next;
+            dequeueEntry(cur);
             updateCompQueueAccountingOnDequeue(cur);
             // decrease the queue weight
             decreaseQueueWeightBy(cur->_weight);
             // put back into the pool
             recycleCompilationEntry(cur);
             }
-         else
-            {
-            prev = cur;
-            }
-         }
-      else
-         {
-         prev = cur;
          }
       cur = next;
       }
@@ -2418,7 +2398,7 @@ void TR::CompilationInfo::purgeMethodQueue(TR_CompilationErrorCode errorCode)
    while (_methodQueue)
       {
       TR_MethodToBeCompiled * cur = _methodQueue;
-      _methodQueue = cur->_next;
+      dequeueEntry(cur);
       updateCompQueueAccountingOnDequeue(cur);
       // decrease the queue weight
       decreaseQueueWeightBy(cur->_weight);
@@ -3153,6 +3133,9 @@ void TR::CompilationInfo::stopCompilationThreads()
       return;
       }
 
+   if (TR::Options::getCmdLineOptions()->getVerboseOption(TR_VerbosePerformance))
+      printQueueLatencyHistograms();
+
    static char * printCompStats = feGetEnv("TR_PrintCompStats");
    if (printCompStats)
       {
@@ -4667,9 +4650,11 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
 #endif
 
    // Add this method to the queue of methods waiting to be compiled.
-   TR_MethodToBeCompiled *cur = NULL, *prev = NULL;
+   TR_MethodToBeCompiled *cur = NULL;
+#if defined(DEBUG)
    uint32_t queueWeight = 0; // QW
    int32_t numEntries = 0;
+#endif /* defined(DEBUG) */
 
    // See if the method is already in the queue or is already being compiled
    //
@@ -4685,7 +4670,9 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
       TR_MethodToBeCompiled *compMethod = curCompThreadInfoPT->getMethodBeingCompiled();
       if (compMethod)
          {
+#if defined(DEBUG)
          queueWeight += compMethod->_weight; // QW
+#endif /* defined(DEBUG) */
          if (compMethod->getMethodDetails().sameAs(details, fe))
             {
             if (!compMethod->_unloadedMethod) // Redefinition; see cmvc 192606 and RTC 36898
@@ -4700,13 +4687,7 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
          }
       }
 
-   for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-      {
-      numEntries++;
-      queueWeight += cur->_weight;
-      if (cur->getMethodDetails().sameAs(details, fe))
-         break;
-      }
+   cur = findQueuedEntry(details, fe);
 
    // NOTE: we do not need to search the methodPool since we cannot reach here if an entry
    // for the compilation of this method is already in the pool.  Things are put in the pool
@@ -4726,9 +4707,15 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
          cur->_oldStartPC = pc;
 
       // If the priority has increased, use the new priority
+      // and re-position the entry in the queue (done below)
       //
+      bool mustReposition = false;
       if (cur->_priority < priority)
+         {
+         dequeueEntry(cur);
          cur->_priority = priority;
+         mustReposition = true;
+         }
       // If the optimization level is higher, just upgrade
       // (unless the methods has excessive complexity)
       //
@@ -4745,18 +4732,21 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
          }
       // If the position in the queue is still correct, just return
       //
-      if (!prev || prev->_priority >= cur->_priority)
+      if (!mustReposition)
          return cur;
-
-      // Must re-position in the queue
-      //
-      prev->_next = cur->_next; // take it out of the queue
       }
 
    // If method is not yet in the queue prepare the queue entry
    //
    else
       {
+#if defined(DEBUG)
+      // Verify the queue accounting; this requires a walk over the entire queue
+      for (TR_MethodToBeCompiled *queued = _methodQueue; queued; queued = queued->_next)
+         {
+         numEntries++;
+         queueWeight += queued->_weight;
+         }
       if (queueWeight != _queueWeight) //QW
          {
          if (TR::Options::isAnyVerboseOptionSet())
@@ -4770,6 +4760,7 @@ TR::CompilationInfo::addMethodToBeCompiled(TR::IlGeneratorMethodDetails & detail
             TR_VerboseLog::writeLineLocked(TR_Vlog_INFO, "Discrepancy for queue size while adding to queue: Before adding numEntries=%d  _numQueuedMethods=%d\n", numEntries, _numQueuedMethods);
          TR_ASSERT(false, "Discrepancy for queue size while adding to queue");
          }
+#endif /* defined(DEBUG) */
 
       cur = getCompilationQueueEntry();
       if (cur == NULL)  // Memory Allocation Failure.
@@ -4958,23 +4949,130 @@ void TR::CompilationInfo::queueEntry(TR_MethodToBeCompiled *entry)
 
    entry->_freeTag |= ENTRY_QUEUED;
 
-   if (!_methodQueue || _methodQueue->_priority < entry->_priority)
-      {
-      entry->_next = _methodQueue;
+   // The entry goes after the last entry with the same or higher priority.
+   // Start from the last entry of the closest priority level we know about
+   // so that we do not have to walk the queue from the beginning
+   bool found;
+   int32_t level = findQueuePriorityLevel(entry->_priority, found);
+   TR_MethodToBeCompiled *prev = NULL;
+   if (found)
+      prev = _queuePriorityLevels[level]._last;
+   else if (level > 0)
+      prev = _queuePriorityLevels[level - 1]._last;
+   TR_MethodToBeCompiled *next = prev ? prev->_next : _methodQueue;
+   // Only needed for priorities that did not fit in _queuePriorityLevels
+   while (next && next->_priority >= entry->_priority)
+      {
+      prev = next;
+      next = next->_next;
+      }
+
+   entry->_prev = prev;
+   entry->_next = next;
+   if (prev)
+      prev->_next = entry;
+   else
       _methodQueue = entry;
+   if (next)
+      next->_prev = entry;
+
+   if (found)
+      {
+      _queuePriorityLevels[level]._last = entry;
       }
-   else
+   else if (_numQueuePriorityLevels < MAX_QUEUE_PRIORITY_LEVELS)
       {
-      for (TR_MethodToBeCompiled *prev = _methodQueue; ; prev = prev->_next)
+      memmove(&_queuePriorityLevels[level + 1], &_queuePriorityLevels[level], (_numQueuePriorityLevels - level) * sizeof(QueuePriorityLevel));
+      _queuePriorityLevels[level]._priority = entry->_priority;
+      _queuePriorityLevels[level]._last = entry;
+      _numQueuePriorityLevels++;
+      }
+
+   // Index the entry by J9Method. Requests received by a JITServer are queued before
+   // their details are read, with no J9Method, and are never looked up by method.
+   // Chaining them would put all of them in one bucket, and dequeuing the oldest
+   // would walk past every request queued after it
+   J9Method *method = entry->getMethodDetails().getMethod();
+   entry->_queuedMethod = method;
+   if (method)
+      {
+      uint32_t bucket = methodQueueHash(method);
+      entry->_nextInMethodBucket = _methodQueueHT[bucket];
+      _methodQueueHT[bucket] = entry;
+      }
+   }
+
+//--------------------------- dequeueEntry -------------------------------
+// Take the compilation request out of the queue. The priority of the entry
+// must not have been changed since it was queued. Queue accounting is the
+// responsibility of the caller. Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+void TR::CompilationInfo::dequeueEntry(TR_MethodToBeCompiled *entry)
+   {
+   TR_ASSERT_FATAL(entry->_freeTag & ENTRY_QUEUED, "dequeuing an entry which is not queued\n");
+
+   bool found;
+   int32_t level = findQueuePriorityLevel(entry->_priority, found);
+   if (found && _queuePriorityLevels[level]._last == entry)
+      {
+      if (entry->_prev && entry->_prev->_priority == entry->_priority)
          {
-         if (!prev->_next || prev->_next->_priority < entry->_priority)
-            {
-            entry->_next = prev->_next;
-            prev->_next = entry;
-            break;
-            }
+         _queuePriorityLevels[level]._last = entry->_prev;
+         }
+      else // last entry with this priority
+         {
+         _numQueuePriorityLevels--;
+         memmove(&_queuePriorityLevels[level], &_queuePriorityLevels[level + 1], (_numQueuePriorityLevels - level) * sizeof(QueuePriorityLevel));
          }
       }
+
+   if (entry->_prev)
+      entry->_prev->_next = entry->_next;
+   else
+      _methodQueue = entry->_next;
+   if (entry->_next)
+      entry->_next->_prev = entry->_prev;
+   entry->_next = NULL;
+   entry->_prev = NULL;
+
+   if (entry->_queuedMethod)
+      {
+      TR_MethodToBeCompiled **link = &_methodQueueHT[methodQueueHash(entry->_queuedMethod)];
+      while (*link != entry)
+         link = &(*link)->_nextInMethodBucket;
+      *link = entry->_nextInMethodBucket;
+      entry->_nextInMethodBucket = NULL;
+      entry->_queuedMethod = NULL;
+      }
+   }
+
+//------------------------ findQueuePriorityLevel ------------------------
+// Binary search in _queuePriorityLevels (sorted by decreasing priority).
+// Returns the index of the level for the given priority if found, or the
+// index where such a level would have to be inserted
+//------------------------------------------------------------------------
+int32_t TR::CompilationInfo::findQueuePriorityLevel(uint16_t priority, bool &found) const
+   {
+   int32_t low = 0, high = _numQueuePriorityLevels;
+   while (low < high)
+      {
+      int32_t mid = (low + high) >> 1;
+      if (_queuePriorityLevels[mid]._priority > priority)
+         low = mid + 1;
+      else
+         high = mid;
+      }
+   found = low < _numQueuePriorityLevels && _queuePriorityLevels[low]._priority == priority;
+   return low;
+   }
+
+// Must have compilationQueueMonitor in hand
+TR_MethodToBeCompiled *TR::CompilationInfo::findQueuedEntry(TR::IlGeneratorMethodDetails &details, TR_FrontEnd *fe)
+   {
+   for (TR_MethodToBeCompiled *cur = getFirstQueuedEntryInMethodBucket(details.getMethod()); cur; cur = cur->_nextInMethodBucket)
+      if (cur->getMethodDetails().sameAs(details, fe))
+         return cur;
+   return NULL;
    }
 
 //--------------------------------- requeue ----------------------------------
@@ -5018,12 +5116,7 @@ TR::CompilationInfo::adjustCompilationEntryAndRequeue(
       }
 
    // Search the queue for my method
-   TR_MethodToBeCompiled *cur, *prev;
-   for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next)
-      {
-      if (cur->getMethodDetails().sameAs(details, fe))
-         break;
-      }
+   TR_MethodToBeCompiled *cur = findQueuedEntry(details, fe);
    if (cur)
       {
       // here define the list of exclusions
@@ -5043,10 +5136,7 @@ TR::CompilationInfo::adjustCompilationEntryAndRequeue(
          if (cur->_priority < priority)
             {
             // take the method out
-            if (prev)
-               prev->_next = cur->_next;
-            else
-               _methodQueue = cur->_next;
+            dequeueEntry(cur);
             // put it back at its proper place
             cur->_priority = priority;
             queueEntry(cur);
@@ -5075,50 +5165,34 @@ int32_t TR::CompilationInfo::promoteMethodInAsyncQueue(J9Method * method, void *
          }
       }
 
-   int i = 0;
-   TR_MethodToBeCompiled *cur, *prev;
-   for (prev = NULL, cur = _methodQueue; cur; prev = cur, cur = cur->_next)
+   TR_MethodToBeCompiled *cur;
+   for (cur = getFirstQueuedEntryInMethodBucket(method); cur; cur = cur->_nextInMethodBucket)
       {
       if (!cur->isDLTCompile() && method == cur->getMethodDetails().getMethod())
          break;
-      i++;
       }
 
-   if (!cur || !prev || cur->_priority >= CP_ASYNC_MAX || prev->_priority >= CP_ASYNC_MAX)
-      return -i;
+   // Nothing to do if the request is already at the top of the queue
+   // or among requests of equal or higher priority
+   if (!cur || !cur->_prev || cur->_priority >= CP_ASYNC_MAX || cur->_prev->_priority >= CP_ASYNC_MAX)
+      return -1;
    changeCompThreadPriority(J9THREAD_PRIORITY_MAX, 9);
    _statNumQueuePromotions++;
 #ifdef STATS
    fprintf(stderr, "Promoting method in queue QSZ=%d\n", getMethodQueueSize());
 #endif
+   // take the method out and insert it after the other promoted requests
+   dequeueEntry(cur);
    cur->_priority = CP_ASYNC_MAX;
-
-   // take the method out
-   prev->_next = cur->_next;
-   // find insertion point
-   if (_methodQueue->_priority < CP_ASYNC_MAX) // common case
-      {
-      cur->_next = _methodQueue;
-      _methodQueue = cur;
-      // FIXME: how about the compilation lag
-      }
-   else
-      {
-      for (prev = _methodQueue; prev->_next; prev = prev->_next)
-         if (prev->_next->_priority < CP_ASYNC_MAX)
-            {
-            cur->_next = prev->_next;
-            prev->_next = cur;
-            break;
-            }
-      }
-   return i;
+   queueEntry(cur);
+   // FIXME: how about the compilation lag
+   return 1;
    }
 
 void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method * method)
    {
 
-   TR_MethodToBeCompiled *cur = NULL, *prev = NULL;
+   TR_MethodToBeCompiled *cur = NULL;
    // See if the method is already in the queue or is already being compiled
    //
    for (uint8_t i = 0; i < getNumUsableCompilationThreads(); i++)
@@ -5140,7 +5214,7 @@ void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method * method)
       }
    if (!cur)
       {
-      for (cur = _methodQueue; cur; prev = cur, cur = cur->_next)
+      for (cur = getFirstQueuedEntryInMethodBucket(method); cur; cur = cur->_nextInMethodBucket)
          if (!cur->isDLTCompile() && method == cur->getMethodDetails().getMethod())
             break;
       // Check if this is an asynchronous request
@@ -5149,16 +5223,9 @@ void TR::CompilationInfo::changeCompReqFromAsyncToSync(J9Method * method)
          {
          // Take the method out, increase its priority and insert it at the proper place
          //
+         dequeueEntry(cur);
          cur->_priority = CP_SYNC_NORMAL;
-         if (prev)
-            {
-            prev->_next = cur->_next;
-            queueEntry(cur);
-            }
-         else // method already at the top of the queue
-            {
-            // Nothing to do
-            }
+         queueEntry(cur);
          }
       else
          {
@@ -5196,10 +5263,7 @@ TR_MethodToBeCompiled * TR::CompilationInfo::requestExistsInCompilationQueue(TR:
          return curCompThreadInfoPT->getMethodBeingCompiled();
       }
 
-   for (TR_MethodToBeCompiled *cur = _methodQueue; cur; cur = cur->_next)
-      if (cur->getMethodDetails().sameAs(details, fe))
-         return cur;
-   return NULL;
+   return findQueuedEntry(details, fe);
    }
 
 TR_MethodToBeCompiled *TR::CompilationInfo::peekNextMethodToBeCompiled()
@@ -5250,7 +5314,7 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
       if (_methodQueue)
          {
          nextMethodToBeCompiled = _methodQueue;
-         _methodQueue = _methodQueue->_next;
+         dequeueEntry(nextMethodToBeCompiled);
 
          // See explanation at the start of this function of why it is important to ensure this
          TR_ASSERT_FATAL(nextMethodToBeCompiled->getMethodDetails().isJitDumpMethod(), "Diagnostic thread attempting to process non-JitDump compilation");
@@ -5275,7 +5339,7 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
             )
             {
             nextMethodToBeCompiled = _methodQueue;
-            _methodQueue = _methodQueue->_next;
+            dequeueEntry(nextMethodToBeCompiled);
             }
          // Check if we need to throttle
          else if (exceedsCompCpuEntitlement() == TR_yes &&
@@ -5294,18 +5358,17 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
                   _methodQueue->_weight < TR::Options::_expensiveCompWeight) // This is a cheaper comp
             {
             nextMethodToBeCompiled = _methodQueue;
-            _methodQueue = _methodQueue->_next;
+            dequeueEntry(nextMethodToBeCompiled);
             }
          else // scan for a cold/warm method
             {
-            TR_MethodToBeCompiled *prev = _methodQueue;
-            for (nextMethodToBeCompiled = _methodQueue->_next; nextMethodToBeCompiled; prev = nextMethodToBeCompiled, nextMethodToBeCompiled = nextMethodToBeCompiled->_next)
+            for (nextMethodToBeCompiled = _methodQueue->_next; nextMethodToBeCompiled; nextMethodToBeCompiled = nextMethodToBeCompiled->_next)
                {
                if (nextMethodToBeCompiled->_optimizationPlan->getOptLevel() <= warm || // cheaper comp
                   nextMethodToBeCompiled->_priority >= CP_SYNC_MIN ||       // sync comp
                   nextMethodToBeCompiled->_methodIsInSharedCache == TR_yes) // very cheap relocation
                   {
-                  prev->_next = nextMethodToBeCompiled->_next;
+                  dequeueEntry(nextMethodToBeCompiled);
                   break;
                   }
                }
@@ -5433,9 +5496,73 @@ TR::CompilationInfo::getNextMethodToBeCompiled(TR::CompilationInfoPerThread *com
          }
       }
 
+   if (nextMethodToBeCompiled)
+      recordQueueLatency(nextMethodToBeCompiled);
+
    return nextMethodToBeCompiled;
    }
 
+//------------------------- recordQueueLatency ---------------------------
+// Update the histogram of the time spent by requests in the compilation
+// queues, for the priority band of the request when it is dequeued.
+// Bucket 0 counts requests that waited less than 1 ms; bucket i counts
+// requests that waited in [2^(i-1), 2^i) ms. The last bucket also counts
+// everything above. Must have compilationQueueMonitor in hand
+//------------------------------------------------------------------------
+void TR::CompilationInfo::recordQueueLatency(TR_MethodToBeCompiled *entry)
+   {
+   QueueLatencyPriority band;
+   if (entry->_priority >= CP_SYNC_MIN)
+      band = LATENCY_SYNC;
+   else if (entry->_priority >= CP_ASYNC_MAX)
+      band = LATENCY_ASYNC_MAX;
+   else if (entry->_priority >= CP_ASYNC_BELOW_MAX)
+      band = LATENCY_ASYNC_BELOW_MAX;
+   else if (entry->_priority >= CP_ASYNC_ABOVE_NORMAL)
+      band = LATENCY_ASYNC_ABOVE_NORMAL;
+   else if (entry->_priority >= CP_ASYNC_NORMAL)
+      band = LATENCY_ASYNC_NORMAL;
+   else if (entry->_priority >= CP_ASYNC_BELOW_NORMAL)
+      band = LATENCY_ASYNC_BELOW_NORMAL;
+   else
+      band = LATENCY_ASYNC_MIN;
+
+   uint64_t crtTime = getPersistentInfo()->getElapsedTime();
+   uint64_t latency = crtTime > entry->_entryTime ? crtTime - entry->_entryTime : 0;
+   int32_t bucket = 0;
+   for (; latency > 0 && bucket < QUEUE_LATENCY_HISTOGRAM_SIZE - 1; latency >>= 1)
+      bucket++;
+   _statQueueLatency[band][bucket]++;
+   }
+
+void TR::CompilationInfo::printQueueLatencyHistograms()
+   {
+   static const char *bandNames[LATENCY_NUM_PRIORITIES] = { "sync", "asyncMax", "asyncBelowMax", "asyncAboveNormal", "asyncNormal", "asyncBelowNormal", "asyncMin" };
+   TR_VerboseLog::vlogAcquire();
+   TR_VerboseLog::writeLine(TR_Vlog_PERF, "Compilation queue latency histograms by priority (ms from enqueue to start of processing):");
+   for (int32_t band = 0; band < LATENCY_NUM_PRIORITIES; band++)
+      {
+      uint32_t numRequests = 0;
+      for (int32_t bucket = 0; bucket < QUEUE_LATENCY_HISTOGRAM_SIZE; bucket++)
+         numRequests += _statQueueLatency[band][bucket];
+      if (numRequests == 0)
+         continue;
+      TR_VerboseLog::writeLine(TR_Vlog_PERF, "  %-16s numRequests=%u:", bandNames[band], numRequests);
+      for (int32_t bucket = 0; bucket < QUEUE_LATENCY_HISTOGRAM_SIZE; bucket++)
+         {
+         if (_statQueueLatency[band][bucket] == 0)
+            continue;
+         if (bucket == 0)
+            TR_VerboseLog::write(" <1=%u", _statQueueLatency[band][bucket]);
+         else if (bucket == QUEUE_LATENCY_HISTOGRAM_SIZE - 1)
+            TR_VerboseLog::write(" >=%u=%u", 1u << (bucket - 1), _statQueueLatency[band][bucket]);
+         else
+            TR_VerboseLog::write(" <%u=%u", 1u << bucket, _statQueueLatency[band][bucket]);
+         }
+      }
+   TR_VerboseLog::vlogRelease();
+   }
+
 //----------------------------- computeCompThreadSleepTime ----------------------
 // Compute how much the compilation thread should sleep for throttling purposes
 // Parameters: compilationTimeMs is the wall clock time spent by previous
@@ -6220,20 +6347,17 @@ void *TR::CompilationInfo::compileOnSeparateThread(J9VMThread * vmThread, TR::Il
          changeCompReqFromAsyncToSync(method);
       else
          {
-         TR_MethodToBeCompiled *reqMe, *prevReq;
-         for (prevReq=NULL, reqMe=_methodQueue; reqMe; prevReq = reqMe, reqMe = reqMe->_next)
+         TR_MethodToBeCompiled *reqMe;
+         for (reqMe = getFirstQueuedEntryInMethodBucket(method); reqMe; reqMe = reqMe->_nextInMethodBucket)
             {
             if (!reqMe->isDLTCompile() && reqMe->getMethodDetails().getMethod() == method)
                break;
             }
          if (reqMe && reqMe->_priority<CP_ASYNC_ABOVE_NORMAL)
             {
+            dequeueEntry(reqMe);
             reqMe->_priority = CP_ASYNC_ABOVE_NORMAL;
-            if (prevReq && prevReq->_priority<CP_ASYNC_ABOVE_NORMAL)
-               {
-               prevReq->_next = reqMe->_next;
-               queueEntry(reqMe);
-               }
+            queueEntry(reqMe);
             }
          }
       }
@@ -149,6 +149,7 @@ int32_t J9::Options::_iprofilerReactivateThreshold=10;
 int32_t J9::Options::_iprofilerIntToTotalSampleRatio=2;
 int32_t J9::Options::_iprofilerSamplesBeforeTurningOff = 1000000; // samples
 int32_t J9::Options::_iprofilerNumOutstandingBuffers = 10;
+int32_t J9::Options::_iprofilerNumWorkerThreads = 0;
 int32_t J9::Options::_iprofilerBufferMaxPercentageToDiscard = 0;
 int32_t J9::Options::_iProfilerBufferInterarrivalTimeToExitDeepIdle = 5000; // 5 seconds
 int32_t J9::Options::_iprofilerBufferSize = 1024;
@@ -860,6 +861,9 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"iprofilerNumOutstandingBuffers=", "O<nnn>\tnumber of outstanding interpreter profiling buffers "
                                        "allowed in the system. Specify 0 to disable this optimization",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iprofilerNumOutstandingBuffers, 0, "F%d", NOT_IN_SUBSET},
+   {"iprofilerNumWorkerThreads=", "O<nnn>\tnumber of additional threads that process interpreter profiling buffers "
+                                  "in parallel with the IProfiler thread",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_iprofilerNumWorkerThreads, 0, "F%d", NOT_IN_SUBSET},
    {"iprofilerOffDivisionFactor=", "O<nnn>\tCounts Division factor when IProfiler is Off",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_IprofilerOffDivisionFactor, 0, "F%d", NOT_IN_SUBSET},
    {"iprofilerOffSubtractionFactor=", "O<nnn>\tCounts Subtraction factor when IProfiler is Off",
@@ -1113,6 +1117,12 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    const char *xxJITServerSSLRootCertsOption = "-XX:JITServerSSLRootCerts=";
    const char *xxJITServerUseAOTCacheOption = "-XX:+JITServerUseAOTCache";
    const char *xxDisableJITServerUseAOTCacheOption = "-XX:-JITServerUseAOTCache";
+   const char *xxJITServerAOTCachePersistenceOption = "-XX:+JITServerAOTCachePersistence";
+   const char *xxDisableJITServerAOTCachePersistenceOption = "-XX:-JITServerAOTCachePersistence";
+   const char *xxJITServerAOTCacheDirOption = "-XX:JITServerAOTCacheDir=";
+   const char *xxJITServerAOTCacheSyncPeriodOption = "-XX:JITServerAOTCacheSyncPeriod=";
+   const char *xxJITServerUseCompressionOption = "-XX:+JITServerUseCompression";
+   const char *xxDisableJITServerUseCompressionOption = "-XX:-JITServerUseCompression";
 
    int32_t xxJITServerPortArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerPortOption, 0);
    int32_t xxJITServerTimeoutArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerTimeoutOption, 0);
@@ -1121,6 +1131,12 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    int32_t xxJITServerSSLRootCertsArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerSSLRootCertsOption, 0);
    int32_t xxJITServerUseAOTCacheArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerUseAOTCacheOption, 0);
    int32_t xxDisableJITServerUseAOTCacheArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerUseAOTCacheOption, 0);
+   int32_t xxJITServerAOTCachePersistenceArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerAOTCachePersistenceOption, 0);
+   int32_t xxDisableJITServerAOTCachePersistenceArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerAOTCachePersistenceOption, 0);
+   int32_t xxJITServerAOTCacheDirArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerAOTCacheDirOption, 0);
+   int32_t xxJITServerAOTCacheSyncPeriodArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerAOTCacheSyncPeriodOption, 0);
+   int32_t xxJITServerUseCompressionArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxJITServerUseCompressionOption, 0);
+   int32_t xxDisableJITServerUseCompressionArgIndex = FIND_ARG_IN_VMARGS(EXACT_MATCH, xxDisableJITServerUseCompressionOption, 0);
 
    if (xxJITServerPortArgIndex >= 0)
       {
@@ -1173,6 +1189,27 @@ static bool JITServerParseCommonOptions(J9JavaVM *vm, TR::CompilationInfo *compI
    if (xxJITServerUseAOTCacheArgIndex > xxDisableJITServerUseAOTCacheArgIndex)
       compInfo->getPersistentInfo()->setJITServerUseAOTCache(true);
 
+   if (xxJITServerAOTCachePersistenceArgIndex > xxDisableJITServerAOTCachePersistenceArgIndex)
+      compInfo->getPersistentInfo()->setJITServerAOTCachePersistence(true);
+
+   if (xxJITServerAOTCacheDirArgIndex >= 0)
+      {
+      char *dir = NULL;
+      GET_OPTION_VALUE(xxJITServerAOTCacheDirArgIndex, '=', &dir);
+      compInfo->getPersistentInfo()->setJITServerAOTCacheDir(dir);
+      }
+
+   if (xxJITServerAOTCacheSyncPeriodArgIndex >= 0)
+      {
+      uint32_t periodMs = 0;
+      IDATA ret = GET_INTEGER_VALUE(xxJITServerAOTCacheSyncPeriodArgIndex, xxJITServerAOTCacheSyncPeriodOption, periodMs);
+      if (ret == OPTION_OK)
+         compInfo->getPersistentInfo()->setJITServerAOTCacheSyncPeriod(periodMs);
+      }
+
+   if (xxJITServerUseCompressionArgIndex > xxDisableJITServerUseCompressionArgIndex)
+      compInfo->getPersistentInfo()->setJITServerUseCompression(true);
+
    return true;
    }
 #endif /* defined(J9VM_OPT_JITSERVER) */
@@ -2074,6 +2111,17 @@ J9::Options::fePreProcess(void * base)
                GET_OPTION_VALUE(xxJITServerAddressArgIndex, '=', &address);
                compInfo->getPersistentInfo()->setJITServerAddress(address);
                }
+
+            const char *xxJITServerMaxConnectionsOption = "-XX:JITServerMaxConnections=";
+            int32_t xxJITServerMaxConnectionsArgIndex = FIND_ARG_IN_VMARGS(STARTSWITH_MATCH, xxJITServerMaxConnectionsOption, 0);
+
+            if (xxJITServerMaxConnectionsArgIndex >= 0)
+               {
+               uint32_t maxConnections = 0;
+               IDATA ret = GET_INTEGER_VALUE(xxJITServerMaxConnectionsArgIndex, xxJITServerMaxConnectionsOption, maxConnections);
+               if (ret == OPTION_OK)
+                  compInfo->getPersistentInfo()->setJITServerMaxConnections(maxConnections);
+               }
             }
          }
       if (!JITServerParseCommonOptions(vm, compInfo))
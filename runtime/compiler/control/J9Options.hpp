@@ -178,6 +178,7 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
    static int32_t _iprofilerIntToTotalSampleRatio;
    static int32_t _iprofilerSamplesBeforeTurningOff;
    static int32_t _iprofilerNumOutstandingBuffers;
+   static int32_t _iprofilerNumWorkerThreads;
    static int32_t _iprofilerBufferMaxPercentageToDiscard;
    static int32_t _iProfilerBufferInterarrivalTimeToExitDeepIdle; // ms
    static int32_t _iprofilerBufferSize; //iprofilerbuffer size in kb
@@ -1157,6 +1157,31 @@ handleServerMessage(JITServer::ClientStream *client, TR_J9VM *fe, JITServer::Mes
          client->write(response, method->getClassFromConstantPool(comp, cpIndex, returnClassForAOT));
          }
          break;
+      case MessageType::ResolvedMethod_getMultipleClassesFromConstantPool:
+         {
+         auto recv = client->getRecvData<TR_ResolvedJ9Method *, std::vector<int32_t>>();
+         TR_ResolvedJ9Method *method = std::get<0>(recv);
+         auto &cpIndices = std::get<1>(recv);
+         std::vector<TR_OpaqueClassBlock *> classes(cpIndices.size());
+         std::vector<JITServerHelpers::ClassInfoTuple> classInfos(cpIndices.size());
+         for (size_t i = 0; i < cpIndices.size(); ++i)
+            {
+            classes[i] = method->getClassFromConstantPool(comp, cpIndices[i]);
+            if (!classes[i])
+               continue;
+
+            // Send the class info along, unless the server is likely to have it cached already
+            bool serializeClass = false;
+               {
+               OMR::CriticalSection romClassCache(compInfo->getclassesCachedAtServerMonitor());
+               serializeClass = compInfo->getclassesCachedAtServer().insert((J9Class *)classes[i]).second;
+               }
+            if (serializeClass)
+               classInfos[i] = JITServerHelpers::packRemoteROMClassInfo((J9Class *)classes[i], fe->vmThread(), trMemory, true);
+            }
+         client->write(response, classes, classInfos);
+         }
+         break;
       case MessageType::ResolvedMethod_getDeclaringClassFromFieldOrStatic:
          {
          auto recv = client->getRecvData<TR_ResolvedJ9Method *, int32_t>();
@@ -3005,6 +3030,25 @@ updateCompThreadActivationPolicy(TR::CompilationInfoPerThreadBase *compInfoPT, J
       }
    }
 
+// Close the connection after a communication error. The connection is either owned by
+// the compilation thread or borrowed from the pool of connections shared by all compilation threads.
+static void
+closeClientStream(TR::CompilationInfoPerThreadBase *compInfoPT, JITServer::ClientStream *client, bool useSharedConnections)
+   {
+   if (useSharedConnections)
+      {
+      // The shared connection may not have been obtained yet
+      if (client)
+         JITServer::ClientStream::discardSharedStream(client);
+      }
+   else
+      {
+      client->~ClientStream();
+      TR_Memory::jitPersistentFree(client);
+      compInfoPT->setClientStream(NULL);
+      }
+   }
+
 TR_MethodMetaData *
 remoteCompile(
    J9VMThread * vmThread,
@@ -3028,24 +3072,36 @@ remoteCompile(
    std::string detailsStr = std::string((char*) &details, sizeof(TR::IlGeneratorMethodDetails));
    TR::CompilationInfo *compInfo = compInfoPT->getCompilationInfo();
    bool useAotCompilation = compInfoPT->getMethodBeingCompiled()->_useAotCompilation;
+   // With -XX:JITServerMaxConnections=<n> compilation threads share a pool of connections that keeps
+   // at least <n> of them open, and grows to one per active compilation thread when needed.
+   // A shared connection is borrowed only for the duration of the request and is obtained after
+   // VM access is released, because we may have to wait for another compilation thread to return one.
+   bool useSharedConnections = !enableJITServerPerCompConn && (compInfo->getPersistentInfo()->getJITServerMaxConnections() > 0);
 
-   JITServer::ClientStream *client = enableJITServerPerCompConn ? NULL : compInfoPT->getClientStream();
+   JITServer::ClientStream *client = (enableJITServerPerCompConn || useSharedConnections) ? NULL : compInfoPT->getClientStream();
    if (!client)
       {
       try
          {
          if (JITServerHelpers::isServerAvailable())
             {
-            client = new (PERSISTENT_NEW) JITServer::ClientStream(compInfo->getPersistentInfo());
-            if (!enableJITServerPerCompConn)
-               compInfoPT->setClientStream(client);
+            if (!useSharedConnections)
+               {
+               client = new (PERSISTENT_NEW) JITServer::ClientStream(compInfo->getPersistentInfo());
+               if (!enableJITServerPerCompConn)
+                  compInfoPT->setClientStream(client);
+               }
             }
          else if (JITServerHelpers::shouldRetryConnection(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary)))
             {
-            client = new (PERSISTENT_NEW) JITServer::ClientStream(compInfo->getPersistentInfo());
-            if (!enableJITServerPerCompConn)
-               compInfoPT->setClientStream(client);
-            JITServerHelpers::postStreamConnectionSuccess();
+            // For shared connections, success is posted once the connection is actually obtained
+            if (!useSharedConnections)
+               {
+               client = new (PERSISTENT_NEW) JITServer::ClientStream(compInfo->getPersistentInfo());
+               if (!enableJITServerPerCompConn)
+                  compInfoPT->setClientStream(client);
+               JITServerHelpers::postStreamConnectionSuccess();
+               }
             }
          else
             {
@@ -3137,6 +3193,13 @@ remoteCompile(
       // message just in case we block in the write operation
       releaseVMAccess(vmThread);
 
+      if (useSharedConnections)
+         {
+         client = JITServer::ClientStream::acquireSharedStream(compInfo->getPersistentInfo());
+         if (!JITServerHelpers::isServerAvailable())
+            JITServerHelpers::postStreamConnectionSuccess();
+         }
+
       if (TR::Options::getVerboseOption(TR_VerboseJITServer))
          {
          TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
@@ -3207,9 +3270,7 @@ remoteCompile(
       {
       JITServerHelpers::postStreamFailure(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary), compInfo);
 
-      client->~ClientStream();
-      TR_Memory::jitPersistentFree(client);
-      compInfoPT->setClientStream(NULL);
+      closeClientStream(compInfoPT, client, useSharedConnections);
 
       if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer, TR_VerboseCompilationDispatch))
           TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE,
@@ -3222,9 +3283,7 @@ remoteCompile(
       }
    catch (const JITServer::StreamVersionIncompatible &e)
       {
-      client->~ClientStream();
-      TR_Memory::jitPersistentFree(client);
-      compInfoPT->setClientStream(NULL);
+      closeClientStream(compInfoPT, client, useSharedConnections);
       JITServer::ClientStream::incrementIncompatibilityCount(OMRPORT_FROM_J9PORT(compInfoPT->getJitConfig()->javaVM->portLibrary));
 
       if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer, TR_VerboseCompilationDispatch))
@@ -3238,9 +3297,7 @@ remoteCompile(
       }
    catch (const JITServer::StreamMessageTypeMismatch &e)
       {
-      client->~ClientStream();
-      TR_Memory::jitPersistentFree(client);
-      compInfoPT->setClientStream(NULL);
+      closeClientStream(compInfoPT, client, useSharedConnections);
 
       if (TR::Options::isAnyVerboseOptionSet(TR_VerboseJITServer, TR_VerboseCompilationDispatch))
          TR_VerboseLog::writeLineLocked(TR_Vlog_FAILURE,
@@ -3254,12 +3311,14 @@ remoteCompile(
    catch (...)
       {
       // For any other type of exception disconnect the socket
-      client->~ClientStream();
-      TR_Memory::jitPersistentFree(client);
-      compInfoPT->setClientStream(NULL);
+      closeClientStream(compInfoPT, client, useSharedConnections);
       throw; // rethrow the exception
       }
 
+   // All the data has been received, so other compilation threads can use the shared connection now
+   if (useSharedConnections)
+      JITServer::ClientStream::releaseSharedStream(client, compInfo->getPersistentInfo());
+
    TR_MethodMetaData *metaData = NULL;
    if (statusCode == compilationOK || statusCode == compilationNotNeeded)
       {
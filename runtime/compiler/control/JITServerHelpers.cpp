@@ -490,7 +490,7 @@ bool
 JITServerHelpers::cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Class *clazz, J9ROMClass *romClass, ClassInfoTuple *classInfoTuple)
    {
    ClientSessionData::ClassInfo classInfo;
-   OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
+   ClientSessionData::ROMMapCriticalSection cacheRemoteROMClass(clientSessionData);
    auto it = clientSessionData->getROMClassMap().find((J9Class*)clazz);
    if (it == clientSessionData->getROMClassMap().end())
       {
@@ -538,7 +538,8 @@ JITServerHelpers::cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Cl
    J9ROMMethod *romMethod = J9ROMCLASS_ROMMETHODS(romClass);
    for (uint32_t i = 0; i < numMethods; i++)
       {
-      clientSessionData->getJ9MethodMap().insert({&methods[i],
+      ClientSessionData::J9MethodMapCriticalSection methodMap(clientSessionData, &methods[i]);
+      methodMap.map().insert({&methods[i],
             {romMethod, origROMMethods[i], NULL, static_cast<bool>(methodTracingInfo[i]), (TR_OpaqueClassBlock *)clazz, false}});
       romMethod = nextROMMethod(romMethod);
       }
@@ -547,7 +548,7 @@ JITServerHelpers::cacheRemoteROMClass(ClientSessionData *clientSessionData, J9Cl
 J9ROMClass *
 JITServerHelpers::getRemoteROMClassIfCached(ClientSessionData *clientSessionData, J9Class *clazz)
    {
-   OMR::CriticalSection getRemoteROMClassIfCached(clientSessionData->getROMMapMonitor());
+   ClientSessionData::ROMMapCriticalSection getRemoteROMClassIfCached(clientSessionData);
    auto it = clientSessionData->getROMClassMap().find(clazz);
    return (it == clientSessionData->getROMClassMap().end()) ? NULL : it->second._romClass;
    }
@@ -644,7 +645,7 @@ JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData *cli
       return false;
       }
       {
-      OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(clientSessionData);
       auto it = clientSessionData->getROMClassMap().find((J9Class*)clazz);
       if (it != clientSessionData->getROMClassMap().end())
          {
@@ -657,7 +658,7 @@ JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData *cli
    const auto &recv = stream->read<ClassInfoTuple>();
    classInfoTuple = std::get<0>(recv);
 
-   OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
+   ClientSessionData::ROMMapCriticalSection cacheRemoteROMClass(clientSessionData);
    auto it = clientSessionData->getROMClassMap().find(clazz);
    if (it == clientSessionData->getROMClassMap().end())
       {
@@ -683,7 +684,7 @@ JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData *cli
       return false;
       }
       {
-      OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(clientSessionData);
       auto it = clientSessionData->getROMClassMap().find((J9Class*)clazz);
       if (it != clientSessionData->getROMClassMap().end())
          {
@@ -696,7 +697,7 @@ JITServerHelpers::getAndCacheRAMClassInfo(J9Class *clazz, ClientSessionData *cli
    const auto &recv = stream->read<ClassInfoTuple>();
    classInfoTuple = std::get<0>(recv);
 
-   OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
+   ClientSessionData::ROMMapCriticalSection cacheRemoteROMClass(clientSessionData);
    auto it = clientSessionData->getROMClassMap().find(clazz);
    if (it == clientSessionData->getROMClassMap().end())
       {
@@ -835,8 +836,8 @@ JITServerHelpers::romMethodOfRamMethod(J9Method* method)
 
    // Check if the method is already cached.
       {
-      OMR::CriticalSection romCache(clientData->getROMMapMonitor());
-      auto &map = clientData->getJ9MethodMap();
+      ClientSessionData::J9MethodMapCriticalSection methodMap(clientData, method);
+      auto &map = methodMap.map();
       auto it = map.find((J9Method*) method);
       if (it != map.end())
          romMethod = it->second._romMethod;
@@ -850,8 +851,8 @@ JITServerHelpers::romMethodOfRamMethod(J9Method* method)
       J9Class *clazz = (J9Class*) std::get<0>(stream->read<TR_OpaqueClassBlock *>());
       TR::compInfoPT->getAndCacheRemoteROMClass(clazz);
          {
-         OMR::CriticalSection romCache(clientData->getROMMapMonitor());
-         auto &map = clientData->getJ9MethodMap();
+         ClientSessionData::J9MethodMapCriticalSection methodMap(clientData, method);
+         auto &map = methodMap.map();
          auto it = map.find((J9Method *) method);
          if (it != map.end())
             romMethod = it->second._romMethod;
@@ -927,7 +928,7 @@ JITServerHelpers::getRemoteClassDepthAndFlagsWhenROMClassNotCached(J9Class *claz
    const auto &recv = stream->read<JITServerHelpers::ClassInfoTuple>();
    JITServerHelpers::ClassInfoTuple classInfoTuple = std::get<0>(recv);
 
-   OMR::CriticalSection cacheRemoteROMClass(clientSessionData->getROMMapMonitor());
+   ClientSessionData::ROMMapCriticalSection cacheRemoteROMClass(clientSessionData);
    auto it = clientSessionData->getROMClassMap().find(clazz);
    if (it == clientSessionData->getROMClassMap().end())
       {
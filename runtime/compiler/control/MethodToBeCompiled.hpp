@@ -80,6 +80,9 @@ struct TR_MethodToBeCompiled
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    TR_MethodToBeCompiled *_next;
+   TR_MethodToBeCompiled *_prev; // only valid while the entry is in the main compilation queue
+   TR_MethodToBeCompiled *_nextInMethodBucket; // chains queued entries with the same J9Method hash
+   J9Method              *_queuedMethod; // J9Method the entry was hashed with when queued, NULL if it was not hashed
    TR::IlGeneratorMethodDetails _methodDetailsStorage;
    TR::IlGeneratorMethodDetails *_methodDetails;
    void                  *_oldStartPC;
@@ -108,6 +108,7 @@
 #include "ras/DebugExt.hpp"
 #include "env/exports.h"
 #if defined(J9VM_OPT_JITSERVER)
+#include "control/JITServerHelpers.hpp"
 #include "env/JITServerPersistentCHTable.hpp"
 #include "net/CommunicationStream.hpp"
 #include "net/ClientStream.hpp"
@@ -654,6 +655,16 @@ jitExclusiveVMShutdownPending(J9VMThread * vmThread)
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    getCompilationInfo(javaVM->jitConfig)->stopCompilationThreads();
+
+#if defined(J9VM_OPT_JITSERVER)
+   // Compilation threads are stopped, so the AOT caches can no longer change
+   if (compInfo->getJITServerAOTCacheMap() && compInfo->getPersistentInfo()->getJITServerAOTCachePersistence())
+      compInfo->getJITServerAOTCacheMap()->saveCaches();
+
+   // Shared connections are not owned by any compilation thread, so they are closed here
+   if (compInfo->getPersistentInfo()->getRemoteCompilationMode() == JITServer::CLIENT)
+      JITServer::ClientStream::closeSharedStreams(JITServerHelpers::isServerAvailable());
+#endif /* defined(J9VM_OPT_JITSERVER) */
 #endif
    }
 
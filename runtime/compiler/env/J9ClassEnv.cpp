@@ -746,7 +746,7 @@ J9::ClassEnv::getROMClassRefName(TR::Compilation *comp, TR_OpaqueClassBlock *cla
       TR::CompilationInfoPerThread *compInfoPT = TR::compInfoPT;
       char *name = NULL;
 
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData());
       auto &classMap = compInfoPT->getClientData()->getROMClassMap();
       auto it = classMap.find(reinterpret_cast<J9Class *>(clazz));
       auto &classInfo = it->second;
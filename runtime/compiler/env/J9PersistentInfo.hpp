@@ -159,6 +159,11 @@ class PersistentInfo : public OMR::PersistentInfoConnector
          _socketTimeoutMs(2000),
          _clientUID(0),
          _JITServerUseAOTCache(false),
+         _JITServerAOTCachePersistence(false),
+         _JITServerAOTCacheDir(),
+         _JITServerAOTCacheSyncPeriod(0),
+         _JITServerUseCompression(false),
+         _JITServerMaxConnections(0),
 #endif /* defined(J9VM_OPT_JITSERVER) */
       OMR::PersistentInfoConnector(pm)
       {}
@@ -334,6 +339,16 @@ class PersistentInfo : public OMR::PersistentInfoConnector
    void setClientUID(uint64_t val) { _clientUID = val; }
    bool getJITServerUseAOTCache() const { return _JITServerUseAOTCache; }
    void setJITServerUseAOTCache(bool use) { _JITServerUseAOTCache = use; }
+   bool getJITServerAOTCachePersistence() const { return _JITServerAOTCachePersistence; }
+   void setJITServerAOTCachePersistence(bool use) { _JITServerAOTCachePersistence = use; }
+   const std::string &getJITServerAOTCacheDir() const { return _JITServerAOTCacheDir; }
+   void setJITServerAOTCacheDir(const char *dir) { _JITServerAOTCacheDir = dir; }
+   uint32_t getJITServerAOTCacheSyncPeriod() const { return _JITServerAOTCacheSyncPeriod; }
+   void setJITServerAOTCacheSyncPeriod(uint32_t periodMs) { _JITServerAOTCacheSyncPeriod = periodMs; }
+   bool getJITServerUseCompression() const { return _JITServerUseCompression; }
+   void setJITServerUseCompression(bool use) { _JITServerUseCompression = use; }
+   uint32_t getJITServerMaxConnections() const { return _JITServerMaxConnections; }
+   void setJITServerMaxConnections(uint32_t n) { _JITServerMaxConnections = n; }
 #endif /* defined(J9VM_OPT_JITSERVER) */
 
    private:
@@ -424,6 +439,11 @@ class PersistentInfo : public OMR::PersistentInfoConnector
    uint32_t    _socketTimeoutMs; // timeout for communication sockets used in out-of-process JIT compilation
    uint64_t    _clientUID;
    bool        _JITServerUseAOTCache;
+   bool        _JITServerAOTCachePersistence; // save AOT caches to snapshot files at shutdown and load them on first use
+   std::string _JITServerAOTCacheDir; // directory for AOT cache snapshot files
+   uint32_t    _JITServerAOTCacheSyncPeriod; // if non-zero, exchange AOT cache snapshots with other servers via the AOT cache directory every this many ms
+   bool        _JITServerUseCompression; // compress large messages if both client and server enable it
+   uint32_t    _JITServerMaxConnections; // if non-zero, compilation threads share a pool of connections to the server that is kept to this size when they are idle
 #endif /* defined(J9VM_OPT_JITSERVER) */
    };
 
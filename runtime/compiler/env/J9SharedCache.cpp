@@ -1415,7 +1415,7 @@ TR_J9JITServerSharedCache::getClassChainOffsetOfIdentifyingLoaderForClazzInShare
       // If we got a valid value back, cache that
       if (classChainOffset)
          {
-         OMR::CriticalSection getRemoteROMClass(clientData->getROMMapMonitor());
+         ClientSessionData::ROMMapCriticalSection getRemoteROMClass(clientData);
          auto it = clientData->getROMClassMap().find((J9Class*) clazz);
          if (it != clientData->getROMClassMap().end())
             {
@@ -2692,9 +2692,10 @@ TR_J9VMBase::isQueuedForVeryHotOrScorching(TR_ResolvedMethod *calleeMethod, TR::
    _compInfo->acquireCompMonitor(_vmThread);
    //Check again in case another thread has already upgraded this request
 
-   for (TR_MethodToBeCompiled *cur = TR::CompilationController::getCompilationInfo()->getMethodQueue(); cur; cur = cur->_next)
+   J9Method *j9method = (J9Method *) calleeMethod->getPersistentIdentifier();
+   for (TR_MethodToBeCompiled *cur = TR::CompilationController::getCompilationInfo()->getFirstQueuedEntryInMethodBucket(j9method); cur; cur = cur->_nextInMethodBucket)
       {
-      if (cur->getMethodDetails().getMethod() == (J9Method*) calleeMethod->getPersistentIdentifier() && cur->getMethodDetails().isOrdinaryMethod())
+      if (cur->getMethodDetails().getMethod() == j9method && cur->getMethodDetails().isOrdinaryMethod())
          {
          isQueuedForVeryHotOrScorching = cur->_optimizationPlan->getOptLevel() >= veryHot;
          break;
@@ -256,9 +256,9 @@ bool
 TR_J9ServerVM::isMethodTracingEnabled(TR_OpaqueMethodBlock *method)
    {
       {
-      OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
-      auto it = _compInfoPT->getClientData()->getJ9MethodMap().find((J9Method*) method);
-      if (it != _compInfoPT->getClientData()->getJ9MethodMap().end())
+      ClientSessionData::J9MethodMapCriticalSection methodMap(_compInfoPT->getClientData(), (J9Method*) method);
+      auto it = methodMap.map().find((J9Method*) method);
+      if (it != methodMap.map().end())
          {
          return it->second._isMethodTracingEnabled;
          }
@@ -388,7 +388,7 @@ TR_J9ServerVM::getClassFromSignature(const char *sig, int32_t length, TR_OpaqueM
       // make sure that the class is cached
       J9ROMClass *romClass = TR::Compiler->cls.romClassOf(clazz);
       TR_ASSERT_FATAL(romClass, "class %p could not be cached", clazz);
-      OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(_compInfoPT->getClientData());
       auto it = _compInfoPT->getClientData()->getROMClassMap().find(reinterpret_cast<J9Class *>(clazz));
       if (it != _compInfoPT->getClientData()->getROMClassMap().end())
          {
@@ -503,7 +503,7 @@ TR_J9ServerVM::jitStaticsAreSame(TR_ResolvedMethod *method1, I_32 cpIndex1, TR_R
 bool
 TR_J9ServerVM::getCachedField(J9Class *ramClass, int32_t cpIndex, J9Class **declaringClass, UDATA *field)
    {
-   OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+   ClientSessionData::ROMMapCriticalSection getRemoteROMClass(_compInfoPT->getClientData());
    auto it = _compInfoPT->getClientData()->getROMClassMap().find(ramClass);
    if (it != _compInfoPT->getClientData()->getROMClassMap().end())
       {
@@ -525,7 +525,7 @@ TR_J9ServerVM::cacheField(J9Class *ramClass, int32_t cpIndex, J9Class *declaring
    // Do not cache unresolved fields
    if (field == 0)
       return;
-   OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+   ClientSessionData::ROMMapCriticalSection getRemoteROMClass(_compInfoPT->getClientData());
    auto it = _compInfoPT->getClientData()->getROMClassMap().find(ramClass);
    if (it != _compInfoPT->getClientData()->getROMClassMap().end())
       {
@@ -586,7 +586,7 @@ TR_J9ServerVM::classHasBeenExtended(TR_OpaqueClassBlock *clazz)
       return true;
 
       {
-      OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(clientSessionData);
       auto it = clientSessionData->getROMClassMap().find((J9Class*)clazz);
       if (it != clientSessionData->getROMClassMap().end())
          {
@@ -693,7 +693,7 @@ TR_J9ServerVM::isClassInitialized(TR_OpaqueClassBlock * clazz)
       isClassInitialized = std::get<0>(stream->read<bool>());
       if (isClassInitialized)
          {
-         OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+         ClientSessionData::ROMMapCriticalSection getRemoteROMClass(_compInfoPT->getClientData());
          auto it = _compInfoPT->getClientData()->getROMClassMap().find((J9Class*) clazz);
          if (it != _compInfoPT->getClientData()->getROMClassMap().end())
             {
@@ -709,9 +709,9 @@ TR_J9ServerVM::getOSRFrameSizeInBytes(TR_OpaqueMethodBlock * method)
    {
       {
       ClientSessionData *clientSessionData = _compInfoPT->getClientData();
-      OMR::CriticalSection getRemoteROMClass(clientSessionData->getROMMapMonitor());
-      auto it = clientSessionData->getJ9MethodMap().find((J9Method*) method);
-      if (it != clientSessionData->getJ9MethodMap().end())
+      ClientSessionData::J9MethodMapCriticalSection methodMap(clientSessionData, (J9Method*) method);
+      auto it = methodMap.map().find((J9Method*) method);
+      if (it != methodMap.map().end())
          {
          return osrFrameSizeRomMethod(it->second._romMethod);
          }
@@ -1029,7 +1029,7 @@ TR_J9ServerVM::canAllocateInlineClass(TR_OpaqueClassBlock *clazz)
       isClassInitialized = std::get<0>(stream->read<bool>());
       if (isClassInitialized)
          {
-         OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+         ClientSessionData::ROMMapCriticalSection getRemoteROMClass(_compInfoPT->getClientData());
          auto it = _compInfoPT->getClientData()->getROMClassMap().find((J9Class*) clazz);
          if (it != _compInfoPT->getClientData()->getROMClassMap().end())
             {
@@ -1068,7 +1068,7 @@ TR_J9ServerVM::getArrayClassFromComponentClass(TR_OpaqueClassBlock *componentCla
       if (arrayClass)
          {
          // if client initialized arrayClass, cache the new value
-         OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+         ClientSessionData::ROMMapCriticalSection getRemoteROMClass(_compInfoPT->getClientData());
          auto it = _compInfoPT->getClientData()->getROMClassMap().find((J9Class*) componentClass);
          if (it != _compInfoPT->getClientData()->getROMClassMap().end())
             {
@@ -1531,9 +1531,9 @@ TR_OpaqueClassBlock *
 TR_J9ServerVM::getClassFromMethodBlock(TR_OpaqueMethodBlock *method)
    {
       {
-      OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
-      auto it = _compInfoPT->getClientData()->getJ9MethodMap().find((J9Method*) method);
-      if (it != _compInfoPT->getClientData()->getJ9MethodMap().end())
+      ClientSessionData::J9MethodMapCriticalSection methodMap(_compInfoPT->getClientData(), (J9Method*) method);
+      auto it = methodMap.map().find((J9Method*) method);
+      if (it != methodMap.map().end())
          {
          return it->second._owningClass;
          }
@@ -1731,7 +1731,7 @@ TR_J9ServerVM::instanceOfOrCheckCastHelper(J9Class *instanceClass, J9Class* cast
    // When castClass is an ancestor/interface of class instanceClass, can avoid a remote message,
    // since superclasses and interfaces are cached on the server
       {
-      OMR::CriticalSection getRemoteROMClass(_compInfoPT->getClientData()->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(_compInfoPT->getClientData());
       auto it = _compInfoPT->getClientData()->getROMClassMap().find((J9Class*) instanceClass);
       if (it != _compInfoPT->getClientData()->getROMClassMap().end())
          {
@@ -1933,9 +1933,9 @@ TR_J9ServerVM::getROMMethodFromRAMMethod(J9Method *ramMethod)
    {
       {
       // Check persistent cache first
-      OMR::CriticalSection J9MethodMapMonitor(_compInfoPT->getClientData()->getROMMapMonitor());
-      auto it = _compInfoPT->getClientData()->getJ9MethodMap().find(ramMethod);
-      if (it != _compInfoPT->getClientData()->getJ9MethodMap().end())
+      ClientSessionData::J9MethodMapCriticalSection methodMap(_compInfoPT->getClientData(), ramMethod);
+      auto it = methodMap.map().find(ramMethod);
+      if (it != methodMap.map().end())
          {
          return it->second._origROMMethod;
          }
@@ -158,7 +158,7 @@ TR_ResolvedJ9JITServerMethod::definingClassFromCPFieldRef(TR::Compilation *comp,
    {
    TR::CompilationInfoPerThread *compInfoPT = _fe->_compInfoPT;
       {
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData());
       auto &cache = getJ9ClassInfo(compInfoPT, _ramClass)._fieldOrStaticDefiningClassCache;
       auto it = cache.find(cpIndex);
       if (it != cache.end())
@@ -173,7 +173,7 @@ TR_ResolvedJ9JITServerMethod::definingClassFromCPFieldRef(TR::Compilation *comp,
    // Do not cache if the class is unresolved, because it may become resolved later on
    if (resolvedClass)
       {
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData());
       auto &cache = getJ9ClassInfo(compInfoPT, _ramClass)._fieldOrStaticDefiningClassCache;
       cache.insert({cpIndex, resolvedClass});
       }
@@ -191,7 +191,7 @@ TR_ResolvedJ9JITServerMethod::getClassFromConstantPool(TR::Compilation * comp, u
 
    TR::CompilationInfoPerThread *compInfoPT = _fe->_compInfoPT;
       {
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData());
       auto &constantClassPoolCache = getJ9ClassInfo(compInfoPT, _ramClass)._constantClassPoolCache;
       auto it = constantClassPoolCache.find(cpIndex);
       if (it != constantClassPoolCache.end())
@@ -201,7 +201,7 @@ TR_ResolvedJ9JITServerMethod::getClassFromConstantPool(TR::Compilation * comp, u
    TR_OpaqueClassBlock *resolvedClass = std::get<0>(_stream->read<TR_OpaqueClassBlock *>());
    if (resolvedClass)
       {
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData());
       auto &constantClassPoolCache = getJ9ClassInfo(compInfoPT, _ramClass)._constantClassPoolCache;
       constantClassPoolCache.insert({cpIndex, resolvedClass});
       }
@@ -213,7 +213,7 @@ TR_ResolvedJ9JITServerMethod::getDeclaringClassFromFieldOrStatic(TR::Compilation
    {
    TR::CompilationInfoPerThread *compInfoPT = _fe->_compInfoPT;
       {
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData());
       auto &cache = getJ9ClassInfo(compInfoPT, _ramClass)._fieldOrStaticDeclaringClassCache;
       auto it = cache.find(cpIndex);
       if (it != cache.end())
@@ -223,7 +223,7 @@ TR_ResolvedJ9JITServerMethod::getDeclaringClassFromFieldOrStatic(TR::Compilation
    TR_OpaqueClassBlock *declaringClass = std::get<0>(_stream->read<TR_OpaqueClassBlock *>());
    if (declaringClass)
       {
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData());
       auto &cache = getJ9ClassInfo(compInfoPT, _ramClass)._fieldOrStaticDeclaringClassCache;
       cache.insert({cpIndex, declaringClass});
       }
@@ -239,7 +239,7 @@ TR_ResolvedJ9JITServerMethod::classOfStatic(I_32 cpIndex, bool returnClassForAOT
 
    auto compInfoPT = static_cast<TR::CompilationInfoPerThreadRemote *>(_fe->_compInfoPT);
       {
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor()); 
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData()); 
       auto &classOfStaticCache = getJ9ClassInfo(compInfoPT, _ramClass)._classOfStaticCache;
       auto it = classOfStaticCache.find(cpIndex);
       if (it != classOfStaticCache.end())
@@ -257,7 +257,7 @@ TR_ResolvedJ9JITServerMethod::classOfStatic(I_32 cpIndex, bool returnClassForAOT
       // reacquire monitor and cache, if client returned a valid class
       // if client returned NULL, don't cache, because class might not be fully initialized,
       // so the result may change in the future
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor()); 
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData()); 
       auto &classOfStaticCache = getJ9ClassInfo(compInfoPT, _ramClass)._classOfStaticCache;
       classOfStaticCache.insert({cpIndex, classOfStatic});
       }
@@ -522,7 +522,7 @@ TR_ResolvedJ9JITServerMethod::getCachedFieldAttributes(int32_t cpIndex, TR_J9Met
    auto compInfoPT = static_cast<TR::CompilationInfoPerThreadRemote *>(_fe->_compInfoPT);
       {
       // First, search a global cache
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor()); 
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData()); 
       auto &attributesCache = getAttributesCache(isStatic);
       auto it = attributesCache.find(cpIndex);
       if (it != attributesCache.end())
@@ -556,7 +556,7 @@ TR_ResolvedJ9JITServerMethod::cacheFieldAttributes(int32_t cpIndex, const TR_J9M
    else
       {
       // field is resolved in CP, can cache globally per RAM class.
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor()); 
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData()); 
       auto &attributesCache = getAttributesCache(isStatic);
 #if defined(DEBUG) || defined(PROD_WITH_ASSUMES)
       TR_ASSERT(canCacheFieldAttributes(cpIndex, attributes, isStatic), "new and cached field attributes are not equal");
@@ -1887,13 +1887,88 @@ TR_ResolvedJ9JITServerMethod::cacheFields()
    auto &declaringClasses = std::get<0>(recv);
    auto &fields = std::get<1>(recv);
    TR_ASSERT(numFields == declaringClasses.size(), "Number of received fields does not match the requested number");
-   OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+   ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData());
    for (int32_t i = 0; i < numFields; ++i)
       {
       serverVM->cacheField(ramClass, cpIndices[i], declaringClasses[i], fields[i]);
       }
    }
 
+void
+TR_ResolvedJ9JITServerMethod::cacheClassesFromConstantPool()
+   {
+   // 1. Iterate through bytecodes and look for class references
+   // (allocations, type checks). If the class for a constant pool entry is not cached,
+   // add it to the list of classes that will be requested from the client in one batch.
+   auto compInfoPT = _fe->_compInfoPT;
+   TR_J9ByteCodeIterator bci(0, this, _fe, compInfoPT->getCompilation());
+   std::vector<int32_t> cpIndices;
+      {
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData());
+      auto &constantClassPoolCache = getJ9ClassInfo(compInfoPT, _ramClass)._constantClassPoolCache;
+      for (TR_J9ByteCode bc = bci.first(); bc != J9BCunknown; bc = bci.next())
+         {
+         switch (bc)
+            {
+            case J9BCnew:
+            case J9BCanewarray:
+            case J9BCmultianewarray:
+            case J9BCcheckcast:
+            case J9BCinstanceof:
+               {
+               int32_t cpIndex = bci.next2Bytes();
+               if ((constantClassPoolCache.find(cpIndex) == constantClassPoolCache.end()) &&
+                   (std::find(cpIndices.begin(), cpIndices.end(), cpIndex) == cpIndices.end()))
+                  cpIndices.push_back(cpIndex);
+               break;
+               }
+            default:
+               {
+               // do nothing
+               break;
+               }
+            }
+         }
+      }
+
+   // If there's just one class, it's faster to get it through regular means,
+   // to avoid overhead of vectors
+   int32_t numClasses = cpIndices.size();
+   if (numClasses < 2)
+      return;
+
+   // 2. Send a message to resolve all the classes. The client also sends the class info
+   // for the classes it has not yet sent to the server, so that later queries about them hit the cache.
+   JITServer::ServerStream *stream = compInfoPT->getMethodBeingCompiled()->_stream;
+   stream->write(JITServer::MessageType::ResolvedMethod_getMultipleClassesFromConstantPool, _remoteMirror, cpIndices);
+   auto recv = stream->read<std::vector<TR_OpaqueClassBlock *>, std::vector<JITServerHelpers::ClassInfoTuple>>();
+
+   // 3. Cache all received classes. Unresolved entries are not cached,
+   // same as in getClassFromConstantPool()
+   auto &classes = std::get<0>(recv);
+   auto &classInfos = std::get<1>(recv);
+   TR_ASSERT(numClasses == classes.size(), "Number of received classes does not match the requested number");
+   ClientSessionData *clientSessionData = compInfoPT->getClientData();
+   ClientSessionData::ROMMapCriticalSection cacheRemoteROMClass(clientSessionData);
+   auto &constantClassPoolCache = getJ9ClassInfo(compInfoPT, _ramClass)._constantClassPoolCache;
+   for (int32_t i = 0; i < numClasses; ++i)
+      {
+      if (!classes[i])
+         continue;
+      constantClassPoolCache.insert({cpIndices[i], classes[i]});
+
+      auto &classInfoTuple = classInfos[i];
+      J9Class *clazz = (J9Class *)classes[i];
+      if (!std::get<0>(classInfoTuple).empty() &&
+          (clientSessionData->getROMClassMap().find(clazz) == clientSessionData->getROMClassMap().end()))
+         {
+         ClientSessionData::ClassInfo classInfo;
+         auto romClass = JITServerHelpers::romClassFromString(std::get<0>(classInfoTuple), clientSessionData->persistentMemory());
+         JITServerHelpers::cacheRemoteROMClass(clientSessionData, clazz, romClass, &classInfoTuple, classInfo);
+         }
+      }
+   }
+
 int32_t
 TR_ResolvedJ9JITServerMethod::collectImplementorsCapped(
    TR_OpaqueClassBlock *topClass,
@@ -2793,7 +2868,7 @@ TR_J9ServerMethod::TR_J9ServerMethod(TR_FrontEnd * fe, TR_Memory * trMemory, J9C
    bool cached = false;
       {
       // look up parameters for construction of this method in a cache first
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData());
       auto &cache = getJ9ClassInfo(compInfoPT, aClazz)._J9MethodNameCache;
       // search the cache for existing method parameters
       auto it = cache.find(cpIndex);
@@ -2817,7 +2892,7 @@ TR_J9ServerMethod::TR_J9ServerMethod(TR_FrontEnd * fe, TR_Memory * trMemory, J9C
       methodNameStr = std::get<1>(recv);
       methodSignatureStr = std::get<2>(recv);
 
-      OMR::CriticalSection getRemoteROMClass(compInfoPT->getClientData()->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(compInfoPT->getClientData());
       auto &cache = getJ9ClassInfo(compInfoPT, aClazz)._J9MethodNameCache;
       cache.insert({cpIndex, {classNameStr, methodNameStr, methodSignatureStr}});
       }
@@ -237,6 +237,12 @@ TR::Block * TR_J9ByteCodeIlGenerator::walker(TR::Block * prevBlock)
       // Cache field info for every field/static loaded/stored in this method, which are later used by
       // jitFieldsAreSame/jitStaticAreSame when creating symbol references.
       static_cast<TR_ResolvedJ9JITServerMethod *>(_methodSymbol->getResolvedMethod())->cacheFields();
+
+      // Prefetch the classes referenced by allocations and type checks, together with their class info,
+      // which would otherwise be requested one at a time while generating IL and during optimization.
+      // Not done for AOT compilations, where every class must go through symbol validation.
+      if (!comp()->compileRelocatableCode())
+         static_cast<TR_ResolvedJ9JITServerMethod *>(_methodSymbol->getResolvedMethod())->cacheClassesFromConstantPool();
       }
 #endif
 
@@ -23,6 +23,9 @@
 #include "ClientStream.hpp"
 #include "control/CompilationRuntime.hpp"
 #include "control/Options.hpp"
+#include "env/TRMemory.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
 #include "env/VerboseLog.hpp"
 #include "net/LoadSSLLibs.hpp"
 #include <sys/types.h>
@@ -33,6 +36,7 @@
 #include <netinet/tcp.h>	/* for TCP_NODELAY option */
 #include <fcntl.h>
 #include <arpa/inet.h>
+#include <algorithm>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h> /// gethostname, read, write
@@ -53,6 +57,13 @@ const int ClientStream::INCOMPATIBILITY_COUNT_LIMIT = 5;
 // This is called during startup from rossa.cpp
 int ClientStream::static_init(TR::PersistentInfo *info)
    {
+   if (info->getJITServerMaxConnections() > 0)
+      {
+      _sharedStreamsMonitor = TR::Monitor::create("JIT-ClientSharedStreamsMonitor");
+      if (!_sharedStreamsMonitor)
+         return -1;
+      }
+
    if (!CommunicationStream::useSSL())
       return 0;
 
@@ -278,11 +289,115 @@ BIO *openSSLConnection(SSL_CTX *ctx, int connfd)
    }
 
 ClientStream::ClientStream(TR::PersistentInfo *info)
-   : CommunicationStream(), _versionCheckStatus(NOT_DONE)
+   : CommunicationStream(), _versionCheckStatus(NOT_DONE), _nextIdleSharedStream(NULL)
    {
    int connfd = openConnection(info->getJITServerAddress(), info->getJITServerPort(), info->getSocketTimeout());
    BIO *ssl = openSSLConnection(_sslCtx, connfd);
    initStream(connfd, ssl);
    _numConnectionsOpened++;
    }
+TR::Monitor *ClientStream::_sharedStreamsMonitor = NULL;
+ClientStream *ClientStream::_idleSharedStreams = NULL;
+uint32_t ClientStream::_numSharedStreams = 0;
+
+// A compilation thread must not wait for another one to finish its compilation
+// before it can send its own request, so the pool can grow to one connection per
+// active compilation thread even if -XX:JITServerMaxConnections is lower
+static uint32_t
+getMaxSharedStreams(TR::PersistentInfo *info)
+   {
+   int32_t numActiveThreads = TR::CompilationInfo::get()->getNumCompThreadsActive();
+   return std::max(info->getJITServerMaxConnections(), (uint32_t)std::max(numActiveThreads, 1));
+   }
+
+ClientStream *
+ClientStream::acquireSharedStream(TR::PersistentInfo *info)
+   {
+   _sharedStreamsMonitor->enter();
+   while (!_idleSharedStreams && (_numSharedStreams >= getMaxSharedStreams(info)))
+      _sharedStreamsMonitor->wait();
+
+   ClientStream *stream = _idleSharedStreams;
+   if (stream)
+      {
+      _idleSharedStreams = stream->_nextIdleSharedStream;
+      stream->_nextIdleSharedStream = NULL;
+      _sharedStreamsMonitor->exit();
+      return stream;
+      }
+
+   // Reserve a slot for the new connection, but open it outside of the monitor
+   // because connecting to the server can take up to the socket timeout
+   _numSharedStreams++;
+   _sharedStreamsMonitor->exit();
+   try
+      {
+      return new (PERSISTENT_NEW) ClientStream(info);
+      }
+   catch (...)
+      {
+      OMR::CriticalSection sharedStreams(_sharedStreamsMonitor);
+      _numSharedStreams--;
+      _sharedStreamsMonitor->notify();
+      throw;
+      }
+   }
+
+void
+ClientStream::releaseSharedStream(ClientStream *stream, TR::PersistentInfo *info)
+   {
+      {
+      OMR::CriticalSection sharedStreams(_sharedStreamsMonitor);
+      if (_numSharedStreams <= getMaxSharedStreams(info))
+         {
+         stream->_nextIdleSharedStream = _idleSharedStreams;
+         _idleSharedStreams = stream;
+         _sharedStreamsMonitor->notify();
+         return;
+         }
+      }
+   // Fewer compilation threads are active than when this connection was opened,
+   // so shrink the pool back towards -XX:JITServerMaxConnections
+   discardSharedStream(stream);
+   }
+
+void
+ClientStream::discardSharedStream(ClientStream *stream)
+   {
+   stream->~ClientStream();
+   TR_Memory::jitPersistentFree(stream);
+
+   OMR::CriticalSection sharedStreams(_sharedStreamsMonitor);
+   _numSharedStreams--;
+   _sharedStreamsMonitor->notify();
+   }
+
+void
+ClientStream::closeSharedStreams(bool notifyServer)
+   {
+   if (!_sharedStreamsMonitor)
+      return;
+
+   OMR::CriticalSection sharedStreams(_sharedStreamsMonitor);
+   while (ClientStream *stream = _idleSharedStreams)
+      {
+      _idleSharedStreams = stream->_nextIdleSharedStream;
+      if (notifyServer)
+         {
+         try
+            {
+            stream->writeError(MessageType::connectionTerminate, 0 /* placeholder */);
+            }
+         catch (const JITServer::StreamFailure &e)
+            {
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+               TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "JITServer StreamFailure when sending connectionTerminate: %s", e.what());
+            }
+         }
+      stream->~ClientStream();
+      TR_Memory::jitPersistentFree(stream);
+      _numSharedStreams--;
+      }
+   _sharedStreamsMonitor->notifyAll();
+   }
 };
@@ -30,6 +30,7 @@
 
 class SSLOutputStream;
 class SSLInputStream;
+namespace TR { class Monitor; }
 
 namespace JITServer
 {
@@ -86,7 +87,9 @@ public:
       {
       if (getVersionCheckStatus() == NOT_DONE)
          {
-         _cMsg.setFullVersion(getJITServerVersion(), CONFIGURATION_FLAGS);
+         // Connection flags are only sent once per connection, together with the version
+         uint32_t connectionFlags = useCompression() ? JITServerCompressMessages : 0;
+         _cMsg.setFullVersion(getJITServerVersion(), CONFIGURATION_FLAGS | connectionFlags);
          write(MessageType::compilationRequest, args...);
          _cMsg.clearFullVersion();
          }
@@ -122,6 +125,9 @@ public:
    MessageType read()
       {
       readMessage(_sMsg);
+      // The server tells us whether it accepted our request to compress messages on this connection
+      if (!isCompressionEnabled() && (_sMsg.getMetaData()->_config & JITServerCompressMessages))
+         enableCompression();
       return _sMsg.type();
       }
 
@@ -199,9 +205,41 @@ public:
       return _incompatibilityCount < INCOMPATIBILITY_COUNT_LIMIT;
       }
 
+   /**
+      @brief Obtain a connection from the pool of connections shared by all compilation threads
+
+      Used when the client is limited to -XX:JITServerMaxConnections=<n> connections to the server.
+      Idle connections are reused; a new connection is opened only if fewer than <n> exist, or fewer
+      than the number of active compilation threads, so that compilations never queue behind each other.
+      Otherwise the caller blocks until another compilation thread releases one.
+      Must be called without VM access. Throws JITServer::StreamFailure if a new connection cannot be opened.
+   */
+   static ClientStream *acquireSharedStream(TR::PersistentInfo *info);
+
+   /**
+      @brief Return a healthy connection obtained with acquireSharedStream() to the pool
+
+      The connection is closed instead if the pool holds more connections than it may grow to,
+      which happens when compilation threads have been suspended since it was opened.
+   */
+   static void releaseSharedStream(ClientStream *stream, TR::PersistentInfo *info);
+
+   /**
+      @brief Close a connection obtained with acquireSharedStream() after a communication error
+   */
+   static void discardSharedStream(ClientStream *stream);
+
+   /**
+      @brief Close all idle shared connections; called at shutdown after compilation threads have stopped
+
+      @param [in] notifyServer Whether to send a connectionTerminate message on each connection before closing it
+   */
+   static void closeSharedStreams(bool notifyServer);
+
    // Statistics
    static int getNumConnectionsOpened() { return _numConnectionsOpened; }
    static int getNumConnectionsClosed() { return _numConnectionsClosed; }
+   static uint32_t getNumSharedStreams() { return _numSharedStreams; }
 
 private:
    static int _numConnectionsOpened;
@@ -213,6 +251,11 @@ private:
    static const int INCOMPATIBILITY_COUNT_LIMIT;
 
    static SSL_CTX *_sslCtx;
+
+   static TR::Monitor *_sharedStreamsMonitor; // protects the fields below
+   static ClientStream *_idleSharedStreams; // linked through _nextIdleSharedStream
+   static uint32_t _numSharedStreams; // idle + in use
+   ClientStream *_nextIdleSharedStream;
    };
 
 }
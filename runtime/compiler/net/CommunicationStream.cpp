@@ -24,6 +24,7 @@
 #include "control/Options.hpp" // TR::Options::useCompressedPointers()
 #include "env/CompilerEnv.hpp" // for TR::Compiler->target.is64Bit()
 #include "net/CommunicationStream.hpp"
+#include "zlib.h"
 
 
 namespace JITServer
@@ -51,6 +52,11 @@ bool CommunicationStream::useSSL()
            compInfo->getJITServerSslRootCerts().size());
    }
 
+bool CommunicationStream::useCompression()
+   {
+   return TR::CompilationInfo::get()->getPersistentInfo()->getJITServerUseCompression();
+   }
+
 void CommunicationStream::initSSL()
    {
    (*OSSL_load_error_strings)();
@@ -69,6 +75,12 @@ CommunicationStream::readMessage2(Message &msg)
    uint32_t serializedSize;
    readBlocking(serializedSize);
 
+   if (serializedSize & COMPRESSED_MESSAGE_FLAG)
+      {
+      readCompressedMessage(msg, serializedSize & ~COMPRESSED_MESSAGE_FLAG, (const char *)&serializedSize, sizeof(serializedSize));
+      return;
+      }
+
    msg.expandBufferIfNeeded(serializedSize);
    msg.setSerializedSize(serializedSize);
 
@@ -106,6 +118,12 @@ CommunicationStream::readMessage(Message &msg)
 
    // bytesRead >= sizeof(uint32_t)
    uint32_t serializedSize = ((uint32_t *)buffer)[0];
+   if (serializedSize & COMPRESSED_MESSAGE_FLAG)
+      {
+      readCompressedMessage(msg, serializedSize & ~COMPRESSED_MESSAGE_FLAG, buffer, bytesRead);
+      return;
+      }
+
    if (bytesRead > serializedSize)
       {
       throw JITServer::StreamFailure("JITServer I/O error: read more than the message size");
@@ -142,8 +160,170 @@ void
 CommunicationStream::writeMessage(Message &msg)
    {
    char *serialMsg = msg.serialize();
-   // write serialized message to the socket
-   writeBlocking(serialMsg, msg.serializedSize());
+   uint32_t serializedSize = msg.serializedSize();
+   // write serialized message to the socket, compressing it if it's large enough
+   if (msg.hasExternalData())
+      writeMessageGather(msg);
+   else if (!_compressionEnabled || (serializedSize < COMPRESSION_THRESHOLD) ||
+       !writeCompressedMessage(serialMsg, serializedSize))
+      writeBlocking(serialMsg, serializedSize);
    msg.clearForWrite();
    }
+
+void
+CommunicationStream::writeMessageGather(const Message &msg)
+   {
+   // The message is sent as a sequence of segments alternating between the message buffer
+   // and external data, which is located right before the corresponding buffer offset
+   char *buffer = msg.getBufferStart();
+   uint32_t bufferSize = msg.getBufferSize();
+   uint32_t curOffset = 0;
+   _iovecs.clear();
+   for (auto &ext : msg.getExternalData())
+      {
+      if (ext._offset > curOffset)
+         _iovecs.push_back({ buffer + curOffset, ext._offset - curOffset });
+      _iovecs.push_back({ (void *)ext._dataStart, ext._dataSize });
+      curOffset = ext._offset;
+      }
+   if (bufferSize > curOffset)
+      _iovecs.push_back({ buffer + curOffset, bufferSize - curOffset });
+
+   writevBlocking(_iovecs.data(), _iovecs.size());
+   }
+
+void
+CommunicationStream::ensureCompressionBufferCapacity(uint32_t requiredSize)
+   {
+   if (requiredSize > _compressionBufferCapacity)
+      {
+      TR::PersistentAllocator &allocator = TR::Compiler->persistentGlobalAllocator();
+      char *newBuffer = static_cast<char *>(allocator.allocate(requiredSize));
+      if (!newBuffer)
+         throw std::bad_alloc();
+      if (_compressionBuffer)
+         allocator.deallocate(_compressionBuffer);
+      _compressionBuffer = newBuffer;
+      _compressionBufferCapacity = requiredSize;
+      }
+   }
+
+bool
+CommunicationStream::writeCompressedMessage(const char *serialMsg, uint32_t serializedSize)
+   {
+   if (!_deflateStream)
+      {
+      z_stream *stream = static_cast<z_stream *>(TR::Compiler->persistentGlobalAllocator().allocate(sizeof(z_stream)));
+      if (!stream)
+         throw std::bad_alloc();
+      memset(stream, 0, sizeof(z_stream));
+      // Favor speed over compression ratio; the goal is to reduce network traffic without adding much latency
+      if (deflateInit(stream, Z_BEST_SPEED) != Z_OK)
+         {
+         TR::Compiler->persistentGlobalAllocator().deallocate(stream);
+         _compressionEnabled = false;
+         return false;
+         }
+      _deflateStream = stream;
+      }
+   else
+      {
+      deflateReset(_deflateStream);
+      }
+
+   // Only use the compressed frame if it is smaller than the original message
+   uint32_t maxFrameSize = serializedSize - 1;
+   ensureCompressionBufferCapacity(maxFrameSize);
+
+   _deflateStream->next_in = (Bytef *)serialMsg;
+   _deflateStream->avail_in = serializedSize;
+   _deflateStream->next_out = (Bytef *)(_compressionBuffer + COMPRESSED_FRAME_HEADER_SIZE);
+   _deflateStream->avail_out = maxFrameSize - COMPRESSED_FRAME_HEADER_SIZE;
+   if (deflate(_deflateStream, Z_FINISH) != Z_STREAM_END)
+      return false; // Ran out of output space, i.e. the message is not compressible enough
+
+   uint32_t frameSize = COMPRESSED_FRAME_HEADER_SIZE + (uint32_t)_deflateStream->total_out;
+   ((uint32_t *)_compressionBuffer)[0] = frameSize | COMPRESSED_MESSAGE_FLAG;
+   ((uint32_t *)_compressionBuffer)[1] = serializedSize;
+   writeBlocking(_compressionBuffer, frameSize);
+   return true;
+   }
+
+void
+CommunicationStream::readCompressedMessage(Message &msg, uint32_t frameSize, const char *frameStart, uint32_t numBytesRead)
+   {
+   if ((frameSize <= COMPRESSED_FRAME_HEADER_SIZE) || (numBytesRead > frameSize))
+      throw JITServer::StreamFailure("JITServer I/O error: invalid compressed message size");
+
+   ensureCompressionBufferCapacity(frameSize);
+   memcpy(_compressionBuffer, frameStart, numBytesRead);
+   if (numBytesRead < frameSize)
+      readBlocking(_compressionBuffer + numBytesRead, frameSize - numBytesRead);
+
+   uint32_t serializedSize = ((uint32_t *)_compressionBuffer)[1];
+   if (serializedSize < sizeof(uint32_t) + sizeof(Message::MetaData))
+      throw JITServer::StreamFailure("JITServer I/O error: invalid uncompressed message size");
+
+   if (!_inflateStream)
+      {
+      z_stream *stream = static_cast<z_stream *>(TR::Compiler->persistentGlobalAllocator().allocate(sizeof(z_stream)));
+      if (!stream)
+         throw std::bad_alloc();
+      memset(stream, 0, sizeof(z_stream));
+      if (inflateInit(stream) != Z_OK)
+         {
+         TR::Compiler->persistentGlobalAllocator().deallocate(stream);
+         throw JITServer::StreamFailure("JITServer I/O error: failed to initialize decompression");
+         }
+      _inflateStream = stream;
+      }
+   else
+      {
+      inflateReset(_inflateStream);
+      }
+
+   msg.expandBufferIfNeeded(serializedSize);
+   char *buffer = msg.getBufferStartForRead();
+
+   _inflateStream->next_in = (Bytef *)(_compressionBuffer + COMPRESSED_FRAME_HEADER_SIZE);
+   _inflateStream->avail_in = frameSize - COMPRESSED_FRAME_HEADER_SIZE;
+   _inflateStream->next_out = (Bytef *)buffer;
+   _inflateStream->avail_out = serializedSize;
+   if ((inflate(_inflateStream, Z_FINISH) != Z_STREAM_END) ||
+       (_inflateStream->total_out != serializedSize) || (((uint32_t *)buffer)[0] != serializedSize))
+      throw JITServer::StreamFailure("JITServer I/O error: failed to decompress message");
+
+   msg.setSerializedSize(serializedSize);
+
+   // rebuild the message
+   msg.deserialize();
+
+#ifdef MESSAGE_SIZE_STATS
+   collectMsgStat[int(msg.type())].update(serializedSize);
+#endif
+   }
+
+void
+CommunicationStream::freeCompressionState()
+   {
+   TR::PersistentAllocator &allocator = TR::Compiler->persistentGlobalAllocator();
+   if (_deflateStream)
+      {
+      deflateEnd(_deflateStream);
+      allocator.deallocate(_deflateStream);
+      _deflateStream = NULL;
+      }
+   if (_inflateStream)
+      {
+      inflateEnd(_inflateStream);
+      allocator.deallocate(_inflateStream);
+      _inflateStream = NULL;
+      }
+   if (_compressionBuffer)
+      {
+      allocator.deallocate(_compressionBuffer);
+      _compressionBuffer = NULL;
+      _compressionBufferCapacity = 0;
+      }
+   }
 }
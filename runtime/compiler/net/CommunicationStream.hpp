@@ -23,12 +23,17 @@
 #ifndef COMMUNICATION_STREAM_H
 #define COMMUNICATION_STREAM_H
 
+#include <algorithm>
+#include <limits.h>
 #include <unistd.h>
+#include <sys/uio.h>
 #include "net/LoadSSLLibs.hpp"
 #include "net/Message.hpp"
 #include "infra/Statistics.hpp"
 #include "env/VerboseLog.hpp"
 
+struct z_stream_s; // defined in zlib.h
+
 namespace JITServer
 {
 enum JITServerCompatibilityFlags
@@ -37,11 +42,21 @@ enum JITServerCompatibilityFlags
    JITServerCompressedRef      = 0x00001000,
    };
 
+// Flags that the client sends together with the compatibility flags in the first message
+// on a connection. They are not checked for compatibility; instead they request optional
+// features that the server can choose to enable for this connection.
+enum JITServerConnectionFlags
+   {
+   JITServerCompressMessages   = 0x00010000,
+   JITServerConnectionFlagsMask = 0xFFFF0000,
+   };
+
 class CommunicationStream
    {
 public:
    static bool useSSL();
    static void initSSL();
+   static bool useCompression();
 
 #ifdef MESSAGE_SIZE_STATS
    static TR_Stats collectMsgStat[JITServer::MessageType_MAXTYPE];
@@ -66,7 +81,10 @@ public:
       }
 
 protected:
-   CommunicationStream() : _ssl(NULL), _connfd(-1) { }
+   CommunicationStream() :
+      _ssl(NULL), _connfd(-1), _compressionEnabled(false),
+      _deflateStream(NULL), _inflateStream(NULL), _compressionBuffer(NULL), _compressionBufferCapacity(0)
+      { }
 
    virtual ~CommunicationStream()
       {
@@ -75,12 +93,18 @@ protected:
 
       if (_ssl)
          (*OBIO_free_all)(_ssl);
+
+      freeCompressionState();
       }
 
    void initStream(int connfd, BIO *ssl)
       {
       _connfd = connfd;
       _ssl = ssl;
+      // Large payloads can be sent without copying them into the message buffer
+      // only if we can write directly to the socket
+      _sMsg.setUseExternalData(!_ssl && !_compressionEnabled);
+      _cMsg.setUseExternalData(!_ssl && !_compressionEnabled);
       }
 
    // Build a message sent by a remote party by reading from the socket
@@ -93,17 +117,54 @@ protected:
 
    int getConnFD() const { return _connfd; }
 
+   // Once compression is enabled, messages larger than COMPRESSION_THRESHOLD are sent compressed.
+   // Compressed messages can always be received, regardless of whether compression is enabled.
+   void enableCompression()
+      {
+      _compressionEnabled = true;
+      // Compression requires the whole message to be contiguous in the message buffer
+      _sMsg.setUseExternalData(false);
+      _cMsg.setUseExternalData(false);
+      }
+   bool isCompressionEnabled() const { return _compressionEnabled; }
+
    BIO *_ssl; // SSL connection, null if not using SSL
    int _connfd;
    ServerMessage _sMsg;
    ClientMessage _cMsg;
 
    static const uint8_t MAJOR_NUMBER = 1;
-   static const uint16_t MINOR_NUMBER = 24;
+   static const uint16_t MINOR_NUMBER = 26;
    static const uint8_t PATCH_NUMBER = 0;
    static uint32_t CONFIGURATION_FLAGS;
 
 private:
+   // Messages smaller than this are not worth compressing
+   static const uint32_t COMPRESSION_THRESHOLD = 4096;
+   // Set in the size field of a compressed message frame, which has the following layout:
+   // uint32_t frameSize | COMPRESSED_MESSAGE_FLAG, uint32_t uncompressedSize, compressed serialized message
+   static const uint32_t COMPRESSED_MESSAGE_FLAG = 0x80000000;
+   static const uint32_t COMPRESSED_FRAME_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+   // Write the serialized message as a compressed frame. Returns false (without writing anything)
+   // if compression failed or did not reduce the message size.
+   bool writeCompressedMessage(const char *serialMsg, uint32_t serializedSize);
+   // Read the rest of a compressed frame (the first numBytesRead bytes of which have already been read
+   // into frameStart), decompress it into the message buffer and rebuild the message
+   void readCompressedMessage(Message &msg, uint32_t frameSize, const char *frameStart, uint32_t numBytesRead);
+   // Write a message that contains references to external data, gathering
+   // the parts of the message from the buffer and external locations
+   void writeMessageGather(const Message &msg);
+   void ensureCompressionBufferCapacity(uint32_t requiredSize);
+   void freeCompressionState();
+
+   bool _compressionEnabled;
+   z_stream_s *_deflateStream; // allocated on first use
+   z_stream_s *_inflateStream; // allocated on first use
+   char *_compressionBuffer; // holds compressed frames being sent or received
+   uint32_t _compressionBufferCapacity;
+   std::vector<struct iovec> _iovecs; // used by writeMessageGather()
+
    // readBlocking and writeBlocking are functions that directly read/write
    // passed object from/to the socket. For the object to be correctly written,
    // it needs to be contiguous.
@@ -175,6 +236,31 @@ private:
       writeBlocking(&val, sizeof(T));
       }
 
+   void writevBlocking(struct iovec *iov, size_t iovcnt)
+      {
+      TR_ASSERT(!_ssl, "Gather writes are not supported with SSL");
+      size_t idx = 0;
+      while (idx < iovcnt)
+         {
+         ssize_t bytesWritten = writev(_connfd, iov + idx, std::min(iovcnt - idx, (size_t)IOV_MAX));
+         if (bytesWritten <= 0)
+            {
+            throw JITServer::StreamFailure("JITServer I/O error: write error");
+            }
+         // Skip the segments that were written completely, and adjust the first incomplete one
+         while ((idx < iovcnt) && (bytesWritten >= (ssize_t)iov[idx].iov_len))
+            {
+            bytesWritten -= iov[idx].iov_len;
+            ++idx;
+            }
+         if (bytesWritten > 0)
+            {
+            iov[idx].iov_base = (char *)iov[idx].iov_base + bytesWritten;
+            iov[idx].iov_len -= bytesWritten;
+            }
+         }
+      }
+
    void writeBlocking(const char* data, size_t size)
       {
       if (_ssl)
@@ -61,8 +61,12 @@ Message::addData(const DataDescriptor &desc, const void *dataStart, bool needs64
       serializedDescriptor->addInitialPadding(initialPadding);
       }
 
-   // Write the real data and possibly some padding at the end
-   _buffer.writeData(dataStart, desc.getPayloadSize(), desc.getPaddingSize()); 
+   // Write the real data and possibly some padding at the end.
+   // Large payloads (e.g. ROMClasses) are not copied; they are sent directly from their original location.
+   if (_useExternalData && (desc.getPayloadSize() >= EXTERNAL_DATA_THRESHOLD))
+      _buffer.writeExternalData(dataStart, desc.getPayloadSize(), desc.getPaddingSize());
+   else
+      _buffer.writeData(dataStart, desc.getPayloadSize(), desc.getPaddingSize());
    _descriptorOffsets.push_back(descOffset);
    return desc.getTotalSize() + initialPadding;
    }
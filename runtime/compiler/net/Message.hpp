@@ -209,7 +209,7 @@ public:
       uint32_t _size; // Size of the data segment, which can include nested data
       }; // struct DataDescriptor
 
-   Message()
+   Message() : _useExternalData(false)
       {
       // Reserve space for encoding the size and MetaData.
       // These will be populated at a later time
@@ -303,14 +303,29 @@ public:
    */
    char *serialize()
       {
-      *_buffer.getValueAtOffset<uint32_t>(0) = _buffer.size();
+      *_buffer.getValueAtOffset<uint32_t>(0) = _buffer.totalSize();
       return _buffer.getBufferStart();
       }
 
    /**
-      @brief Return the size of the serialized message.
+      @brief Return the size of the serialized message, including any external data.
    */
-   uint32_t serializedSize() { return _buffer.size(); }
+   uint32_t serializedSize() { return _buffer.totalSize(); }
+
+   /**
+      @brief Allow large payloads added to this message to be referenced instead of copied.
+
+      A message with external data is not contiguous in the MessageBuffer; it must be sent
+      with a gather write. This is only possible when the connection does not use SSL.
+   */
+   void setUseExternalData(bool use) { _useExternalData = use; }
+
+   /**
+      @brief Tells whether the serialized message contains references to external data
+   */
+   bool hasExternalData() const { return !_buffer.getExternalData().empty(); }
+
+   const std::vector<MessageBuffer::ExternalData> &getExternalData() const { return _buffer.getExternalData(); }
 
    /**
       @brief Rebuild the message from the MessageBuffer
@@ -360,6 +375,19 @@ public:
    */
    char *getBufferStartForRead() { return _buffer.getBufferStart(); }
 
+   /**
+      @brief Get the pointer to the start of the buffer of an outgoing message.
+
+      Together with getBufferSize() and getExternalData(), this describes
+      the parts of a serialized message that contains external data.
+   */
+   char *getBufferStart() const { return _buffer.getBufferStart(); }
+
+   /**
+      @brief Get the number of bytes in the buffer, excluding external data.
+   */
+   uint32_t getBufferSize() const { return _buffer.size(); }
+
    void clearForRead()
       {
       _descriptorOffsets.clear();
@@ -376,8 +404,12 @@ public:
 
    void print();
 protected:
+   // Payloads at least this large are referenced instead of copied when _useExternalData is set
+   static const uint32_t EXTERNAL_DATA_THRESHOLD = 32768;
+
    std::vector<uint32_t> _descriptorOffsets;
    MessageBuffer _buffer; // Buffer used for send/receive operations
+   bool _useExternalData;
    };
 
 
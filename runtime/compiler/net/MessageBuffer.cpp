@@ -27,6 +27,7 @@ namespace JITServer
 {
 MessageBuffer::MessageBuffer() :
    _capacity(INITIAL_BUFFER_SIZE),
+   _externalSize(0),
    _allocator(TR::Compiler->persistentGlobalAllocator())
    {
    _storage = allocateMemory(_capacity);
@@ -87,13 +88,23 @@ MessageBuffer::writeData(const void *dataStart, uint32_t dataSize, uint8_t paddi
    _curPtr += dataSize + paddingSize;
    return offset(data);
    }
- 
+
+void
+MessageBuffer::writeExternalData(const void *dataStart, uint32_t dataSize, uint8_t paddingSize)
+   {
+   // The padding follows the external data in the message, so it is written into the buffer
+   expandIfNeeded(size() + paddingSize);
+   _externalData.push_back({ size(), dataStart, dataSize });
+   _externalSize += dataSize;
+   _curPtr += paddingSize;
+   }
+
 uint8_t
 MessageBuffer::alignCurrentPositionOn64Bit()
    {
-   // Compute the amount of padding required to align _curPtr on 64-bit boundary
-   uintptr_t alignedPtr = ((uintptr_t)_curPtr + 0x7) & (~((uintptr_t)0x7));
-   uint8_t padding = (uint8_t)(alignedPtr - (uintptr_t)_curPtr); // Guaranteed to fit on a byte
+   // Compute the amount of padding required to align the current position on 64-bit boundary
+   uint32_t position = totalSize();
+   uint8_t padding = (uint8_t)(OMR::alignNoCheck(position, sizeof(uint64_t)) - position); // Guaranteed to fit on a byte
 
    // Expand the buffer if it's too small to contain the padding
    uint32_t requiredSize = size() + padding;
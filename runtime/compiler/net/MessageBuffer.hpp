@@ -23,6 +23,7 @@
 #ifndef MESSAGE_BUFFER_H
 #define MESSAGE_BUFFER_H
 
+#include <vector>
 #include "env/jittypes.h"
 #include "env/TRMemory.hpp"
 #include "OMR/Bytes.hpp" // for alignNoCheck
@@ -45,6 +46,10 @@ namespace JITServer
 
    Variable _curPtr defines the boundary of the current data. Reading/writing to/from buffer
    will always advance the pointer.
+
+   To avoid copying large payloads into an outgoing message, the buffer can also hold references
+   to external data (see writeExternalData). Such data logically belongs to the message at the point
+   where it was written, but it is only gathered from its original location when the message is sent.
  */
 class MessageBuffer
    {
@@ -68,6 +73,13 @@ public:
    */
    uint32_t size() const { return _curPtr - _storage; }
 
+   /**
+      @brief Get the size of the message data, including any external data.
+
+      This is the number of bytes that will be sent over the network.
+   */
+   uint32_t totalSize() const { return size() + _externalSize; }
+
    char *getBufferStart() const { return _storage; }
 
    /**
@@ -119,6 +131,31 @@ public:
    */
    uint32_t writeData(const void *dataStart, uint32_t dataSize, uint8_t paddingSize);
 
+   /**
+      @brief Write a reference to external data into the buffer.
+
+      Logically equivalent to writeData, but instead of copying dataSize bytes from dataStart,
+      records their location so that they can be sent directly from there. Only the padding
+      is written into the buffer. The external data must stay valid until the message is sent.
+
+      @param dataStart pointer to the beginning of the data to be referenced
+      @param dataSize number of bytes of real data to be referenced
+      @param paddingSize number of bytes of padding
+   */
+   void writeExternalData(const void *dataStart, uint32_t dataSize, uint8_t paddingSize);
+
+   /**
+      @brief A reference to external data, located in the message right before the given buffer offset
+   */
+   struct ExternalData
+      {
+      uint32_t _offset;
+      const void *_dataStart;
+      uint32_t _dataSize;
+      };
+
+   const std::vector<ExternalData> &getExternalData() const { return _externalData; }
+
    /**
       @brief Reserve memory for a value of type T.
 
@@ -166,12 +203,19 @@ public:
       return offset(data); // Return offset before the advance
       }
 
-   void clear() { _curPtr = _storage; }
+   void clear()
+      {
+      _curPtr = _storage;
+      _externalData.clear();
+      _externalSize = 0;
+      }
 
    /**
-      @brief Check to see if the current pointer in the MessageBuffer is 64-bit aligned.
+      @brief Check to see if the current position in the message is 64-bit aligned.
+
+      External data is taken into account, since it will be located inline in the received message.
    */
-   bool is64BitAligned() { return ((uintptr_t)_curPtr & ((uintptr_t)0x7)) == 0; }
+   bool is64BitAligned() { return (totalSize() & 0x7) == 0; }
 
    /**
       @brief Moves the current pointer in the MessageBuffer to achieve 64-bit alignment
@@ -210,6 +254,8 @@ private:
    uint32_t _capacity;
    char *_storage;
    char *_curPtr;
+   std::vector<ExternalData> _externalData;
+   uint32_t _externalSize; // total size of external data
    TR::PersistentAllocator &_allocator;
    };
 };
@@ -89,6 +89,7 @@ enum MessageType : uint16_t
    ResolvedMethod_definingClassFromCPFieldRef,
    ResolvedMethod_getResolvedImplementorMethods,
    ResolvedMethod_isFieldFlattened,
+   ResolvedMethod_getMultipleClassesFromConstantPool,
 
    ResolvedRelocatableMethod_createResolvedRelocatableJ9Method,
    ResolvedRelocatableMethod_fieldAttributes,
@@ -335,6 +336,7 @@ static const char *messageNames[] =
    "ResolvedMethod_definingClassFromCPFieldRef",
    "ResolvedMethod_getResolvedImplementorMethods",
    "ResolvedMethod_isFieldFlattened",
+   "ResolvedMethod_getMultipleClassesFromConstantPool",
    "ResolvedRelocatableMethod_createResolvedRelocatableJ9Method",
    "ResolvedRelocatableMethod_fieldAttributes",
    "ResolvedRelocatableMethod_staticAttributes",
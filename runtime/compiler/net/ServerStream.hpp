@@ -99,6 +99,7 @@ public:
          }
 
       _sMsg.setType(type);
+      _sMsg.getMetaData()->_config = isCompressionEnabled() ? JITServerCompressMessages : 0;
       setArgsRaw<Args...>(_sMsg, args...);
       writeMessage(_sMsg);
       }
@@ -157,9 +158,22 @@ public:
    std::tuple<T...> readCompileRequest()
       {
       readMessage(_cMsg);
-      if (_cMsg.fullVersion() != 0 && _cMsg.fullVersion() != getJITServerFullVersion())
+      if (_cMsg.fullVersion() != 0)
          {
-         throw StreamVersionIncompatible(getJITServerFullVersion(), _cMsg.fullVersion());
+         // Connection flags are not part of the compatibility check
+         uint32_t clientConfig = _cMsg.getMetaData()->_config;
+         uint64_t clientFullVersion = Message::buildFullVersion(_cMsg.getMetaData()->_version,
+                                                                clientConfig & ~JITServerConnectionFlagsMask);
+         if (clientFullVersion != getJITServerFullVersion())
+            throw StreamVersionIncompatible(getJITServerFullVersion(), clientFullVersion);
+
+         if ((clientConfig & JITServerCompressMessages) && useCompression() && !isCompressionEnabled())
+            {
+            enableCompression();
+            if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+               TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "compThreadID=%d enabled message compression",
+                  TR::compInfoPT->getCompThreadId());
+            }
          }
 
       switch (_cMsg.type())
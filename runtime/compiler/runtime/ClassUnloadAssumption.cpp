@@ -1266,7 +1266,7 @@ J9::PersistentInfo::isUnloadedClass(
    if (getRemoteCompilationMode() == JITServer::SERVER)
       {
       auto clientData = TR::compInfoPT->getClientData();
-      OMR::CriticalSection isUnloadedClass(clientData->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection isUnloadedClass(clientData);
       return clientData->getUnloadedClassAddresses().mayContain((uintptr_t)v);
       } 
 #endif
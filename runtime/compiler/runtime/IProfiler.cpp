@@ -31,6 +31,7 @@
 #include <algorithm>
 #include <stdlib.h>
 #include <string.h>
+#include "AtomicSupport.hpp"
 #include "bcnames.h"
 #include "jilconsts.h"
 #include "j9cp.h"
@@ -106,7 +107,8 @@ extern "C" int32_t getCount(J9ROMMethod *romMethod, TR::Options *optionsJIT, TR:
 
 
 static J9PortLibrary *staticPortLib = NULL;
-static uint32_t memoryConsumed = 0;
+static volatile uintptr_t memoryConsumed = 0;
+static volatile uintptr_t bcHashTableMemoryConsumed = 0; // bucket array and blocks of the bytecode hashtable; included in memoryConsumed
 
 
 
@@ -549,13 +551,19 @@ TR_IProfiler::persistIprofileInfo(TR::ResolvedMethodSymbol *resolvedMethodSymbol
 uint32_t
 TR_IProfiler::getProfilerMemoryFootprint()
    {
-   return memoryConsumed;
+   return (uint32_t)memoryConsumed;
+   }
+
+uint32_t
+TR_IProfiler::getBCHashTableMemoryFootprint()
+   {
+   return (uint32_t)bcHashTableMemoryConsumed;
    }
 
 void *
 TR_IProfiler::operator new (size_t size) throw()
    {
-   memoryConsumed += (int32_t)size;
+   VM_AtomicSupport::add(&memoryConsumed, size);
    void *alloc = jitPersistentAlloc(size);
    return alloc;
    }
@@ -573,7 +581,9 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
      _globalAllocationCount (0), _maxCallFrequency(0), _iprofilerThread(0), _iprofilerOSThread(NULL),
      _workingBufferTail(NULL), _numOutstandingBuffers(0), _numRequests(1), _numRequestsSkipped(0),
      _numRequestsHandedToIProfilerThread(0), _iprofilerThreadExitFlag(0), _iprofilerMonitor(NULL),
-     _crtProfilingBuffer(NULL), _iprofilerThreadAttachAttempted(false), _iprofilerNumRecords(0)
+     _crtProfilingBuffer(NULL), _workers(NULL), _numWorkers(0), _numActiveWorkers(0), _stopWorkers(false),
+     _numBuffersProcessed(0), _numBuffersInvalidated(0),
+     _iprofilerThreadAttachAttempted(false), _iprofilerNumRecords(0)
    {
    PORT_ACCESS_FROM_JITCONFIG(jitConfig);
 
@@ -592,9 +602,13 @@ TR_IProfiler::TR_IProfiler(J9JITConfig *jitConfig)
    _hashTableMonitor = TR::Monitor::create("JIT-InterpreterProfilingMonitor");
 
    // bytecode hashtable
-   _bcHashTable = (TR_IPBytecodeHashTableEntry**)jitPersistentAlloc(BC_HASH_TABLE_SIZE*sizeof(TR_IPBytecodeHashTableEntry*));
+   _bcHashTable = (TR_IPBCHashTableBlock * volatile *)jitPersistentAlloc(BC_HASH_TABLE_SIZE*sizeof(TR_IPBCHashTableBlock*));
    if (_bcHashTable != NULL)
-      memset(_bcHashTable, 0, BC_HASH_TABLE_SIZE*sizeof(TR_IPBytecodeHashTableEntry*));
+      {
+      memset((void *)_bcHashTable, 0, BC_HASH_TABLE_SIZE*sizeof(TR_IPBCHashTableBlock*));
+      VM_AtomicSupport::add(&bcHashTableMemoryConsumed, BC_HASH_TABLE_SIZE*sizeof(TR_IPBCHashTableBlock*));
+      VM_AtomicSupport::add(&memoryConsumed, BC_HASH_TABLE_SIZE*sizeof(TR_IPBCHashTableBlock*));
+      }
    else
       _isIProfilingEnabled = false;
 
@@ -1017,20 +1031,36 @@ TR_IProfiler::addSampleData(TR_IPBytecodeHashTableEntry *entry, uintptr_t data,
    return false;
    }
 
+// Slots in a bucket are always claimed in order (the first free slot of the last block),
+// so the first free slot marks the end of the bucket
 TR_IPBytecodeHashTableEntry *
 TR_IProfiler::searchForSample(uintptr_t pc, int32_t bucket)
    {
-   TR_IPBytecodeHashTableEntry *entry;
-
-   for (entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
+   for (TR_IPBCHashTableBlock *block = _bcHashTable[bucket]; block; block = block->_next)
       {
-      if (pc == entry->getPC())
-         return entry;
+      for (int32_t i = 0; i < TR_IPBCHashTableBlock::NUM_SLOTS; i++)
+         {
+         uintptr_t slotPC = block->_pcs[i];
+         if (slotPC == pc)
+            return block->_entries[i]; // NULL if another thread has not yet published the entry
+         if (slotPC == 0)
+            return NULL;
+         }
       }
 
    return NULL;
    }
 
+template<typename F> void
+TR_IProfiler::forEachBCEntry(F f)
+   {
+   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
+      for (TR_IPBCHashTableBlock *block = _bcHashTable[bucket]; block; block = block->_next)
+         for (int32_t i = 0; i < TR_IPBCHashTableBlock::NUM_SLOTS; i++)
+            if (TR_IPBytecodeHashTableEntry *entry = block->_entries[i])
+               f(entry, bucket);
+   }
+
 TR_IPBCDataAllocation *
 TR_IProfiler::searchForAllocSample(uintptr_t pc, int32_t bucket)
    {
@@ -1063,26 +1093,75 @@ TR_IProfiler::findOrCreateEntry(int32_t bucket, uintptr_t pc, bool addIt)
    if (entry)
       return entry;
 
-   // Create a new hash table entry
-   U_8 byteCode = *(U_8*) pc;
-   if (isCompact(byteCode))
-      entry = new TR_IPBCDataFourBytes(pc);
-   else
+   TR_IPBCHashTableBlock * volatile *blockPtr = &_bcHashTable[bucket];
+   while (true)
       {
-      if (isSwitch(byteCode))
-         entry = new TR_IPBCDataEightWords(pc);
-      else
-         entry = new TR_IPBCDataCallGraph(pc);
-      }
+      TR_IPBCHashTableBlock *block = *blockPtr;
+      if (!block)
+         {
+         void *alloc = jitPersistentAlloc(sizeof(TR_IPBCHashTableBlock));
+         if (!alloc)
+            return NULL;
+         TR_IPBCHashTableBlock *newBlock = new (alloc) TR_IPBCHashTableBlock();
+         VM_AtomicSupport::writeBarrier();
+         if ((uintptr_t)NULL == VM_AtomicSupport::lockCompareExchange((volatile uintptr_t *)blockPtr,
+                                                                      (uintptr_t)NULL, (uintptr_t)newBlock))
+            {
+            VM_AtomicSupport::add(&bcHashTableMemoryConsumed, sizeof(TR_IPBCHashTableBlock));
+            VM_AtomicSupport::add(&memoryConsumed, sizeof(TR_IPBCHashTableBlock));
+            block = newBlock;
+            }
+         else
+            {
+            // Another thread appended a block first
+            jitPersistentFree(newBlock);
+            block = *blockPtr;
+            }
+         }
 
-   if (!entry)
-      return NULL;
+      for (int32_t i = 0; i < TR_IPBCHashTableBlock::NUM_SLOTS; i++)
+         {
+         uintptr_t slotPC = block->_pcs[i];
+         if (slotPC == 0)
+            {
+            slotPC = VM_AtomicSupport::lockCompareExchange(&block->_pcs[i], 0, pc);
+            if (slotPC == 0)
+               {
+               // The entry is only created once the slot is claimed, so that no thread allocates an
+               // entry it cannot use. If the allocation fails, the slot stays without an entry and
+               // samples for this PC are dropped, as they are while the entry is being created.
+               TR_IPBytecodeHashTableEntry *newEntry = createEntry(pc);
+               if (newEntry)
+                  {
+                  // The entry must be fully initialized before other threads can see it
+                  VM_AtomicSupport::writeBarrier();
+                  block->_entries[i] = newEntry;
+                  }
+               return newEntry;
+               }
+            }
 
-   entry->setNext(_bcHashTable[bucket]);
-   FLUSH_MEMORY(TR::Compiler->target.isSMP());
-   _bcHashTable[bucket] = entry;
+         if (slotPC == pc)
+            {
+            // Another thread claimed the slot for the same PC; use its entry if it is already published
+            return block->_entries[i];
+            }
+         }
 
-   return entry;
+      blockPtr = &block->_next;
+      }
+   }
+
+TR_IPBytecodeHashTableEntry *
+TR_IProfiler::createEntry(uintptr_t pc)
+   {
+   U_8 byteCode = *(U_8*) pc;
+   if (isCompact(byteCode))
+      return new TR_IPBCDataFourBytes(pc);
+   else if (isSwitch(byteCode))
+      return new TR_IPBCDataEightWords(pc);
+   else
+      return new TR_IPBCDataCallGraph(pc);
    }
 
 TR_IPBCDataAllocation *
@@ -1140,7 +1219,7 @@ TR_IProfiler::findOrCreateMethodEntry(J9Method *callerMethod, J9Method *calleeMe
       }
    else // create a new hash table entry
       {
-      memoryConsumed += (int32_t)sizeof(TR_IPMethodHashTableEntry);
+      VM_AtomicSupport::add(&memoryConsumed, sizeof(TR_IPMethodHashTableEntry));
       entry = (TR_IPMethodHashTableEntry *)jitPersistentAlloc(sizeof(TR_IPMethodHashTableEntry));
       if (entry)
          {
@@ -1313,7 +1392,8 @@ TR_IProfiler::persistentProfilingSample(TR_OpaqueMethodBlock *method, uint32_t b
             {
             // Create a new IProfiler hashtable entry and copy the data from the SCC
             TR_IPBytecodeHashTableEntry *newEntry = findOrCreateEntry(bcHash(pc), pc, true);
-            newEntry->loadFromPersistentCopy(store, comp);
+            if (newEntry)
+               newEntry->loadFromPersistentCopy(store, comp);
             return newEntry;
             }
          }
@@ -1532,9 +1612,12 @@ TR_IProfiler::profilingSample (TR_OpaqueMethodBlock *method, uint32_t byteCodeIn
                {
                _STATS_IPEntryChoosePersistent++;
                currentEntry = findOrCreateEntry(bcHash(pc), pc, true);
-               currentEntry->copyFromEntry(persistentEntry, comp);
-               // Remember that we already looked into the SCC for this PC
-               currentEntry->setPersistentEntryRead();
+               if (currentEntry)
+                  {
+                  currentEntry->copyFromEntry(persistentEntry, comp);
+                  // Remember that we already looked into the SCC for this PC
+                  currentEntry->setPersistentEntryRead();
+                  }
                return currentEntry;
                }
             }
@@ -2561,9 +2644,13 @@ TR_IProfiler::outputStats()
       fprintf(stderr, "IProfiler: Number of buffers to be processed           =%" OMR_PRIu64 "\n", _numRequests);
       fprintf(stderr, "IProfiler: Number of buffers discarded                 =%" OMR_PRIu64 "\n", _numRequestsSkipped);
       fprintf(stderr, "IProfiler: Number of buffers handed to iprofiler thread=%" OMR_PRIu64 "\n", _numRequestsHandedToIProfilerThread);
+      fprintf(stderr, "IProfiler: Number of buffers processed by %2d threads   =%" OMR_PRIu64 "\n", _numWorkers + 1, _numBuffersProcessed);
+      fprintf(stderr, "IProfiler: Number of buffers dropped at class unloading=%" OMR_PRIu64 "\n", _numBuffersInvalidated);
       }
    fprintf(stderr, "IProfiler: Number of records processed=%" OMR_PRIu64 "\n", _iprofilerNumRecords);
    fprintf(stderr, "IProfiler: Number of hashtable entries=%u\n", countEntries());
+   fprintf(stderr, "IProfiler: Memory footprint=%u KB (bytecode hashtable=%u KB)\n",
+           getProfilerMemoryFootprint() >> 10, getBCHashTableMemoryFootprint() >> 10);
    checkMethodHashTable();
    }
 
@@ -2572,12 +2659,12 @@ TR_IPBytecodeHashTableEntry::alignedPersistentAlloc(size_t size)
    {
 #if defined(TR_HOST_64BIT)
    size += 4;
-   memoryConsumed += (int32_t)size;
+   VM_AtomicSupport::add(&memoryConsumed, size);
    void *address = (void *) jitPersistentAlloc(size);
 
    return (void *)(((uintptr_t)address + 4) & ~0x7);
 #else
-   memoryConsumed += (int32_t)size;
+   VM_AtomicSupport::add(&memoryConsumed, size);
    return jitPersistentAlloc(size);
 #endif
    }
@@ -3378,17 +3465,14 @@ uint32_t
 TR_IProfiler::releaseAllEntries()
    {
    uint32_t count = 0;
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
+   forEachBCEntry([&](TR_IPBytecodeHashTableEntry *entry, int32_t bucket)
       {
-      for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
+      if (entry->asIPBCDataCallGraph() && entry->asIPBCDataCallGraph()->isLocked())
          {
-         if (entry->asIPBCDataCallGraph() && entry->asIPBCDataCallGraph()->isLocked())
-            {
-            count++;
-            entry->asIPBCDataCallGraph()->releaseEntry();
-            }
+         count++;
+         entry->asIPBCDataCallGraph()->releaseEntry();
          }
-      }
+      });
    return count;
    }
 
@@ -3396,9 +3480,7 @@ uint32_t
 TR_IProfiler::countEntries()
    {
    uint32_t count = 0;
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
-      for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
-         count++;
+   forEachBCEntry([&](TR_IPBytecodeHashTableEntry *entry, int32_t bucket) { count++; });
    return count;
    }
 
@@ -3407,37 +3489,28 @@ TR_IProfiler::countEntries()
 //
 void TR_IProfiler::setupEntriesInHashTable(TR_IProfiler *ip)
    {
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
+   forEachBCEntry([&](TR_IPBytecodeHashTableEntry *entry, int32_t bucket)
       {
-      TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket], *prevEntry = NULL;
+      uintptr_t pc = entry->getPC();
 
-      while (entry)
+      if (pc == 0 ||
+            pc == 0xffffffff)
          {
-         uintptr_t pc = entry->getPC();
-
-         if (pc == 0 ||
-               pc == 0xffffffff)
-            {
-            printf("invalid pc for entry %p %#" OMR_PRIxPTR "\n", entry, pc);
-            fflush(stdout);
-            prevEntry = entry;
-            entry = entry->getNext();
-            continue;
-            }
+         printf("invalid pc for entry %p %#" OMR_PRIxPTR "\n", entry, pc);
+         fflush(stdout);
+         return;
+         }
 
 
-         TR_IPBytecodeHashTableEntry *newEntry = ip->findOrCreateEntry(bucket, pc, true);
-         // check for entries corresponding to
-         // unloaded methods, findOrCreateEntry will
-         // return NULL above. its ok to ignore these entries
-         // as they are invalid anyway
-         //
-         if (newEntry)
-            ip->copyDataFromEntry(entry, newEntry, NULL);
-         prevEntry = entry;
-         entry = entry->getNext();
-         }
-      }
+      TR_IPBytecodeHashTableEntry *newEntry = ip->findOrCreateEntry(bucket, pc, true);
+      // check for entries corresponding to
+      // unloaded methods, findOrCreateEntry will
+      // return NULL above. its ok to ignore these entries
+      // as they are invalid anyway
+      //
+      if (newEntry)
+         ip->copyDataFromEntry(entry, newEntry, NULL);
+      });
    printf("Finished adding entries from core to new iprofiler\n");
    }
 
@@ -3687,6 +3760,62 @@ static int32_t J9THREAD_PROC iprofilerThreadProc(void * entryarg)
    return 0;
    }
 
+static int32_t J9THREAD_PROC iprofilerWorkerThreadProc(void * entryarg)
+   {
+   TR_IProfilerWorker *worker = (TR_IProfilerWorker *) entryarg;
+   TR_IProfiler *iProfiler = worker->_iProfiler;
+   J9JavaVM * vm = worker->_javaVM;
+   J9VMThread *workerThread = NULL;
+   int rc = vm->internalVMFunctions->internalAttachCurrentThread(vm, &workerThread, NULL,
+                                  J9_PRIVATE_FLAGS_DAEMON_THREAD | J9_PRIVATE_FLAGS_NO_OBJECT |
+                                  J9_PRIVATE_FLAGS_SYSTEM_THREAD | J9_PRIVATE_FLAGS_ATTACHED_THREAD,
+                                  worker->_osThread);
+   iProfiler->getIProfilerMonitor()->enter();
+   iProfiler->workerThreadAttached(worker, (rc == JNI_OK) ? workerThread : NULL);
+   iProfiler->getIProfilerMonitor()->notifyAll();
+   iProfiler->getIProfilerMonitor()->exit();
+   if (rc != JNI_OK)
+      return JNI_ERR; // attaching the worker thread failed
+
+#ifdef J9VM_OPT_JAVA_OFFLOAD_SUPPORT
+   if (vm->javaOffloadSwitchOnWithReasonFunc != 0)
+      (*vm->javaOffloadSwitchOnWithReasonFunc)(workerThread, J9_JNI_OFFLOAD_SWITCH_JIT_IPROFILER_THREAD);
+#endif
+
+   j9thread_set_name(j9thread_self(), worker->_name);
+
+   iProfiler->processWorkingQueue(worker);
+
+   vm->internalVMFunctions->DetachCurrentThread((JavaVM *) vm);
+   iProfiler->getIProfilerMonitor()->enter();
+   iProfiler->workerThreadExited(worker);
+   iProfiler->getIProfilerMonitor()->notifyAll();
+   j9thread_exit((J9ThreadMonitor*)iProfiler->getIProfilerMonitor()->getVMMonitor());
+
+#ifdef J9VM_OPT_JAVA_OFFLOAD_SUPPORT
+   if (vm->javaOffloadSwitchOffNoEnvWithReasonFunc != 0)
+      (*vm->javaOffloadSwitchOffNoEnvWithReasonFunc)(vm, j9thread_self(), J9_JNI_OFFLOAD_SWITCH_JIT_IPROFILER_THREAD);
+#endif
+
+   return 0;
+   }
+
+// Must be called with the iprofilerMonitor in hand
+void TR_IProfiler::workerThreadAttached(TR_IProfilerWorker *worker, J9VMThread *vmThread)
+   {
+   worker->_attachAttempted = true;
+   worker->_vmThread = vmThread;
+   if (vmThread)
+      _numActiveWorkers++;
+   }
+
+// Must be called with the iprofilerMonitor in hand
+void TR_IProfiler::workerThreadExited(TR_IProfilerWorker *worker)
+   {
+   worker->_vmThread = NULL;
+   _numActiveWorkers--;
+   }
+
 
 void TR_IProfiler::startIProfilerThread(J9JavaVM *javaVM)
    {
@@ -3718,6 +3847,9 @@ void TR_IProfiler::startIProfilerThread(J9JavaVM *javaVM)
          while (!getAttachAttempted())
             _iprofilerMonitor->wait();
          _iprofilerMonitor->exit();
+
+         if (getIProfilerThread())
+            startIProfilerWorkerThreads(javaVM);
          }
       }
    else
@@ -3727,6 +3859,59 @@ void TR_IProfiler::startIProfilerThread(J9JavaVM *javaVM)
       }
    }
 
+void TR_IProfiler::startIProfilerWorkerThreads(J9JavaVM *javaVM)
+   {
+   PORT_ACCESS_FROM_PORT(_portLib);
+   int32_t numWorkers = TR::Options::_iprofilerNumWorkerThreads;
+   if (numWorkers <= 0)
+      return;
+
+   _workers = (TR_IProfilerWorker *)jitPersistentAlloc(numWorkers * sizeof(TR_IProfilerWorker));
+   if (!_workers)
+      return;
+   memset(_workers, 0, numWorkers * sizeof(TR_IProfilerWorker));
+
+   for (int32_t i = 0; i < numWorkers; i++)
+      {
+      TR_IProfilerWorker *worker = &_workers[i];
+      worker->_iProfiler = this;
+      worker->_javaVM = javaVM;
+      snprintf(worker->_name, sizeof(worker->_name), "JIT IProfiler Worker-%d", i + 1);
+
+      if (javaVM->internalVMFunctions->createThreadWithCategory(&worker->_osThread,
+                                      TR::Options::_profilerStackSize << 10,
+                                      J9THREAD_PRIORITY_NORMAL,
+                                      0,
+                                      &iprofilerWorkerThreadProc,
+                                      worker,
+                                      J9THREAD_CATEGORY_SYSTEM_JIT_THREAD))
+         {
+         j9tty_printf(PORTLIB, "Error: Unable to create iprofiler worker thread\n");
+         break;
+         }
+      _numWorkers++;
+
+      // Wait for the attach so that stopIProfilerWorkerThreads() knows how many workers to wait for
+      _iprofilerMonitor->enter();
+      while (!worker->_attachAttempted)
+         _iprofilerMonitor->wait();
+      _iprofilerMonitor->exit();
+      }
+   }
+
+// Must be called with the iprofilerMonitor in hand. Workers are stopped before the
+// IProfiler thread, so that only the IProfiler thread sees the special buffer that
+// tells it to exit
+void TR_IProfiler::stopIProfilerWorkerThreads()
+   {
+   _stopWorkers = true;
+   while (_numActiveWorkers > 0)
+      {
+      _iprofilerMonitor->notifyAll();
+      _iprofilerMonitor->wait();
+      }
+   }
+
 void TR_IProfiler::deallocateIProfilerBuffers()
    {
    // To be called when we are sure that no java thread will post additional
@@ -3768,6 +3953,8 @@ void TR_IProfiler::stopIProfilerThread()
       return;
       }
 
+   stopIProfilerWorkerThreads();
+
    // get a special buffer which will be used as a signal to stop iprofilerThread
    //
    IProfilerBuffer *specialProfilingBuffer = NULL;
@@ -3908,37 +4095,55 @@ bool TR_IProfiler::processProfilingBuffer(J9VMThread *vmThread, const U_8* dataS
 
 // This method is executed by the iprofiling thread
 void TR_IProfiler::processWorkingQueue()
+   {
+   processWorkingQueue(_iprofilerThread, _crtProfilingBuffer, false);
+   }
+
+// This method is executed by the iprofiling worker threads
+void TR_IProfiler::processWorkingQueue(TR_IProfilerWorker *worker)
+   {
+   processWorkingQueue(worker->_vmThread, worker->_crtProfilingBuffer, true);
+   }
+
+void TR_IProfiler::processWorkingQueue(J9VMThread *vmThread, IProfilerBuffer * volatile &crtProfilingBuffer, bool isWorker)
    {
    PORT_ACCESS_FROM_PORT(_portLib);
    // wait for something to do
    _iprofilerMonitor->enter();
    do {
-      while (_workingBufferList.isEmpty())
+      while (_workingBufferList.isEmpty() && !(isWorker && _stopWorkers))
          {
          //fprintf(stderr, "IProfiler thread will wait for data outstanding=%d\n", numOutstandingBuffers);
          _iprofilerMonitor->wait();
          }
+      if (isWorker && _stopWorkers)
+         {
+         _iprofilerMonitor->exit();
+         break;
+         }
       // We have some buffer to process
       // Dequeue the buffer to be processed
       //
-      _crtProfilingBuffer = _workingBufferList.pop();
+      crtProfilingBuffer = _workingBufferList.pop();
       if (_workingBufferList.isEmpty())
          _workingBufferTail = NULL;
 
       // We don't need the iprofiler monitor now
       _iprofilerMonitor->exit();
-      if (_crtProfilingBuffer->getSize() > 0)
+      bool processed = false;
+      if (crtProfilingBuffer->getSize() > 0)
          {
          // process the buffer after acquiring VM access
-         acquireVMAccessNoSuspend(_iprofilerThread);   // blocking. Will wait for the entire GC
+         acquireVMAccessNoSuspend(vmThread);   // blocking. Will wait for the entire GC
          // Check to see if GC has invalidated this buffer
-         if (_crtProfilingBuffer->isValid())
+         if (crtProfilingBuffer->isValid())
             {
          //fprintf(stderr, "IProfiler thread will process buffer %p of size %u\n", profilingBuffer->getBuffer(), profilingBuffer->getSize());
-            parseBuffer(_iprofilerThread, _crtProfilingBuffer->getBuffer(), _crtProfilingBuffer->getSize());
+            parseBuffer(vmThread, crtProfilingBuffer->getBuffer(), crtProfilingBuffer->getSize());
+            processed = true;
          //fprintf(stderr, "IProfiler thread finished processing\n");
             }
-         releaseVMAccess(_iprofilerThread);
+         releaseVMAccess(vmThread);
          }
       else // Special
          {
@@ -3946,9 +4151,11 @@ void TR_IProfiler::processWorkingQueue()
          }
       // attach the buffer to the buffer pool
       _iprofilerMonitor->enter();
-      _freeBufferList.add(_crtProfilingBuffer);
-      _crtProfilingBuffer = NULL;
+      _freeBufferList.add(crtProfilingBuffer);
+      crtProfilingBuffer = NULL;
       _numOutstandingBuffers--;
+      if (processed)
+         _numBuffersProcessed++;
       }while(1);
    }
 
@@ -4318,6 +4525,12 @@ void TR_IProfiler::invalidateProfilingBuffers() // called for class unloading
       // mark this buffer as invalid
       _crtProfilingBuffer->setIsInvalidated(true); // set with exclusive VM access
       }
+   for (int32_t i = 0; i < _numWorkers; i++)
+      {
+      IProfilerBuffer *workerBuffer = _workers[i]._crtProfilingBuffer;
+      if (workerBuffer && workerBuffer->getSize() > 0)
+         workerBuffer->setIsInvalidated(true); // set with exclusive VM access
+      }
    while (!_workingBufferList.isEmpty())
       {
       IProfilerBuffer *profilingBuffer = _workingBufferList.pop();
@@ -4326,6 +4539,7 @@ void TR_IProfiler::invalidateProfilingBuffers() // called for class unloading
          // attach the buffer to the buffer pool
          _freeBufferList.add(profilingBuffer);
          _numOutstandingBuffers--;
+         _numBuffersInvalidated++;
          }
       else // When the iprofiler thread sees this special buffer it will exit
          {
@@ -4373,7 +4587,7 @@ void printCsInfo(CallSiteProfileInfo& csInfo, TR::Compilation* comp, void* tag =
 void *
 TR_IPHashedCallSite::operator new (size_t size) throw()
    {
-   memoryConsumed += (int32_t)size;
+   VM_AtomicSupport::add(&memoryConsumed, size);
    void *alloc = jitPersistentAlloc(size);
    return alloc;
    }
@@ -4714,56 +4928,52 @@ void TR_IProfiler::dumpIPBCDataCallGraph(J9VMThread* vmThread)
    TR_J9VMBase * fe = TR_J9VMBase::get(javaVM->jitConfig, vmThread);
 
    fprintf(stderr, "Aggregating per method ...\n");
-   for (int32_t bucket = 0; bucket < BC_HASH_TABLE_SIZE; bucket++)
+   forEachBCEntry([&](TR_IPBytecodeHashTableEntry *entry, int32_t bucket)
       {
-      //fprintf(stderr, "Looking at bucket %d\n", bucket);
-      for (TR_IPBytecodeHashTableEntry *entry = _bcHashTable[bucket]; entry; entry = entry->getNext())
+      // Skip invalid entries
+      if (entry->isInvalid() || invalidateEntryIfInconsistent(entry))
+         return;
+      TR_IPBCDataCallGraph *cgEntry = entry->asIPBCDataCallGraph();
+      if (cgEntry)
          {
-         // Skip invalid entries
-         if (entry->isInvalid() || invalidateEntryIfInconsistent(entry))
-            continue;
-         TR_IPBCDataCallGraph *cgEntry = entry->asIPBCDataCallGraph();
-         if (cgEntry)
+         // Get the pc and find the method this pc belongs to
+         U_8* pc = (U_8*)cgEntry->getPC();
+         //fprintf(stderr, "\tInspecting pc=%p\n", pc);
+         J9ClassLoader* loader;
+         J9ROMClass * romClass = vmFunctions->findROMClassFromPC(vmThread, (UDATA)pc, &loader);
+         if (romClass)
             {
-            // Get the pc and find the method this pc belongs to
-            U_8* pc = (U_8*)cgEntry->getPC();
-            //fprintf(stderr, "\tInspecting pc=%p\n", pc);
-            J9ClassLoader* loader;
-            J9ROMClass * romClass = vmFunctions->findROMClassFromPC(vmThread, (UDATA)pc, &loader);
-            if (romClass)
+            //J9ROMMethod * romMethod = vmFunctions->findROMMethodInROMClass(vmThread, romClass, (UDATA)pc);
+            J9ROMMethod *currentMethod = J9ROMCLASS_ROMMETHODS(romClass);
+            J9ROMMethod *desiredMethod = NULL;
+            //fprintf(stderr, "Scanning %u romMethods...\n", romClass->romMethodCount);
+            for (U_32 i = 0; i < romClass->romMethodCount; i++)
                {
-               //J9ROMMethod * romMethod = vmFunctions->findROMMethodInROMClass(vmThread, romClass, (UDATA)pc);
-               J9ROMMethod *currentMethod = J9ROMCLASS_ROMMETHODS(romClass);
-               J9ROMMethod *desiredMethod = NULL;
-               //fprintf(stderr, "Scanning %u romMethods...\n", romClass->romMethodCount);
-               for (U_32 i = 0; i < romClass->romMethodCount; i++)
+               if (((UDATA)pc >= (UDATA)currentMethod) && ((UDATA)pc < (UDATA)J9_BYTECODE_END_FROM_ROM_METHOD(currentMethod)))
                   {
-                  if (((UDATA)pc >= (UDATA)currentMethod) && ((UDATA)pc < (UDATA)J9_BYTECODE_END_FROM_ROM_METHOD(currentMethod)))
-                     {
-                     // found the method
-                     desiredMethod = currentMethod;
-                     break;
-                     }
-                  currentMethod = nextROMMethod(currentMethod);
+                  // found the method
+                  desiredMethod = currentMethod;
+                  break;
                   }
+               currentMethod = nextROMMethod(currentMethod);
+               }
 
-               if (desiredMethod)
-                  {
-                  // Add the information to the aggregationTable
-                  aggregationHT.add(desiredMethod, romClass, cgEntry);
-                  }
-               else
-                  {
-                  fprintf(stderr, "pc=%p does not belong to romMethod range\n", pc);
-                  }
+            if (desiredMethod)
+               {
+               // Add the information to the aggregationTable
+               aggregationHT.add(desiredMethod, romClass, cgEntry);
                }
             else
                {
-               fprintf(stderr, "pc=%p does not belong to a romMethod\n", pc);
+               fprintf(stderr, "pc=%p does not belong to romMethod range\n", pc);
                }
             }
+         else
+            {
+            fprintf(stderr, "pc=%p does not belong to a romMethod\n", pc);
+            }
          }
-      }
+      });
    aggregationHT.sortByNameAndPrint(fe);
    if (haveAcquiredVMAccess)
       releaseVMAccessNoSuspend(vmThread);
@@ -193,11 +193,9 @@ class TR_IPBytecodeHashTableEntry
 public:
    TR_PERSISTENT_ALLOC(TR_Memory::IProfiler)
    static void* alignedPersistentAlloc(size_t size);
-   TR_IPBytecodeHashTableEntry(uintptr_t pc) : _next(NULL), _pc(pc), _lastSeenClassUnloadID(-1), _entryFlags(0), _persistFlags(IPBC_ENTRY_CAN_PERSIST_FLAG) {}
+   TR_IPBytecodeHashTableEntry(uintptr_t pc) : _pc(pc), _lastSeenClassUnloadID(-1), _entryFlags(0), _persistFlags(IPBC_ENTRY_CAN_PERSIST_FLAG) {}
 
    uintptr_t getPC() const { return _pc; }
-   TR_IPBytecodeHashTableEntry * getNext() const { return _next; }
-   void setNext(TR_IPBytecodeHashTableEntry *n) { _next = n; }
    int32_t getLastSeenClassUnloadID() const { return _lastSeenClassUnloadID; }
    void setLastSeenClassUnloadID(int32_t v) { _lastSeenClassUnloadID = v; }
    virtual uintptr_t getData(TR::Compilation *comp = NULL) = 0;
@@ -237,7 +235,6 @@ public:
    void resetLockedEntry() { _persistFlags &= ~IPBC_ENTRY_PERSIST_LOCK_FLAG; }
 
 protected:
-   TR_IPBytecodeHashTableEntry *_next;
    uintptr_t _pc;
    int32_t    _lastSeenClassUnloadID;
 
@@ -251,6 +248,30 @@ protected:
    uint8_t _persistFlags;
    }; // class TR_IPBytecodeHashTableEntry
 
+// Block of slots in a bucket of the bytecode hashtable. The PCs of the entries are stored inline
+// next to the entry pointers, and a block fits in a cache line, so a lookup only has to touch
+// the entry it is looking for. Blocks of a bucket are chained when the first block is full.
+// Slots are claimed with a compare-and-swap on the PC and blocks are never removed, so lookups
+// need no locking and multiple threads can add entries concurrently.
+struct TR_IPBCHashTableBlock
+   {
+   TR_PERSISTENT_ALLOC(TR_Memory::IProfiler)
+   static const int32_t NUM_SLOTS = (64 - sizeof(void *)) / (sizeof(uintptr_t) + sizeof(void *));
+
+   TR_IPBCHashTableBlock() : _next(NULL)
+      {
+      for (int32_t i = 0; i < NUM_SLOTS; ++i)
+         {
+         _pcs[i] = 0;
+         _entries[i] = NULL;
+         }
+      }
+
+   volatile uintptr_t _pcs[NUM_SLOTS]; // 0 means the slot is free
+   TR_IPBytecodeHashTableEntry * volatile _entries[NUM_SLOTS]; // NULL until the entry for the claimed PC is published
+   TR_IPBCHashTableBlock * volatile _next;
+   };
+
 class TR_IPMethodData
    {
    public:
@@ -460,6 +481,21 @@ class IProfilerBuffer : public TR_Link0<IProfilerBuffer>
    volatile bool _isInvalidated;
    };
 
+class TR_IProfiler;
+
+// Additional thread that processes profiling buffers from the working queue
+// in parallel with the IProfiler thread (see -Xjit:iprofilerNumWorkerThreads=)
+struct TR_IProfilerWorker
+   {
+   TR_IProfiler *_iProfiler;
+   J9JavaVM *_javaVM;
+   j9thread_t _osThread;
+   J9VMThread *_vmThread;
+   IProfilerBuffer * volatile _crtProfilingBuffer; // profiling buffer being processed by this worker
+   volatile bool _attachAttempted;
+   char _name[32];
+   };
+
 class TR_ReadSampleRequestsStats
    {
 friend class TR_ReadSampleRequestsHistory;
@@ -500,6 +536,7 @@ public:
    TR_PERSISTENT_ALLOC(TR_Memory::IProfiler);
    static TR_IProfiler *allocate (J9JITConfig *);
    static uint32_t getProfilerMemoryFootprint();
+   static uint32_t getBCHashTableMemoryFootprint(); // part of the above used by the bytecode hashtable itself (not the entries)
 
    uintptr_t getReceiverClassFromCGProfilingData(TR_ByteCodeInfo &bcInfo, TR::Compilation *comp);
 
@@ -574,7 +611,10 @@ public:
    TR::Monitor* getIProfilerMonitor() { return _iprofilerMonitor; }
    bool processProfilingBuffer(J9VMThread *vmThread, const U_8* dataStart, UDATA size);
    void setAttachAttempted(bool b) { _iprofilerThreadAttachAttempted = b; }
-   void processWorkingQueue();
+   void processWorkingQueue(); // executed by the IProfiler thread
+   void processWorkingQueue(TR_IProfilerWorker *worker); // executed by worker threads
+   void workerThreadAttached(TR_IProfilerWorker *worker, J9VMThread *vmThread);
+   void workerThreadExited(TR_IProfilerWorker *worker);
    bool getAttachAttempted() const { return _iprofilerThreadAttachAttempted; }
    IProfilerBuffer *getCrtProfilingBuffer() const { return _crtProfilingBuffer; }
    void setCrtProfilingBuffer(IProfilerBuffer *b) { _crtProfilingBuffer = b; }
@@ -631,6 +671,9 @@ private:
    int32_t getSamplingCount( TR_IPBytecodeHashTableEntry *entry, TR::Compilation *comp);
    // for replay
    void copyDataFromEntry(TR_IPBytecodeHashTableEntry *oldEntry, TR_IPBytecodeHashTableEntry *newEntry, TR_IProfiler *ip);
+   void processWorkingQueue(J9VMThread *vmThread, IProfilerBuffer * volatile &crtProfilingBuffer, bool isWorker);
+   void startIProfilerWorkerThreads(J9JavaVM *javaVM);
+   void stopIProfilerWorkerThreads();
 
    TR_IPBCDataStorageHeader *getJ9SharedDataDescriptorForMethod(J9SharedDataDescriptor * descriptor, unsigned char * buffer, uint32_t length, TR_OpaqueMethodBlock * method, TR::Compilation *comp);
 
@@ -651,6 +694,8 @@ private:
 
    TR_IPBCDataAllocation *profilingAllocSample (uintptr_t pc, uintptr_t data, bool addIt);
    TR_IPBytecodeHashTableEntry *findOrCreateEntry (int32_t bucket, uintptr_t pc, bool addIt);
+   TR_IPBytecodeHashTableEntry *createEntry(uintptr_t pc);
+   template<typename F> void forEachBCEntry(F f);
    TR_IPBCDataAllocation *findOrCreateAllocEntry (int32_t bucket, uintptr_t pc, bool addIt);
    TR_OpaqueMethodBlock * getMethodFromNode(TR::Node *node, TR::Compilation *comp);
    bool addSampleData(TR_IPBytecodeHashTableEntry *entry, uintptr_t data, bool isRIData = false, uint32_t freq = 1);
@@ -687,7 +732,7 @@ private:
 
    // bytecode hashtable
    protected:
-   TR_IPBytecodeHashTableEntry   **_bcHashTable;
+   TR_IPBCHashTableBlock * volatile *_bcHashTable;
    private:
 #if defined(EXPERIMENTAL_IPROFILER)
    // bytecode hashtable
@@ -706,12 +751,18 @@ private:
    TR_LinkHead0<IProfilerBuffer>   _freeBufferList;
    TR_LinkHead0<IProfilerBuffer>   _workingBufferList;
    IProfilerBuffer                *_workingBufferTail;
-   IProfilerBuffer                *_crtProfilingBuffer; // profiling buffer being processes by iprofiling thread
+   IProfilerBuffer * volatile      _crtProfilingBuffer; // profiling buffer being processes by iprofiling thread
+   TR_IProfilerWorker             *_workers;
+   int32_t                         _numWorkers;
+   volatile int32_t                _numActiveWorkers; // workers that are attached and have not exited yet
+   volatile bool                   _stopWorkers;
    TR::Monitor                    *_iprofilerMonitor;
    volatile int32_t                _numOutstandingBuffers;
    uint64_t                        _numRequests;
    uint64_t                        _numRequestsSkipped;
    uint64_t                        _numRequestsHandedToIProfilerThread;
+   uint64_t                        _numBuffersProcessed; // buffers parsed by the IProfiler thread and its workers
+   uint64_t                        _numBuffersInvalidated; // buffers dropped from the working queue because of class unloading
    volatile uint32_t               _iprofilerThreadExitFlag;
    volatile bool                   _iprofilerThreadAttachAttempted;
    uint64_t                        _iprofilerNumRecords; // info stats only
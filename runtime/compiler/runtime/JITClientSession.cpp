@@ -40,7 +40,7 @@ ClientSessionData::ClientSessionData(uint64_t clientUID, uint32_t seqNo, TR_Pers
    _usesPerClientMemory(usesPerClientMemory),
    _OOSequenceEntryList(NULL), _chTable(NULL),
    _romClassMap(decltype(_romClassMap)::allocator_type(persistentMemory->_persistentAllocator.get())),
-   _J9MethodMap(decltype(_J9MethodMap)::allocator_type(persistentMemory->_persistentAllocator.get())),
+   _J9MethodMapStripes(NULL),
    _classBySignatureMap(decltype(_classBySignatureMap)::allocator_type(persistentMemory->_persistentAllocator.get())),
    _classChainDataMap(decltype(_classChainDataMap)::allocator_type(persistentMemory->_persistentAllocator.get())),
    _constantPoolToClassMap(decltype(_constantPoolToClassMap)::allocator_type(persistentMemory->_persistentAllocator.get())),
@@ -58,6 +58,11 @@ ClientSessionData::ClientSessionData(uint64_t clientUID, uint32_t seqNo, TR_Pers
    _inUse = 1;
    _numActiveThreads = 0;
    _romMapMonitor = TR::Monitor::create("JIT-JITServerROMMapMonitor");
+   _J9MethodMapStripes = (J9MethodMapStripe *)_persistentMemory->allocatePersistentMemory(J9METHOD_MAP_STRIPES * sizeof(J9MethodMapStripe));
+   if (!_J9MethodMapStripes)
+      throw std::bad_alloc();
+   for (size_t i = 0; i < J9METHOD_MAP_STRIPES; ++i)
+      new (&_J9MethodMapStripes[i]) J9MethodMapStripe(_persistentMemory);
    _classMapMonitor = TR::Monitor::create("JIT-JITServerClassMapMonitor");
    _classChainDataMapMonitor = TR::Monitor::create("JIT-JITServerClassChainDataMapMonitor");
    _sequencingMonitor = TR::Monitor::create("JIT-JITServerSequencingMonitor");
@@ -86,6 +91,9 @@ ClientSessionData::~ClientSessionData()
    // This is because in some places from where the session is destroyed,
    // per-client allocation region cannot be entered.
    clearCaches();
+   for (size_t i = 0; i < J9METHOD_MAP_STRIPES; ++i)
+      _J9MethodMapStripes[i].~J9MethodMapStripe();
+   _persistentMemory->freePersistentMemory(_J9MethodMapStripes);
    TR::Monitor::destroy(_romMapMonitor);
    TR::Monitor::destroy(_classMapMonitor);
    TR::Monitor::destroy(_classChainDataMapMonitor);
@@ -116,7 +124,7 @@ ClientSessionData::updateTimeOfLastAccess()
 void
 ClientSessionData::initializeUnloadedClassAddrRanges(const std::vector<TR_AddressRange> &unloadedClassRanges, int32_t maxRanges)
    {
-   OMR::CriticalSection getUnloadedClasses(getROMMapMonitor());
+   ROMMapCriticalSection getUnloadedClasses(this);
 
    if (!_unloadedClassAddresses)
       _unloadedClassAddresses = new (PERSISTENT_NEW) TR_AddressSet(_persistentMemory, maxRanges);
@@ -144,7 +152,7 @@ ClientSessionData::processUnloadedClasses(const std::vector<TR_OpaqueClassBlock*
    std::vector<ClassUnloadedData> unloadedClasses;
    unloadedClasses.reserve(numOfUnloadedClasses);
       {
-      OMR::CriticalSection processUnloadedClasses(getROMMapMonitor());
+      ROMMapCriticalSection processUnloadedClasses(this);
 
       for (auto clazz : classes)
          {
@@ -203,8 +211,9 @@ ClientSessionData::processUnloadedClasses(const std::vector<TR_OpaqueClassBlock*
          for (size_t i = 0; i < romClass->romMethodCount; i++)
             {
             J9Method *j9method = methods + i;
-            auto iter = _J9MethodMap.find(j9method);
-            if (iter != _J9MethodMap.end())
+            J9MethodMapCriticalSection methodMap(this, j9method);
+            auto iter = methodMap.map().find(j9method);
+            if (iter != methodMap.map().end())
                {
                IPTable_t *ipDataHT = iter->second._IPData;
                if (ipDataHT)
@@ -219,7 +228,7 @@ ClientSessionData::processUnloadedClasses(const std::vector<TR_OpaqueClassBlock*
                   _persistentMemory->freePersistentMemory(ipDataHT);
                   iter->second._IPData = NULL;
                   }
-               _J9MethodMap.erase(j9method);
+               methodMap.map().erase(iter);
                }
             }
          it->second.freeClassInfo(_persistentMemory);
@@ -262,7 +271,7 @@ ClientSessionData::processIllegalFinalFieldModificationList(const std::vector<TR
          "compThreadID=%d will process a list of %zu classes with illegal final field modification for clientUID %llu",
             compThreadID, numOfClasses, (unsigned long long)_clientUID);
       {
-      OMR::CriticalSection processClassesWithIllegalModification(getROMMapMonitor());
+      ROMMapCriticalSection processClassesWithIllegalModification(this);
       for (auto clazz : classes)
          {
          auto it = _romClassMap.find((J9Class*)clazz);
@@ -282,9 +291,9 @@ ClientSessionData::getCachedIProfilerInfo(TR_OpaqueMethodBlock *method, uint32_t
    {
    *methodInfoPresent = false;
    TR_IPBytecodeHashTableEntry *ipEntry = NULL;
-   OMR::CriticalSection getRemoteROMClass(getROMMapMonitor());
+   J9MethodMapCriticalSection methodMap(this, (J9Method*)method);
    // check whether info about j9method is cached
-   auto & j9methodMap = getJ9MethodMap();
+   auto & j9methodMap = methodMap.map();
    auto it = j9methodMap.find((J9Method*)method);
    if (it != j9methodMap.end())
       {
@@ -313,9 +322,9 @@ ClientSessionData::getCachedIProfilerInfo(TR_OpaqueMethodBlock *method, uint32_t
 bool
 ClientSessionData::cacheIProfilerInfo(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, TR_IPBytecodeHashTableEntry *entry, bool isCompiled)
    {
-   OMR::CriticalSection getRemoteROMClass(getROMMapMonitor());
+   J9MethodMapCriticalSection methodMap(this, (J9Method*)method);
    // check whether info about j9method exists
-   auto & j9methodMap = getJ9MethodMap();
+   auto & j9methodMap = methodMap.map();
    auto it = j9methodMap.find((J9Method*)method);
    if (it != j9methodMap.end())
       {
@@ -356,7 +365,10 @@ ClientSessionData::printStats()
    {
    PORT_ACCESS_FROM_PORT(TR::Compiler->portLib);
    j9tty_printf(PORTLIB, "\tNum cached ROM classes: %d\n", _romClassMap.size());
-   j9tty_printf(PORTLIB, "\tNum cached ROM methods: %d\n", _J9MethodMap.size());
+   size_t numMethods = 0;
+   for (size_t i = 0; i < J9METHOD_MAP_STRIPES; ++i)
+      numMethods += _J9MethodMapStripes[i]._map.size();
+   j9tty_printf(PORTLIB, "\tNum cached ROM methods: %d\n", numMethods);
    size_t total = 0;
    for (auto& it : _romClassMap)
       total += it.second._romClass->romSize;
@@ -364,6 +376,57 @@ ClientSessionData::printStats()
    j9tty_printf(PORTLIB, "\tTotal size of cached ROM classes + methods: %d bytes\n", total);
    }
 
+// Acquire a session monitor, noting whether another thread was holding it
+static void
+enterAndRecordContention(TR::Monitor *monitor, ClientSessionData::LockStats &stats)
+   {
+   if (monitor->try_enter() != 0)
+      {
+      monitor->enter();
+      stats._numContended++;
+      }
+   stats._numAcquisitions++;
+   }
+
+ClientSessionData::J9MethodMapStripe::J9MethodMapStripe(TR_PersistentMemory *persistentMemory) :
+   _map(decltype(_map)::allocator_type(persistentMemory->_persistentAllocator.get())),
+   _monitor(TR::Monitor::create("JIT-JITServerJ9MethodMapMonitor"))
+   {
+   if (!_monitor)
+      throw std::bad_alloc();
+   }
+
+ClientSessionData::J9MethodMapStripe::~J9MethodMapStripe()
+   {
+   TR::Monitor::destroy(_monitor);
+   }
+
+ClientSessionData::J9MethodMapCriticalSection::J9MethodMapCriticalSection(ClientSessionData *clientData, J9Method *method) :
+   // J9Methods are at least 8-byte aligned and consecutive methods of a class are adjacent,
+   // so dropping the low bits spreads the methods of a class over all the stripes
+   _stripe(clientData->_J9MethodMapStripes[((uintptr_t)method / sizeof(J9Method)) % J9METHOD_MAP_STRIPES])
+   {
+   enterAndRecordContention(_stripe._monitor, _stripe._lockStats);
+   }
+
+ClientSessionData::ROMMapCriticalSection::ROMMapCriticalSection(ClientSessionData *clientData) :
+   _monitor(clientData->getROMMapMonitor())
+   {
+   enterAndRecordContention(_monitor, clientData->_romMapLockStats);
+   }
+
+ClientSessionData::LockStats
+ClientSessionData::getJ9MethodMapLockStats() const
+   {
+   LockStats stats;
+   for (size_t i = 0; i < J9METHOD_MAP_STRIPES; ++i)
+      {
+      stats._numAcquisitions += _J9MethodMapStripes[i]._lockStats._numAcquisitions;
+      stats._numContended += _J9MethodMapStripes[i]._lockStats._numContended;
+      }
+   return stats;
+   }
+
 ClientSessionData::ClassInfo::ClassInfo() :
    _romClass(NULL),
    _remoteRomClass(NULL),
@@ -482,7 +545,7 @@ ClientSessionData::clearCaches()
       OMR::CriticalSection clearCache(getClassMapMonitor());
       _classBySignatureMap.clear();
       }
-   OMR::CriticalSection getRemoteROMClass(getROMMapMonitor());
+   ROMMapCriticalSection getRemoteROMClass(this);
 
    if (_unloadedClassAddresses)
       {
@@ -492,26 +555,30 @@ ClientSessionData::clearCaches()
       }
   _requestUnloadedClasses = true;
 
-   // Free memory for all hashtables with IProfiler info
-   for (auto& it : _J9MethodMap)
+   for (size_t i = 0; i < J9METHOD_MAP_STRIPES; ++i)
       {
-      IPTable_t *ipDataHT = it.second._IPData;
-      // It it exists, walk the collection of <pc, TR_IPBytecodeHashTableEntry*> mappings
-      if (ipDataHT)
+      J9MethodMapStripe &stripe = _J9MethodMapStripes[i];
+      OMR::CriticalSection clearStripe(stripe._monitor);
+      // Free memory for all hashtables with IProfiler info
+      for (auto& it : stripe._map)
          {
-         for (auto& entryIt : *ipDataHT)
+         IPTable_t *ipDataHT = it.second._IPData;
+         // It it exists, walk the collection of <pc, TR_IPBytecodeHashTableEntry*> mappings
+         if (ipDataHT)
             {
-            auto entryPtr = entryIt.second;
-            if (entryPtr)
-               _persistentMemory->freePersistentMemory(entryPtr);
+            for (auto& entryIt : *ipDataHT)
+               {
+               auto entryPtr = entryIt.second;
+               if (entryPtr)
+                  _persistentMemory->freePersistentMemory(entryPtr);
+               }
+            ipDataHT->~IPTable_t();
+            _persistentMemory->freePersistentMemory(ipDataHT);
+            it.second._IPData = NULL;
             }
-         ipDataHT->~IPTable_t();
-         _persistentMemory->freePersistentMemory(ipDataHT);
-         it.second._IPData = NULL;
          }
+      stripe._map.clear();
       }
-
-   _J9MethodMap.clear();
    // Free memory for j9class info
    for (auto& it : _romClassMap)
       it.second.freeClassInfo(_persistentMemory);
@@ -890,3 +957,20 @@ ClientSessionHT::printStats()
       session.second->printStats();
       }
    }
+
+// Must have compilation monitor in hand when calling this function.
+// The counters of each session are read without its monitors, so the sums are approximate.
+void
+ClientSessionHT::getLockStats(ClientSessionData::LockStats &romMapStats, ClientSessionData::LockStats &j9MethodMapStats) const
+   {
+   for (auto &session : _clientSessionMap)
+      {
+      const ClientSessionData::LockStats &romStats = session.second->getROMMapLockStats();
+      romMapStats._numAcquisitions += romStats._numAcquisitions;
+      romMapStats._numContended += romStats._numContended;
+
+      ClientSessionData::LockStats methodStats = session.second->getJ9MethodMapLockStats();
+      j9MethodMapStats._numAcquisitions += methodStats._numAcquisitions;
+      j9MethodMapStats._numContended += methodStats._numContended;
+      }
+   }
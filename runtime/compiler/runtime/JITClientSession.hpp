@@ -294,6 +294,67 @@ class ClientSessionData
       bool _needsMethodTrampolines;
       }; // struct VMInfo
 
+   /**
+      @class LockStats
+      @brief Counts how often a session monitor was acquired and how often it was held by another thread at that time
+
+      The counters are updated with the corresponding monitor in hand.
+   */
+   struct LockStats
+      {
+      LockStats() : _numAcquisitions(0), _numContended(0) {}
+      uint64_t _numAcquisitions;
+      uint64_t _numContended;
+      };
+
+   /**
+      @class J9MethodMapStripe
+      @brief One of the independently locked parts of the J9Method map
+
+      Server compilation threads look up J9MethodInfo far more often than they add to it,
+      so the map is split into stripes selected by the J9Method address to keep them from
+      serializing on a single monitor. A stripe monitor can be acquired while holding the
+      ROM class map monitor (e.g. when caching a class and its methods), but not the reverse.
+   */
+   struct J9MethodMapStripe
+      {
+      J9MethodMapStripe(TR_PersistentMemory *persistentMemory);
+      ~J9MethodMapStripe();
+
+      PersistentUnorderedMap<J9Method*, J9MethodInfo> _map;
+      TR::Monitor *_monitor;
+      LockStats _lockStats;
+      }; // struct J9MethodMapStripe
+
+   /**
+      @class J9MethodMapCriticalSection
+      @brief Locks the stripe of the J9Method map that holds the given method for the duration of a scope
+   */
+   class J9MethodMapCriticalSection
+      {
+   public:
+      J9MethodMapCriticalSection(ClientSessionData *clientData, J9Method *method);
+      ~J9MethodMapCriticalSection() { _stripe._monitor->exit(); }
+      PersistentUnorderedMap<J9Method*, J9MethodInfo> &map() { return _stripe._map; }
+
+   private:
+      J9MethodMapStripe &_stripe;
+      }; // class J9MethodMapCriticalSection
+
+   /**
+      @class ROMMapCriticalSection
+      @brief Locks the ROM class map monitor for the duration of a scope and records contention on it
+   */
+   class ROMMapCriticalSection
+      {
+   public:
+      ROMMapCriticalSection(ClientSessionData *clientData);
+      ~ROMMapCriticalSection() { _monitor->exit(); }
+
+   private:
+      TR::Monitor *_monitor;
+      }; // class ROMMapCriticalSection
+
    /**
     * @class CacheDescriptor
     * @brief Struct which contains data found in a cache descriptor
@@ -317,7 +378,6 @@ class ClientSessionData
    TR_OpaqueClassBlock * getJavaLangClassPtr() const { return _javaLangClassPtr; }
    TR_PersistentCHTable *getCHTable();
    PersistentUnorderedMap<J9Class*, ClassInfo> & getROMClassMap() { return _romClassMap; }
-   PersistentUnorderedMap<J9Method*, J9MethodInfo> & getJ9MethodMap() { return _J9MethodMap; }
    PersistentUnorderedMap<ClassLoaderStringPair, TR_OpaqueClassBlock*> & getClassBySignatureMap() { return _classBySignatureMap; }
    PersistentUnorderedMap<J9Class *, UDATA *> & getClassChainDataCache() { return _classChainDataMap; }
    PersistentUnorderedMap<J9ConstantPool *, TR_OpaqueClassBlock*> & getConstantPoolToClassMap() { return _constantPoolToClassMap; }
@@ -325,12 +385,15 @@ class ClientSessionData
    void processUnloadedClasses(const std::vector<TR_OpaqueClassBlock*> &classes, bool updateUnloadedClasses);
    void processIllegalFinalFieldModificationList(const std::vector<TR_OpaqueClassBlock*> &classes);
    TR::Monitor *getROMMapMonitor() { return _romMapMonitor; }
+   const LockStats &getROMMapLockStats() const { return _romMapLockStats; }
+   // Sums up the lock statistics of all the stripes of the J9Method map; the result is approximate
+   LockStats getJ9MethodMapLockStats() const;
    TR::Monitor *getClassMapMonitor() { return _classMapMonitor; }
    TR::Monitor *getClassChainDataMapMonitor() { return _classChainDataMapMonitor; }
    TR_IPBytecodeHashTableEntry *getCachedIProfilerInfo(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, bool *methodInfoPresent);
    bool cacheIProfilerInfo(TR_OpaqueMethodBlock *method, uint32_t byteCodeIndex, TR_IPBytecodeHashTableEntry *entry, bool isCompiled);
    VMInfo *getOrCacheVMInfo(JITServer::ServerStream *stream);
-   void clearCaches(); // destroys _chTableClassMap, _romClassMap, _J9MethodMap and _unloadedClassAddresses
+   void clearCaches(); // destroys _chTableClassMap, _romClassMap, _J9MethodMapStripes and _unloadedClassAddresses
    bool cachesAreCleared() const { return _requestUnloadedClasses; }
    void setCachesAreCleared(bool b) { _requestUnloadedClasses = b; }
    TR_AddressSet& getUnloadedClassAddresses()
@@ -416,8 +479,9 @@ class ClientSessionData
    JITServerPersistentCHTable *_chTable;
    // Server side cache of j9classes and their properties; romClass is copied so it can be accessed by the server
    PersistentUnorderedMap<J9Class*, ClassInfo> _romClassMap;
-   // Hashtable for information related to one J9Method
-   PersistentUnorderedMap<J9Method*, J9MethodInfo> _J9MethodMap;
+   // Hashtable for information related to one J9Method, split into J9METHOD_MAP_STRIPES independently locked stripes
+   static const size_t J9METHOD_MAP_STRIPES = 16;
+   J9MethodMapStripe *_J9MethodMapStripes;
    // The following hashtable caches <classname> --> <J9Class> mappings
    // All classes in here are loaded by the systemClassLoader so we know they cannot be unloaded
    PersistentUnorderedMap<ClassLoaderStringPair, TR_OpaqueClassBlock*> _classBySignatureMap;
@@ -426,6 +490,7 @@ class ClientSessionData
    //Constant pool to class map
    PersistentUnorderedMap<J9ConstantPool *, TR_OpaqueClassBlock *> _constantPoolToClassMap;
    TR::Monitor *_romMapMonitor;
+   LockStats _romMapLockStats; // updated with _romMapMonitor in hand
    TR::Monitor *_classMapMonitor;
    TR::Monitor *_classChainDataMapMonitor;
    // The following monitor is used to protect access to _lastProcessedCriticalSeqNo and
@@ -504,6 +569,8 @@ class ClientSessionHT
    ClientSessionData * findClientSession(uint64_t clientUID);
    void purgeOldDataIfNeeded();
    void printStats();
+   // Sums up the lock statistics of all client sessions; must be called with the compilation monitor in hand
+   void getLockStats(ClientSessionData::LockStats &romMapStats, ClientSessionData::LockStats &j9MethodMapStats) const;
    uint32_t size() const { return _clientSessionMap.size(); }
 
    private:
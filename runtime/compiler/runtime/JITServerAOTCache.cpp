@@ -20,6 +20,9 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <dirent.h>
+#include <random>
+#include <sys/stat.h>
 #include "control/CompilationRuntime.hpp"
 #include "env/StackMemoryRegion.hpp"
 #include "infra/CriticalSection.hpp"
@@ -27,6 +30,11 @@
 #include "runtime/JITServerSharedROMClassCache.hpp"
 
 
+static const char JITServerAOTCacheSnapshotEyeCatcher[] = "J9AOTCACHE";
+// Must be incremented whenever the format of the snapshot file or any serialization record changes
+static const uint32_t JITServerAOTCacheSnapshotVersion = 1;
+
+
 void *
 AOTCacheRecord::allocate(size_t size)
    {
@@ -65,11 +73,17 @@ AOTCacheClassLoaderRecord::create(uintptr_t id, const uint8_t *name, size_t name
 
 ClassSerializationRecord::ClassSerializationRecord(uintptr_t id, uintptr_t classLoaderId,
                                                    const JITServerROMClassHash &hash, const J9ROMClass *romClass) :
-   AOTSerializationRecord(size(J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(romClass))), id, AOTSerializationRecordType::Class),
-   _classLoaderId(classLoaderId), _hash(hash), _romClassSize(romClass->romSize),
-   _nameLength(J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(romClass)))
+   ClassSerializationRecord(id, classLoaderId, hash, romClass->romSize,
+                            J9UTF8_DATA(J9ROMCLASS_CLASSNAME(romClass)), J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(romClass)))
    {
-   memcpy(_name, J9UTF8_DATA(J9ROMCLASS_CLASSNAME(romClass)), _nameLength);
+   }
+
+ClassSerializationRecord::ClassSerializationRecord(uintptr_t id, uintptr_t classLoaderId, const JITServerROMClassHash &hash,
+                                                   uint32_t romClassSize, const uint8_t *name, size_t nameLength) :
+   AOTSerializationRecord(size(nameLength), id, AOTSerializationRecordType::Class),
+   _classLoaderId(classLoaderId), _hash(hash), _romClassSize(romClassSize), _nameLength(nameLength)
+   {
+   memcpy(_name, name, nameLength);
    }
 
 AOTCacheClassRecord::AOTCacheClassRecord(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
@@ -87,6 +101,21 @@ AOTCacheClassRecord::create(uintptr_t id, const AOTCacheClassLoaderRecord *class
    return new (ptr) AOTCacheClassRecord(id, classLoaderRecord, hash, romClass);
    }
 
+AOTCacheClassRecord::AOTCacheClassRecord(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
+                                         const ClassSerializationRecord &data) :
+   _classLoaderRecord(classLoaderRecord),
+   _data(id, classLoaderRecord->data().id(), data.hash(), data.romClassSize(), data.name(), data.nameLength())
+   {
+   }
+
+AOTCacheClassRecord *
+AOTCacheClassRecord::create(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
+                            const ClassSerializationRecord &data)
+   {
+   void *ptr = AOTCacheRecord::allocate(size(data.nameLength()));
+   return new (ptr) AOTCacheClassRecord(id, classLoaderRecord, data);
+   }
+
 void
 AOTCacheClassRecord::subRecordsDo(const std::function<void(const AOTCacheRecord *)> &f) const
    {
@@ -227,6 +256,31 @@ CachedAOTMethod::create(const AOTCacheClassChainRecord *definingClassChainRecord
                                     records, code, codeSize, data, dataSize);
    }
 
+CachedAOTMethod::CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord,
+                                 const AOTCacheAOTHeaderRecord *aotHeaderRecord,
+                                 const AOTCacheRecord *const *records, const SerializedAOTMethod &data) :
+   _data(definingClassChainRecord->data().id(), data.index(), data.optLevel(), aotHeaderRecord->data().id(),
+         data.numRecords(), data.code(), data.codeSize(), data.data(), data.dataSize()),
+   _definingClassChainRecord(definingClassChainRecord)
+   {
+   // Record IDs in the loaded method refer to the records in the snapshot file, which can have different IDs in this cache
+   for (size_t i = 0; i < data.numRecords(); ++i)
+      {
+      const AOTSerializationRecord *record = records[i]->dataAddr();
+      new (&_data.offsets()[i]) SerializedSCCOffset(record->id(), record->type(), data.offsets()[i].reloDataOffset());
+      ((const AOTCacheRecord **)this->records())[i] = records[i];
+      }
+   }
+
+CachedAOTMethod *
+CachedAOTMethod::create(const AOTCacheClassChainRecord *definingClassChainRecord,
+                        const AOTCacheAOTHeaderRecord *aotHeaderRecord,
+                        const AOTCacheRecord *const *records, const SerializedAOTMethod &data)
+   {
+   void *ptr = AOTCacheRecord::allocate(size(data.numRecords(), data.codeSize(), data.dataSize()));
+   return new (ptr) CachedAOTMethod(definingClassChainRecord, aotHeaderRecord, records, data);
+   }
+
 
 bool
 JITServerAOTCache::ClassLoaderKey::operator==(const ClassLoaderKey &k) const
@@ -613,6 +667,14 @@ JITServerAOTCache::findMethod(const AOTCacheClassChainRecord *definingClassChain
    }
 
 
+size_t
+JITServerAOTCache::numCachedMethods() const
+   {
+   OMR::CriticalSection cs(_cachedMethodMonitor);
+   return _cachedMethodMap.size();
+   }
+
+
 Vector<const AOTSerializationRecord *>
 JITServerAOTCache::getSerializationRecords(const CachedAOTMethod *method, const KnownIdSet &knownIds,
                                            TR_Memory &trMemory) const
@@ -662,9 +724,423 @@ JITServerAOTCache::addRecord(const AOTCacheRecord *record, Vector<const AOTSeria
    }
 
 
+// Header of an AOT cache snapshot file. The header is followed by all the serialization records in the order
+// of their types (which is also the order of dependencies between them), and within each type in the order of
+// their IDs, so that the ID of a record is equal to its position among the records of the same type plus 1.
+// The records are followed by the serialized AOT methods. Both serialization records and serialized methods
+// are stored in the same format in which they are sent to clients.
+struct JITServerAOTCacheSnapshotHeader
+   {
+   char _eyeCatcher[sizeof(JITServerAOTCacheSnapshotEyeCatcher)];
+   uint32_t _version;
+   uint32_t _pointerSize;
+   size_t _numRecords[AOTSerializationRecordType_MAX];
+   size_t _numCachedMethods;
+   };
+
+// Upper bound on the size of an entry (serialization record or serialized method) in a snapshot file;
+// used to detect corrupted files before trying to allocate a buffer for the entry
+static const size_t MAX_SNAPSHOT_ENTRY_SIZE = (size_t)1 << 30;// 1 GB
+
+
+// Append the records in the map to the vector in the order of their IDs
+template<typename K, typename V, typename H> static void
+getRecords(const PersistentUnorderedMap<K, V *, H> &map, PersistentVector<const AOTCacheRecord *> &records)
+   {
+   size_t base = records.size();
+   records.resize(base + map.size(), NULL);
+   for (auto &kv : map)
+      {
+      uintptr_t id = kv.second->data().id();
+      TR_ASSERT((id > 0) && (id <= map.size()), "Invalid record ID %zu", id);
+      records[base + id - 1] = kv.second;
+      }
+   }
+
+bool
+JITServerAOTCache::writeCache(FILE *f) const
+   {
+   JITServerAOTCacheSnapshotHeader header = {};
+   memcpy(header._eyeCatcher, JITServerAOTCacheSnapshotEyeCatcher, sizeof(header._eyeCatcher));
+   header._version = JITServerAOTCacheSnapshotVersion;
+   header._pointerSize = sizeof(void *);
+
+   PersistentVector<const AOTCacheRecord *> records(
+      PersistentVector<const AOTCacheRecord *>::allocator_type(TR::Compiler->persistentGlobalAllocator()));
+   PersistentVector<const CachedAOTMethod *> methods(
+      PersistentVector<const CachedAOTMethod *>::allocator_type(TR::Compiler->persistentGlobalAllocator()));
+
+   // Only collect the pointers while holding the monitors, so that compilation threads are not blocked
+   // behind file I/O. Records and cached methods are immutable once added to their maps and are never
+   // removed while the cache exists, so they can be written out after the monitors are released.
+      {
+      // Monitors are always acquired one at a time by other methods, so acquiring all of them here cannot deadlock
+      OMR::CriticalSection csClassLoader(_classLoaderMonitor);
+      OMR::CriticalSection csClass(_classMonitor);
+      OMR::CriticalSection csMethod(_methodMonitor);
+      OMR::CriticalSection csClassChain(_classChainMonitor);
+      OMR::CriticalSection csWellKnownClasses(_wellKnownClassesMonitor);
+      OMR::CriticalSection csAOTHeader(_aotHeaderMonitor);
+      OMR::CriticalSection csCachedMethod(_cachedMethodMonitor);
+
+      header._numRecords[AOTSerializationRecordType::ClassLoader] = _classLoaderMap.size();
+      header._numRecords[AOTSerializationRecordType::Class] = _classMap.size();
+      header._numRecords[AOTSerializationRecordType::Method] = _methodMap.size();
+      header._numRecords[AOTSerializationRecordType::ClassChain] = _classChainMap.size();
+      header._numRecords[AOTSerializationRecordType::WellKnownClasses] = _wellKnownClassesMap.size();
+      header._numRecords[AOTSerializationRecordType::AOTHeader] = _aotHeaderMap.size();
+      header._numCachedMethods = _cachedMethodMap.size();
+
+      records.reserve(_classLoaderMap.size() + _classMap.size() + _methodMap.size() + _classChainMap.size() +
+                      _wellKnownClassesMap.size() + _aotHeaderMap.size());
+      getRecords(_classLoaderMap, records);
+      getRecords(_classMap, records);
+      getRecords(_methodMap, records);
+      getRecords(_classChainMap, records);
+      getRecords(_wellKnownClassesMap, records);
+      getRecords(_aotHeaderMap, records);
+
+      methods.reserve(_cachedMethodMap.size());
+      for (auto &kv : _cachedMethodMap)
+         methods.push_back(kv.second);
+      }
+
+   if (1 != fwrite(&header, sizeof(header), 1, f))
+      return false;
+
+   for (auto record : records)
+      {
+      const AOTSerializationRecord *data = record->dataAddr();
+      if (1 != fwrite(data, data->size(), 1, f))
+         return false;
+      }
+
+   for (auto method : methods)
+      {
+      const SerializedAOTMethod &data = method->data();
+      if (1 != fwrite(&data, data.size(), 1, f))
+         return false;
+      }
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "AOT cache %s: saved %zu methods to snapshot",
+                                     _name.c_str(), methods.size());
+   return true;
+   }
+
+
+// Read a variable-sized entry (serialization record or serialized AOT method) from a snapshot file into
+// the buffer. Both kinds of entries start with their total size, which must be at least minSize.
+static bool
+readEntry(FILE *f, std::string &buffer, size_t minSize)
+   {
+   size_t size = 0;
+   if (1 != fread(&size, sizeof(size), 1, f))
+      return false;
+   if ((size < minSize) || (size > MAX_SNAPSHOT_ENTRY_SIZE))
+      return false;
+
+   buffer.resize(size);
+   memcpy(&buffer[0], &size, sizeof(size));
+   return 1 == fread(&buffer[sizeof(size)], size - sizeof(size), 1, f);
+   }
+
+// Returns the record with the given ID loaded from a snapshot file, or NULL if the ID is invalid
+template<typename R> static R *
+getLoadedRecord(const PersistentVector<R *> &records, uintptr_t id)
+   {
+   return ((id > 0) && (id <= records.size())) ? records[id - 1] : NULL;
+   }
+
+// Fill the result with the records referred to by the list of IDs. Returns false if any of the IDs is invalid.
+template<typename R> static bool
+getLoadedRecordList(const PersistentVector<R *> &records, const IdList &list, PersistentVector<const R *> &result)
+   {
+   result.resize(list.length());
+   for (size_t i = 0; i < list.length(); ++i)
+      {
+      result[i] = getLoadedRecord(records, list.ids()[i]);
+      if (!result[i])
+         return false;
+      }
+   return true;
+   }
+
+// Find the record with the given key in the map, or create a new record with the next available ID and add it
+// to the map. Used for records loaded from a snapshot file, which can be merged into a cache that is already
+// in use. Record IDs are assigned independently by each server and are only meaningful within the snapshot,
+// so the records are deduplicated by their keys (e.g. class loader name and ROM class hash for class records).
+// The recordKey function returns the key that refers to the data owned by the newly created record.
+template<typename K, typename V, typename H, typename C, typename RK> static V *
+findOrCreateLoadedRecord(PersistentUnorderedMap<K, V *, H> &map, TR::Monitor *monitor, uintptr_t &nextId,
+                         const K &key, const C &create, const RK &recordKey)
+   {
+   OMR::CriticalSection cs(monitor);
+
+   auto it = map.find(key);
+   if (it != map.end())
+      return it->second;
+
+   V *record = create(nextId);
+   addToMap(map, it, recordKey(record), record);
+   ++nextId;
+   return record;
+   }
+
+template<typename R> bool
+JITServerAOTCache::readRecords(FILE *f, size_t numRecords, AOTSerializationRecordType type,
+                               PersistentVector<R *> &records,
+                               const std::function<R *(const AOTSerializationRecord *)> &create)
+   {
+   // Reserve memory in advance so that adding a record (which is already owned by its map) can't throw
+   records.reserve(numRecords);
+   std::string buffer;
+
+   for (size_t i = 0; i < numRecords; ++i)
+      {
+      if (!readEntry(f, buffer, sizeof(AOTSerializationRecord)))
+         return false;
+
+      const AOTSerializationRecord *data = AOTSerializationRecord::get(buffer);
+      if ((data->type() != type) || (data->id() != i + 1))
+         return false;
+
+      R *record = create(data);
+      if (!record)
+         return false;
+      records.push_back(record);
+      }
+
+   return true;
+   }
+
+bool
+JITServerAOTCache::readCachedMethods(FILE *f, size_t numMethods,
+                                     const PersistentVector<AOTCacheClassRecord *> &classRecords,
+                                     const PersistentVector<AOTCacheMethodRecord *> &methodRecords,
+                                     const PersistentVector<AOTCacheClassChainRecord *> &classChainRecords,
+                                     const PersistentVector<AOTCacheWellKnownClassesRecord *> &wellKnownClassesRecords,
+                                     const PersistentVector<AOTCacheAOTHeaderRecord *> &aotHeaderRecords,
+                                     size_t &numNewMethods)
+   {
+   PersistentVector<const AOTCacheRecord *> records(
+      PersistentVector<const AOTCacheRecord *>::allocator_type(TR::Compiler->persistentGlobalAllocator()));
+   std::string buffer;
+
+   for (size_t i = 0; i < numMethods; ++i)
+      {
+      if (!readEntry(f, buffer, sizeof(SerializedAOTMethod)))
+         return false;
+
+      const SerializedAOTMethod &data = *SerializedAOTMethod::get(buffer);
+      // Make sure that the variable-sized parts of the method fit into the entry
+      size_t maxNumRecords = (data.size() - sizeof(SerializedAOTMethod)) / sizeof(SerializedSCCOffset);
+      if ((data.numRecords() > maxNumRecords) ||
+          (data.codeSize() > data.size()) || (data.dataSize() > data.size()) ||
+          (data.data() + data.dataSize() > data.end()))
+         return false;
+
+      auto definingClassChainRecord = getLoadedRecord(classChainRecords, data.definingClassChainId());
+      auto aotHeaderRecord = getLoadedRecord(aotHeaderRecords, data.aotHeaderId());
+      if (!definingClassChainRecord || !aotHeaderRecord)
+         return false;
+
+      records.resize(data.numRecords());
+      for (size_t j = 0; j < data.numRecords(); ++j)
+         {
+         const SerializedSCCOffset &offset = data.offsets()[j];
+         switch (offset.recordType())
+            {
+            case AOTSerializationRecordType::Class:
+               records[j] = getLoadedRecord(classRecords, offset.recordId());
+               break;
+            case AOTSerializationRecordType::Method:
+               records[j] = getLoadedRecord(methodRecords, offset.recordId());
+               break;
+            case AOTSerializationRecordType::ClassChain:
+               records[j] = getLoadedRecord(classChainRecords, offset.recordId());
+               break;
+            case AOTSerializationRecordType::WellKnownClasses:
+               records[j] = getLoadedRecord(wellKnownClassesRecords, offset.recordId());
+               break;
+            default:
+               records[j] = NULL;
+               break;
+            }
+         if (!records[j])
+            return false;
+         }
+
+      CachedMethodKey key(definingClassChainRecord, data.index(), data.optLevel(), aotHeaderRecord);
+      OMR::CriticalSection cs(_cachedMethodMonitor);
+
+      // Keep the version of the method that is already in the cache (see the comment in storeMethod())
+      auto it = _cachedMethodMap.find(key);
+      if (it != _cachedMethodMap.end())
+         continue;
+
+      auto method = CachedAOTMethod::create(definingClassChainRecord, aotHeaderRecord, records.data(), data);
+      addToMap(_cachedMethodMap, it, key, method);
+      ++numNewMethods;
+      }
+
+   return true;
+   }
+
+bool
+JITServerAOTCache::readCache(FILE *f)
+   {
+   JITServerAOTCacheSnapshotHeader header;
+   if (1 != fread(&header, sizeof(header), 1, f))
+      return false;
+   if ((0 != memcmp(header._eyeCatcher, JITServerAOTCacheSnapshotEyeCatcher, sizeof(header._eyeCatcher))) ||
+       (header._version != JITServerAOTCacheSnapshotVersion) || (header._pointerSize != sizeof(void *)))
+      return false;
+
+   // Each of these vectors maps the record IDs in the snapshot to the corresponding records in this cache
+   auto &allocator = TR::Compiler->persistentGlobalAllocator();
+   PersistentVector<AOTCacheClassLoaderRecord *> classLoaderRecords(
+      PersistentVector<AOTCacheClassLoaderRecord *>::allocator_type(allocator));
+   PersistentVector<AOTCacheClassRecord *> classRecords(
+      PersistentVector<AOTCacheClassRecord *>::allocator_type(allocator));
+   PersistentVector<AOTCacheMethodRecord *> methodRecords(
+      PersistentVector<AOTCacheMethodRecord *>::allocator_type(allocator));
+   PersistentVector<AOTCacheClassChainRecord *> classChainRecords(
+      PersistentVector<AOTCacheClassChainRecord *>::allocator_type(allocator));
+   PersistentVector<AOTCacheWellKnownClassesRecord *> wellKnownClassesRecords(
+      PersistentVector<AOTCacheWellKnownClassesRecord *>::allocator_type(allocator));
+   PersistentVector<AOTCacheAOTHeaderRecord *> aotHeaderRecords(
+      PersistentVector<AOTCacheAOTHeaderRecord *>::allocator_type(allocator));
+   PersistentVector<const AOTCacheClassRecord *> classList(
+      PersistentVector<const AOTCacheClassRecord *>::allocator_type(allocator));
+   PersistentVector<const AOTCacheClassChainRecord *> classChainList(
+      PersistentVector<const AOTCacheClassChainRecord *>::allocator_type(allocator));
+   size_t numNewMethods = 0;
+
+   //NOTE: Each record is owned by its map as soon as it is created, and only depends on records that are
+   //      already in the cache. If the snapshot turns out to be invalid, the records merged so far are valid
+   //      and stay in the cache; they are freed by the destructor.
+   bool success =
+   readRecords<AOTCacheClassLoaderRecord>(f, header._numRecords[AOTSerializationRecordType::ClassLoader],
+      AOTSerializationRecordType::ClassLoader, classLoaderRecords,
+      [&](const AOTSerializationRecord *r) -> AOTCacheClassLoaderRecord *
+         {
+         auto &data = *(const ClassLoaderSerializationRecord *)r;
+         if ((data.size() < sizeof(data)) || (data.nameLength() > data.size() - sizeof(data)))
+            return NULL;
+         return findOrCreateLoadedRecord(_classLoaderMap, _classLoaderMonitor, _nextClassLoaderId,
+            ClassLoaderKey{ data.name(), data.nameLength() },
+            [&](uintptr_t id) { return AOTCacheClassLoaderRecord::create(id, data.name(), data.nameLength()); },
+            [](const AOTCacheClassLoaderRecord *record)
+               { return ClassLoaderKey{ record->data().name(), record->data().nameLength() }; });
+         }) &&
+   readRecords<AOTCacheClassRecord>(f, header._numRecords[AOTSerializationRecordType::Class],
+      AOTSerializationRecordType::Class, classRecords,
+      [&](const AOTSerializationRecord *r) -> AOTCacheClassRecord *
+         {
+         auto &data = *(const ClassSerializationRecord *)r;
+         if ((data.size() < sizeof(data)) || (data.nameLength() > data.size() - sizeof(data)))
+            return NULL;
+         auto classLoaderRecord = getLoadedRecord(classLoaderRecords, data.classLoaderId());
+         if (!classLoaderRecord)
+            return NULL;
+         return findOrCreateLoadedRecord(_classMap, _classMonitor, _nextClassId,
+            ClassKey{ classLoaderRecord, &data.hash() },
+            [&](uintptr_t id) { return AOTCacheClassRecord::create(id, classLoaderRecord, data); },
+            [](const AOTCacheClassRecord *record)
+               { return ClassKey{ record->classLoaderRecord(), &record->data().hash() }; });
+         }) &&
+   readRecords<AOTCacheMethodRecord>(f, header._numRecords[AOTSerializationRecordType::Method],
+      AOTSerializationRecordType::Method, methodRecords,
+      [&](const AOTSerializationRecord *r) -> AOTCacheMethodRecord *
+         {
+         auto &data = *(const MethodSerializationRecord *)r;
+         if (data.size() < sizeof(data))
+            return NULL;
+         auto definingClassRecord = getLoadedRecord(classRecords, data.definingClassId());
+         if (!definingClassRecord)
+            return NULL;
+         MethodKey key(definingClassRecord, data.index());
+         return findOrCreateLoadedRecord(_methodMap, _methodMonitor, _nextMethodId, key,
+            [&](uintptr_t id) { return AOTCacheMethodRecord::create(id, definingClassRecord, data.index()); },
+            [&](const AOTCacheMethodRecord *) { return key; });
+         }) &&
+   readRecords<AOTCacheClassChainRecord>(f, header._numRecords[AOTSerializationRecordType::ClassChain],
+      AOTSerializationRecordType::ClassChain, classChainRecords,
+      [&](const AOTSerializationRecord *r) -> AOTCacheClassChainRecord *
+         {
+         auto &data = *(const ClassChainSerializationRecord *)r;
+         if ((data.size() < sizeof(data)) ||
+             (data.list().length() > (data.size() - sizeof(data)) / sizeof(uintptr_t)) ||
+             !getLoadedRecordList(classRecords, data.list(), classList))
+            return NULL;
+         return findOrCreateLoadedRecord(_classChainMap, _classChainMonitor, _nextClassChainId,
+            ClassChainKey{ classList.data(), classList.size() },
+            [&](uintptr_t id) { return AOTCacheClassChainRecord::create(id, classList.data(), classList.size()); },
+            [&](const AOTCacheClassChainRecord *record) { return ClassChainKey{ record->records(), classList.size() }; });
+         }) &&
+   readRecords<AOTCacheWellKnownClassesRecord>(f, header._numRecords[AOTSerializationRecordType::WellKnownClasses],
+      AOTSerializationRecordType::WellKnownClasses, wellKnownClassesRecords,
+      [&](const AOTSerializationRecord *r) -> AOTCacheWellKnownClassesRecord *
+         {
+         auto &data = *(const WellKnownClassesSerializationRecord *)r;
+         if ((data.size() < sizeof(data)) ||
+             (data.list().length() > (data.size() - sizeof(data)) / sizeof(uintptr_t)) ||
+             !getLoadedRecordList(classChainRecords, data.list(), classChainList))
+            return NULL;
+         return findOrCreateLoadedRecord(_wellKnownClassesMap, _wellKnownClassesMonitor, _nextWellKnownClassesId,
+            WellKnownClassesKey{ classChainList.data(), classChainList.size(), data.includedClasses() },
+            [&](uintptr_t id)
+               {
+               return AOTCacheWellKnownClassesRecord::create(id, classChainList.data(),
+                                                             classChainList.size(), data.includedClasses());
+               },
+            [&](const AOTCacheWellKnownClassesRecord *record)
+               { return WellKnownClassesKey{ record->records(), classChainList.size(), data.includedClasses() }; });
+         }) &&
+   readRecords<AOTCacheAOTHeaderRecord>(f, header._numRecords[AOTSerializationRecordType::AOTHeader],
+      AOTSerializationRecordType::AOTHeader, aotHeaderRecords,
+      [&](const AOTSerializationRecord *r) -> AOTCacheAOTHeaderRecord *
+         {
+         auto &data = *(const AOTHeaderSerializationRecord *)r;
+         if (data.size() < sizeof(data))
+            return NULL;
+         return findOrCreateLoadedRecord(_aotHeaderMap, _aotHeaderMonitor, _nextAOTHeaderId,
+            AOTHeaderKey{ data.header() },
+            [&](uintptr_t id) { return AOTCacheAOTHeaderRecord::create(id, data.header()); },
+            [](const AOTCacheAOTHeaderRecord *record) { return AOTHeaderKey{ record->data().header() }; });
+         }) &&
+   readCachedMethods(f, header._numCachedMethods, classRecords, methodRecords,
+                     classChainRecords, wellKnownClassesRecords, aotHeaderRecords, numNewMethods);
+
+   if (!success)
+      return false;
+
+   if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+         "AOT cache %s: loaded %zu new methods (%zu already cached) and %zu classes from snapshot",
+         _name.c_str(), numNewMethods, header._numCachedMethods - numNewMethods, classRecords.size()
+      );
+   return true;
+   }
+
+
+// Generate a random identifier for this server's peer snapshot files; collisions are very unlikely
+static uint64_t
+generateServerUID()
+   {
+   std::random_device rd;
+   std::mt19937_64 rng(rd());
+   std::uniform_int_distribution<uint64_t> dist;
+   return dist(rng);
+   }
+
 JITServerAOTCacheMap::JITServerAOTCacheMap() :
    _map(decltype(_map)::allocator_type(TR::Compiler->persistentGlobalAllocator())),
-   _monitor(TR::Monitor::create("JIT-JITServerAOTCacheMapMonitor"))
+   _monitor(TR::Monitor::create("JIT-JITServerAOTCacheMapMonitor")),
+   _serverUID(generateServerUID()),
+   _numExportedMethods(decltype(_numExportedMethods)::allocator_type(TR::Compiler->persistentGlobalAllocator())),
+   _peerSnapshotTimes(decltype(_peerSnapshotTimes)::allocator_type(TR::Compiler->persistentGlobalAllocator()))
    {
    if (!_monitor)
       throw std::bad_alloc();
@@ -684,21 +1160,46 @@ JITServerAOTCacheMap::~JITServerAOTCacheMap()
 JITServerAOTCache *
 JITServerAOTCacheMap::get(const std::string &name, uint64_t clientUID)
    {
+      {
+      OMR::CriticalSection cs(_monitor);
+
+      auto it = _map.find(name);
+      if (it != _map.end())
+         {
+         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Using existing AOT cache %s for clientUID %llu",
+                                           name.c_str(), (unsigned long long)clientUID);
+         return it->second;
+         }
+      }
+
+   // Load the snapshot without holding the monitor, so that lookups of other caches are not blocked by file I/O
+   JITServerAOTCache *cache = NULL;
+   if (TR::CompilationInfo::get()->getPersistentInfo()->getJITServerAOTCachePersistence())
+      {
+      if (isValidSnapshotName(name))
+         cache = loadCache(name);
+      else if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer,
+                                        "AOT cache name %s cannot be used in a file name; the cache will not be persisted",
+                                        name.c_str());
+      }
+   if (!cache)
+      cache = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCache(name);
+   if (!cache)
+      throw std::bad_alloc();
+
    OMR::CriticalSection cs(_monitor);
 
+   // Another thread could have created the same cache while this one was loading the snapshot
    auto it = _map.find(name);
    if (it != _map.end())
       {
-      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Created AOT cache %s for clientUID %llu",
-                                        name.c_str(), (unsigned long long)clientUID);
+      cache->~JITServerAOTCache();
+      TR::Compiler->persistentGlobalMemory()->freePersistentMemory(cache);
       return it->second;
       }
 
-   auto cache = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCache(name);
-   if (!cache)
-      throw std::bad_alloc();
-
    try
       {
       _map.insert(it, { name, cache });
@@ -711,7 +1212,228 @@ JITServerAOTCacheMap::get(const std::string &name, uint64_t clientUID)
       }
 
    if (TR::Options::getVerboseOption(TR_VerboseJITServer))
-      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Using existing AOT cache %s for clientUID %llu",
+      TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "Created AOT cache %s for clientUID %llu",
                                      name.c_str(), (unsigned long long)clientUID);
    return cache;
    }
+
+bool
+JITServerAOTCacheMap::isValidSnapshotName(const std::string &name)
+   {
+   // The name is supplied by clients and becomes part of a file name in the snapshot directory;
+   // reject anything that could refer to a file outside of it
+   return (name.find_first_of(std::string("/\\\0", 3)) == std::string::npos) &&
+          (name.find("..") == std::string::npos);
+   }
+
+static const char JITServerAOTCacheFilePrefix[] = "JITServerAOTCache.";
+static const char JITServerAOTCacheFileSuffix[] = ".J9";
+static const size_t SERVER_UID_DIGITS = 2 * sizeof(uint64_t);
+
+static std::string
+snapshotDir()
+   {
+   const std::string &dir = TR::CompilationInfo::get()->getPersistentInfo()->getJITServerAOTCacheDir();
+   return dir.empty() ? std::string(".") : dir;
+   }
+
+std::string
+JITServerAOTCacheMap::snapshotFileName(const std::string &name) const
+   {
+   return snapshotDir() + "/" + JITServerAOTCacheFilePrefix + name + JITServerAOTCacheFileSuffix;
+   }
+
+std::string
+JITServerAOTCacheMap::peerSnapshotFileName(const std::string &name, uint64_t serverUID) const
+   {
+   char uid[SERVER_UID_DIGITS + 1];
+   snprintf(uid, sizeof(uid), "%016llx", (unsigned long long)serverUID);
+   return snapshotDir() + "/" + JITServerAOTCacheFilePrefix + name + "." + uid + JITServerAOTCacheFileSuffix;
+   }
+
+bool
+JITServerAOTCacheMap::parsePeerSnapshotFileName(const char *fileName, std::string &name, uint64_t &serverUID)
+   {
+   // Peer snapshot file name format: JITServerAOTCache.<name>.<16 hex digits of server UID>.J9
+   size_t prefixLength = sizeof(JITServerAOTCacheFilePrefix) - 1;
+   size_t suffixLength = sizeof(JITServerAOTCacheFileSuffix) - 1;
+   size_t length = strlen(fileName);
+   if ((length <= prefixLength + 1 + SERVER_UID_DIGITS + suffixLength) ||
+       (0 != strncmp(fileName, JITServerAOTCacheFilePrefix, prefixLength)) ||
+       (0 != strcmp(fileName + length - suffixLength, JITServerAOTCacheFileSuffix)))
+      return false;
+
+   const char *uid = fileName + length - suffixLength - SERVER_UID_DIGITS;
+   if (uid[-1] != '.')
+      return false;
+   serverUID = 0;
+   for (size_t i = 0; i < SERVER_UID_DIGITS; ++i)
+      {
+      char c = uid[i];
+      uint64_t digit;
+      if ((c >= '0') && (c <= '9'))
+         digit = c - '0';
+      else if ((c >= 'a') && (c <= 'f'))
+         digit = c - 'a' + 10;
+      else
+         return false;
+      serverUID = (serverUID << 4) | digit;
+      }
+
+   name.assign(fileName + prefixLength, uid - 1 - (fileName + prefixLength));
+   return true;
+   }
+
+JITServerAOTCache *
+JITServerAOTCacheMap::loadCache(const std::string &name)
+   {
+   std::string fileName = snapshotFileName(name);
+   struct stat st;
+   if (0 != stat(fileName.c_str(), &st))
+      return NULL;
+
+   auto cache = new (TR::Compiler->persistentGlobalMemory()) JITServerAOTCache(name);
+   if (!cache)
+      throw std::bad_alloc();
+
+   if (!importCache(cache, fileName))
+      {
+      // Discard the partially loaded cache; the caller will start with an empty one
+      cache->~JITServerAOTCache();
+      TR::Compiler->persistentGlobalMemory()->freePersistentMemory(cache);
+      cache = NULL;
+
+      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "ERROR: Failed to load AOT cache %s from snapshot %s",
+                                        name.c_str(), fileName.c_str());
+      }
+
+   return cache;
+   }
+
+bool
+JITServerAOTCacheMap::importCache(JITServerAOTCache *cache, const std::string &fileName)
+   {
+   FILE *f = fopen(fileName.c_str(), "rb");
+   if (!f)
+      return false;
+
+   bool success = false;
+   try
+      {
+      success = cache->readCache(f);
+      }
+   catch (const std::bad_alloc &)
+      {
+      success = false;
+      }
+   fclose(f);
+   return success;
+   }
+
+bool
+JITServerAOTCacheMap::saveCache(const JITServerAOTCache *cache, const std::string &fileName)
+   {
+   // Write to a temporary file first, so that a failure or a crash while saving the snapshot
+   // does not destroy the previous version of the snapshot file, and other servers that
+   // read the file concurrently never see a partially written snapshot
+   std::string tmpFileName = fileName + ".tmp";
+
+   bool success = false;
+   if (FILE *f = fopen(tmpFileName.c_str(), "wb"))
+      {
+      success = cache->writeCache(f);
+      success = (0 == fclose(f)) && success;
+      }
+   success = success && (0 == rename(tmpFileName.c_str(), fileName.c_str()));
+
+   if (!success)
+      {
+      remove(tmpFileName.c_str());
+      if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+         TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "ERROR: Failed to save AOT cache %s to snapshot %s",
+                                        cache->name().c_str(), fileName.c_str());
+      }
+   return success;
+   }
+
+void
+JITServerAOTCacheMap::saveCaches()
+   {
+   // Caches are never removed from the map, so they can be saved after releasing the monitor
+   PersistentVector<JITServerAOTCache *> caches(
+      PersistentVector<JITServerAOTCache *>::allocator_type(TR::Compiler->persistentGlobalAllocator()));
+      {
+      OMR::CriticalSection cs(_monitor);
+      caches.reserve(_map.size());
+      for (auto &kv : _map)
+         caches.push_back(kv.second);
+      }
+
+   for (auto cache : caches)
+      if (isValidSnapshotName(cache->name()))
+         saveCache(cache, snapshotFileName(cache->name()));
+   }
+
+void
+JITServerAOTCacheMap::syncCaches()
+   {
+   // Caches are never removed from the map, so they can be used after releasing the monitor
+   PersistentVector<JITServerAOTCache *> caches(
+      PersistentVector<JITServerAOTCache *>::allocator_type(TR::Compiler->persistentGlobalAllocator()));
+      {
+      OMR::CriticalSection cs(_monitor);
+      caches.reserve(_map.size());
+      for (auto &kv : _map)
+         caches.push_back(kv.second);
+      }
+
+   // Caches imported from peers are not exported until the next call; re-exporting methods
+   // received from other servers is harmless since they are deduplicated when merged
+   if (DIR *dir = opendir(snapshotDir().c_str()))
+      {
+      while (struct dirent *entry = readdir(dir))
+         {
+         std::string name;
+         uint64_t serverUID = 0;
+         if (!parsePeerSnapshotFileName(entry->d_name, name, serverUID) || (serverUID == _serverUID))
+            continue;
+
+         std::string fileName = snapshotDir() + "/" + entry->d_name;
+         struct stat st;
+         if (0 != stat(fileName.c_str(), &st))
+            continue;
+         uint64_t mtime = (uint64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+         auto it = _peerSnapshotTimes.find(fileName);
+         if ((it != _peerSnapshotTimes.end()) && (it->second == mtime))
+            continue;
+         bool success = false;
+         try
+            {
+            // Don't retry a corrupted file until the peer replaces it
+            _peerSnapshotTimes[fileName] = mtime;
+            success = importCache(get(name, 0), fileName);
+            }
+         catch (const std::bad_alloc &)
+            {
+            success = false;
+            }
+         if (TR::Options::getVerboseOption(TR_VerboseJITServer))
+            TR_VerboseLog::writeLineLocked(TR_Vlog_JITServer, "%sAOT cache %s: %s peer snapshot %s",
+                                           success ? "" : "ERROR: ", name.c_str(),
+                                           success ? "merged" : "failed to merge", fileName.c_str());
+         }
+      closedir(dir);
+      }
+
+   for (auto cache : caches)
+      {
+      size_t numMethods = cache->numCachedMethods();
+      auto it = _numExportedMethods.find(cache->name());
+      if (((it != _numExportedMethods.end()) && (it->second == numMethods)) || !isValidSnapshotName(cache->name()))
+         continue;
+
+      if (saveCache(cache, peerSnapshotFileName(cache->name(), _serverUID)))
+         _numExportedMethods[cache->name()] = numMethods;
+      }
+   }
@@ -23,6 +23,7 @@
 #ifndef JITSERVER_AOTCACHE_H
 #define JITSERVER_AOTCACHE_H
 
+#include <cstdio>
 #include <functional>
 
 #include "env/TRMemory.hpp"
@@ -98,11 +99,16 @@ public:
 
    static AOTCacheClassRecord *create(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
                                       const JITServerROMClassHash &hash, const J9ROMClass *romClass);
+   // Used to re-create a class record loaded from an AOT cache snapshot file
+   static AOTCacheClassRecord *create(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
+                                      const ClassSerializationRecord &data);
    void subRecordsDo(const std::function<void(const AOTCacheRecord *)> &f) const override;
 
 private:
    AOTCacheClassRecord(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
                        const JITServerROMClassHash &hash, const J9ROMClass *romClass);
+   AOTCacheClassRecord(uintptr_t id, const AOTCacheClassLoaderRecord *classLoaderRecord,
+                       const ClassSerializationRecord &data);
 
    static size_t size(size_t nameLength)
       {
@@ -212,8 +218,16 @@ public:
                                   TR_Hotness optLevel, const AOTCacheAOTHeaderRecord *aotHeaderRecord,
                                   const Vector<std::pair<const AOTCacheRecord *, uintptr_t>> &records,
                                   const void *code, size_t codeSize, const void *data, size_t dataSize);
+   // Used to re-create a cached method loaded from an AOT cache snapshot file.
+   // The records array corresponds to the array of SCC offsets in the serialized method.
+   static CachedAOTMethod *create(const AOTCacheClassChainRecord *definingClassChainRecord,
+                                  const AOTCacheAOTHeaderRecord *aotHeaderRecord,
+                                  const AOTCacheRecord *const *records, const SerializedAOTMethod &data);
 
 private:
+   CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord,
+                   const AOTCacheAOTHeaderRecord *aotHeaderRecord,
+                   const AOTCacheRecord *const *records, const SerializedAOTMethod &data);
    CachedAOTMethod(const AOTCacheClassChainRecord *definingClassChainRecord, uint32_t index,
                    TR_Hotness optLevel, const AOTCacheAOTHeaderRecord *aotHeaderRecord,
                    const Vector<std::pair<const AOTCacheRecord *, uintptr_t>> &records,
@@ -281,6 +295,16 @@ public:
    Vector<const AOTSerializationRecord *>
    getSerializationRecords(const CachedAOTMethod *method, const KnownIdSet &knownIds, TR_Memory &trMemory) const;
 
+   size_t numCachedMethods() const;
+
+   // Write a snapshot of the whole cache (all serialization records and cached methods) to the file.
+   // Returns false if an I/O error occurs.
+   bool writeCache(FILE *f) const;
+   // Merge a snapshot previously written with writeCache() (possibly by another server) into this cache,
+   // which can already be in use. Records and methods that already exist in this cache are not duplicated.
+   // Returns false if the file is truncated, corrupted or was written by an incompatible version.
+   bool readCache(FILE *f);
+
 private:
    struct ClassLoaderKey
       {
@@ -338,6 +362,18 @@ private:
    void addRecord(const AOTCacheRecord *record, Vector<const AOTSerializationRecord *> &result,
                   UnorderedSet<const AOTCacheRecord *> &newRecords, const KnownIdSet &knownIds) const;
 
+   // Helper methods used in readCache()
+   template<typename R> bool readRecords(FILE *f, size_t numRecords, AOTSerializationRecordType type,
+                                         PersistentVector<R *> &records,
+                                         const std::function<R *(const AOTSerializationRecord *)> &create);
+   bool readCachedMethods(FILE *f, size_t numMethods,
+                          const PersistentVector<AOTCacheClassRecord *> &classRecords,
+                          const PersistentVector<AOTCacheMethodRecord *> &methodRecords,
+                          const PersistentVector<AOTCacheClassChainRecord *> &classChainRecords,
+                          const PersistentVector<AOTCacheWellKnownClassesRecord *> &wellKnownClassesRecords,
+                          const PersistentVector<AOTCacheAOTHeaderRecord *> &aotHeaderRecords,
+                          size_t &numNewMethods);
+
    const std::string _name;
 
    PersistentUnorderedMap<ClassLoaderKey, AOTCacheClassLoaderRecord *, ClassLoaderKey::Hash> _classLoaderMap;
@@ -381,9 +417,41 @@ public:
 
    JITServerAOTCache *get(const std::string &name, uint64_t clientUID);
 
+   // Save all AOT caches in the map to snapshot files in the configured directory.
+   // Should only be called at shutdown, after compilation threads have been stopped.
+   void saveCaches();
+
+   // Exchange AOT cache contents with other servers that use the same AOT cache directory.
+   // Each cache that has new methods since the last call is saved to this server's peer snapshot file,
+   // and peer snapshot files written by other servers since the last call are merged into the caches
+   // with the same names. Can be called while the caches are in use, but only by one thread at a time.
+   void syncCaches();
+
 private:
+   // Returns the path of the snapshot file for the AOT cache with this name
+   std::string snapshotFileName(const std::string &name) const;
+   // Returns the path of the snapshot file that the server with this UID shares with its peers
+   std::string peerSnapshotFileName(const std::string &name, uint64_t serverUID) const;
+   // Extracts the AOT cache name and the server UID from a peer snapshot file name;
+   // returns false if this is not a peer snapshot file
+   static bool parsePeerSnapshotFileName(const char *fileName, std::string &name, uint64_t &serverUID);
+   // Returns false if the AOT cache name cannot be safely used as part of a snapshot file name
+   static bool isValidSnapshotName(const std::string &name);
+   // Returns a new AOT cache loaded from its snapshot file, or NULL if the file doesn't exist or is invalid
+   JITServerAOTCache *loadCache(const std::string &name);
+   // Writes the snapshot of the cache to a temporary file which is then renamed to fileName
+   static bool saveCache(const JITServerAOTCache *cache, const std::string &fileName);
+   // Merges the snapshot file into the cache; returns false if the file cannot be read or is invalid
+   static bool importCache(JITServerAOTCache *cache, const std::string &fileName);
+
    PersistentUnorderedMap<std::string, JITServerAOTCache *> _map;
    TR::Monitor *const _monitor;
+
+   // Identifies the peer snapshot files written by this server
+   const uint64_t _serverUID;
+   // Only accessed by the thread that calls syncCaches()
+   PersistentUnorderedMap<std::string, size_t> _numExportedMethods;// cache name -> number of methods when last exported
+   PersistentUnorderedMap<std::string, uint64_t> _peerSnapshotTimes;// file name -> modification time (ns) when last imported
    };
 
 
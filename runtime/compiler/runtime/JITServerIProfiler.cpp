@@ -221,7 +221,8 @@ JITServerIProfiler::profilingSample(TR_OpaqueMethodBlock *method, uint32_t byteC
             bool isCompiledWhenProfiling = false;
             if(!entryFromPerCompilationCache)
                {
-               auto & j9methodMap = clientSessionData->getJ9MethodMap();
+               ClientSessionData::J9MethodMapCriticalSection methodMap(clientSessionData, (J9Method*)method);
+               auto & j9methodMap = methodMap.map();
                auto it = j9methodMap.find((J9Method*)method);
                if (it != j9methodMap.end())
                   {
@@ -504,7 +505,7 @@ JITServerIProfiler::setCallCount(TR_OpaqueMethodBlock *method, int32_t bcIndex,
    auto compInfoPT = (TR::CompilationInfoPerThreadRemote *) TR::compInfoPT;
    if (_useCaching)
       {
-      OMR::CriticalSection getRemoteROMClass(clientData->getROMMapMonitor());
+      ClientSessionData::ROMMapCriticalSection getRemoteROMClass(clientData);
       bool methodInfoPresentInHeap = false;
       // Check persistent cache first, then per-compilation cache
       TR_IPBytecodeHashTableEntry *entry = clientData->getCachedIProfilerInfo(method, bcIndex, &methodInfoPresentInPersistent);
@@ -22,6 +22,7 @@
 
 #include "runtime/JITServerStatisticsThread.hpp"
 #include "runtime/JITClientSession.hpp" // for purgeOldDataIfNeeded()
+#include "runtime/JITServerAOTCache.hpp" // for syncCaches()
 #include "env/VMJ9.h" // for TR_JitPrivateConfig
 #include "env/VerboseLog.hpp"
 #include "control/CompilationRuntime.hpp" // for CompilatonInfo
@@ -76,6 +77,7 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
    uint64_t lastStatsTime = crtTime;
    uint64_t lastPurgeTime = crtTime;
    uint64_t lastCpuUpdate = crtTime;
+   uint64_t lastAOTCacheSyncTime = crtTime;
 
    persistentInfo->setStartTime(crtTime);
    persistentInfo->setElapsedTime(0);
@@ -99,6 +101,15 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
             compInfo->getClientSessionHT()->purgeOldDataIfNeeded();
             }     
 
+         // Periodically exchange AOT cache contents with other servers sharing the AOT cache directory
+         uint32_t aotCacheSyncPeriod = persistentInfo->getJITServerAOTCacheSyncPeriod();
+         if (compInfo->getJITServerAOTCacheMap() && (aotCacheSyncPeriod != 0) &&
+             (crtTime - lastAOTCacheSyncTime >= aotCacheSyncPeriod))
+            {
+            lastAOTCacheSyncTime = crtTime;
+            compInfo->getJITServerAOTCacheMap()->syncCaches();
+            }
+
          // Print operational statistics to vlog if enabled
          CpuUtilization *cpuUtil = compInfo->getCpuUtil(); 
          if ((statsThreadObj->getStatisticsFrequency() != 0) && ((crtTime - lastStatsTime) > statsThreadObj->getStatisticsFrequency()))
@@ -112,6 +123,12 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
                avgCpuUsage = cpuUtil->getAvgCpuUsage();
                vmCpuUsage = cpuUtil->getVmCpuUsage();
                }
+            // Contention on the per-client caches shared by all compilation threads working for that client
+            ClientSessionData::LockStats romMapStats, j9MethodMapStats;
+               {
+               OMR::CriticalSection compilationMonitorLock(compInfo->getCompilationMonitor());
+               compInfo->getClientSessionHT()->getLockStats(romMapStats, j9MethodMapStats);
+               }
             TR_VerboseLog::vlogAcquire();
             TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Number of clients : %u", compInfo->getClientSessionHT()->size());
             TR_VerboseLog::writeLine(TR_Vlog_JITServer, "Total compilation threads : %d", compInfo->getNumUsableCompilationThreads());
@@ -122,6 +139,10 @@ static int32_t J9THREAD_PROC statisticsThreadProc(void * entryarg)
                {
                TR_VerboseLog::writeLine(TR_Vlog_JITServer, "CpuLoad %d%% (AvgUsage %d%%) JvmCpu %d%%", cpuUsage, avgCpuUsage, vmCpuUsage);
                }
+            TR_VerboseLog::writeLine(TR_Vlog_JITServer, "ROM class map lock: %llu acquisitions, %llu contended",
+                                     (unsigned long long)romMapStats._numAcquisitions, (unsigned long long)romMapStats._numContended);
+            TR_VerboseLog::writeLine(TR_Vlog_JITServer, "J9Method map locks: %llu acquisitions, %llu contended",
+                                     (unsigned long long)j9MethodMapStats._numAcquisitions, (unsigned long long)j9MethodMapStats._numContended);
             TR_VerboseLog::vlogRelease();
             lastStatsTime = crtTime;
             }
@@ -41,6 +41,8 @@
 #include "GlobalCollector.hpp"
 #include "HeapMap.hpp"
 #include "ClassLoaderRememberedSet.hpp"
+#include "ParallelDispatcher.hpp"
+#include "ParallelTask.hpp"
 
 #if defined(J9VM_GC_REALTIME)
 extern "C" {
@@ -48,6 +50,67 @@ void classLoaderLoadHook(J9HookInterface** hook, UDATA eventNum, void* eventData
 }
 #endif /* defined(J9VM_GC_REALTIME) */
 
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+/* Minimum number of class segments (anonymous classes plus dying class loaders) for dying classes to be found in parallel */
+#define PARALLEL_CLASS_UNLOADING_THRESHOLD 256
+
+/**
+ * Finds the classes to be unloaded using all GC threads. Each GC thread marks the classes of the RAM class segments
+ * it claims as dying and collects them on its own pair of lists, which the main thread merges once the task completes.
+ */
+class MM_ClassUnloadingTask : public MM_ParallelTask
+{
+	/* Data Members */
+private:
+	MM_ClassLoaderManager *_classLoaderManager;
+	J9ClassLoader *_classLoaderUnloadList; /**< the linked list of loaders to unload, connected through the unloadLink field */
+	MM_HeapMap *_markMap; /**< the markMap to use to test for classes liveness */
+	MM_DyingClassList *_dyingClassLists; /**< per worker lists of classes of dying class loaders */
+	MM_DyingClassList *_dyingAnonymousClassLists; /**< per worker lists of dying anonymous classes */
+protected:
+public:
+
+	/* Member Functions */
+private:
+protected:
+public:
+	virtual UDATA getVMStateID(void) { return OMRVMSTATE_GC_CLEANING_METADATA; }
+
+	virtual void
+	run(MM_EnvironmentBase *env)
+	{
+		UDATA workerID = env->getWorkerID();
+		_classLoaderManager->findDyingClasses(env, _classLoaderUnloadList, _markMap, &_dyingClassLists[workerID], &_dyingAnonymousClassLists[workerID], true);
+	}
+
+	MM_ClassUnloadingTask(MM_EnvironmentBase *env, MM_ParallelDispatcher *dispatcher, MM_ClassLoaderManager *classLoaderManager, J9ClassLoader *classLoaderUnloadList, MM_HeapMap *markMap, MM_DyingClassList *dyingClassLists, MM_DyingClassList *dyingAnonymousClassLists)
+		: MM_ParallelTask(env, dispatcher)
+		, _classLoaderManager(classLoaderManager)
+		, _classLoaderUnloadList(classLoaderUnloadList)
+		, _markMap(markMap)
+		, _dyingClassLists(dyingClassLists)
+		, _dyingAnonymousClassLists(dyingAnonymousClassLists)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+/**
+ * Hash table callbacks for the set of ROM classes of dying anonymous classes
+ */
+static UDATA
+dyingROMClassHash(void *entry, void *userData)
+{
+	return ((UDATA)*(J9ROMClass **)entry) >> 3;
+}
+
+static UDATA
+dyingROMClassEqual(void *leftEntry, void *rightEntry, void *userData)
+{
+	return *(J9ROMClass **)leftEntry == *(J9ROMClass **)rightEntry;
+}
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
 MM_ClassLoaderManager *
 MM_ClassLoaderManager::newInstance(MM_EnvironmentBase *env, MM_GlobalCollector *globalCollector)
 {	
@@ -319,33 +382,62 @@ MM_ClassLoaderManager::cleanUpClassLoadersStart(MM_EnvironmentBase *env, J9Class
 	 */
 	Assert_MM_true(markMap->isBitSet(_javaVM->booleanArrayClass->classObject));
 
+	/* Mark all dying class loaders as dead */
+	J9ClassLoader * classLoader = classLoaderUnloadList;
+	while (NULL != classLoader) {
+		Assert_MM_true( 0 == (classLoader->gcFlags & J9_GC_CLASS_LOADER_SCANNED) );
+		classLoaderUnloadCount += 1;
+		classLoader->gcFlags |= J9_GC_CLASS_LOADER_DEAD;
+		classLoader = classLoader->unloadLink;
+	}
+
 	/*
-	 * Walk anonymous classes and set unmarked as dying
+	 * Find unmarked anonymous classes and all classes of dying class loaders, and set them as dying.
 	 *
-	 * Do this walk before classloaders to be unloaded walk to create list of anonymous classes to be unloaded and use it
-	 * as sublist to continue to build general list of classes to be unloaded
+	 * Anonymous classes are kept on their own list, which becomes the tail of the general list of classes to be unloaded.
 	 *
 	 * Anonymous classes suppose to be allocated one per segment
 	 * This is not relevant here however becomes important at segment removal time
 	 */
-	anonymousClassUnloadList = addDyingClassesToList(env, _javaVM->anonClassLoader, markMap, false, anonymousClassUnloadList, &anonymousClassUnloadCount);
+	MM_DyingClassList dyingClasses;
+	MM_DyingClassList dyingAnonymousClasses;
+	dyingClasses.clear();
+	dyingAnonymousClasses.clear();
+
+	bool parallel = false;
+	UDATA threadCount = _extensions->gcThreadCount;
+	if ((threadCount > 1) && ((_javaVM->anonClassCount + classLoaderUnloadCount) >= PARALLEL_CLASS_UNLOADING_THRESHOLD)) {
+		MM_DyingClassList *dyingClassLists = (MM_DyingClassList *)env->getForge()->allocate(2 * threadCount * sizeof(MM_DyingClassList), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+		if (NULL != dyingClassLists) {
+			MM_DyingClassList *dyingAnonymousClassLists = dyingClassLists + threadCount;
+			for (UDATA i = 0; i < (2 * threadCount); i++) {
+				dyingClassLists[i].clear();
+			}
 
-	/* class unload list includes anonymous class unload list */
-	classUnloadList = anonymousClassUnloadList;
-	classUnloadCount += anonymousClassUnloadCount;
+			MM_ClassUnloadingTask classUnloadingTask(env, _extensions->dispatcher, this, classLoaderUnloadList, markMap, dyingClassLists, dyingAnonymousClassLists);
+			_extensions->dispatcher->run(env, &classUnloadingTask);
 
-	/* Count all classes loaded by dying class loaders */
-	J9ClassLoader * classLoader = classLoaderUnloadList;
-	while (NULL != classLoader) {
-		Assert_MM_true( 0 == (classLoader->gcFlags & J9_GC_CLASS_LOADER_SCANNED) );
-		classLoaderUnloadCount += 1;
-		classLoader->gcFlags |= J9_GC_CLASS_LOADER_DEAD;
+			for (UDATA i = 0; i < threadCount; i++) {
+				dyingClasses.prepend(&dyingClassLists[i]);
+				dyingAnonymousClasses.prepend(&dyingAnonymousClassLists[i]);
+			}
+			env->getForge()->free(dyingClassLists);
+			parallel = true;
+		}
+	}
+	if (!parallel) {
+		findDyingClasses(env, classLoaderUnloadList, markMap, &dyingClasses, &dyingAnonymousClasses, false);
+	}
 
-		/* mark all of its classes as dying */
-		classUnloadList = addDyingClassesToList(env, classLoader, markMap, true, classUnloadList, &classUnloadCount);
+	/* class unload list includes anonymous class unload list */
+	anonymousClassUnloadList = dyingAnonymousClasses._head;
+	anonymousClassUnloadCount = dyingAnonymousClasses._count;
+	dyingAnonymousClasses.prepend(&dyingClasses);
+	classUnloadList = dyingAnonymousClasses._head;
+	classUnloadCount = dyingAnonymousClasses._count;
 
-		classLoader = classLoader->unloadLink;
-	}
+	/* Hook listeners expect to be called by a single thread */
+	notifyDyingClasses(env, classUnloadList, classUnloadCount);
 
 	if (0 != classUnloadCount) {
 		/* Call classes unload hook */
@@ -375,56 +467,72 @@ MM_ClassLoaderManager::cleanUpClassLoadersStart(MM_EnvironmentBase *env, J9Class
 	Trc_MM_cleanUpClassLoadersStart_Exit(env->getLanguageVMThread());
 }
 
-J9Class *
-MM_ClassLoaderManager::addDyingClassesToList(MM_EnvironmentBase *env, J9ClassLoader * classLoader, MM_HeapMap *markMap, bool setAll, J9Class *classUnloadListStart, UDATA *classUnloadCountResult)
+void
+MM_ClassLoaderManager::findDyingClasses(MM_EnvironmentBase *env, J9ClassLoader *classLoaderUnloadList, MM_HeapMap *markMap, MM_DyingClassList *dyingClasses, MM_DyingClassList *dyingAnonymousClasses, bool parallel)
 {
-	J9VMThread *vmThread = (J9VMThread *)env->getLanguageVMThread();
-	J9Class *classUnloadList = classUnloadListStart;
-	UDATA classUnloadCount = 0;
+	addDyingClassesToList(env, _javaVM->anonClassLoader, markMap, false, dyingAnonymousClasses, parallel);
 
+	J9ClassLoader *classLoader = classLoaderUnloadList;
+	while (NULL != classLoader) {
+		/* mark all of its classes as dying */
+		addDyingClassesToList(env, classLoader, markMap, true, dyingClasses, parallel);
+		classLoader = classLoader->unloadLink;
+	}
+}
+
+void
+MM_ClassLoaderManager::addDyingClassesToList(MM_EnvironmentBase *env, J9ClassLoader * classLoader, MM_HeapMap *markMap, bool setAll, MM_DyingClassList *dyingClasses, bool parallel)
+{
 	if (NULL != classLoader) {
 		GC_ClassLoaderSegmentIterator segmentIterator(classLoader, MEMORY_TYPE_RAM_CLASS);
 		J9MemorySegment *segment = NULL;
 		while(NULL != (segment = segmentIterator.nextSegment())) {
-			GC_ClassHeapIterator classHeapIterator(_javaVM, segment);
-			J9Class *clazz = NULL;
-			while(NULL != (clazz = classHeapIterator.nextClass())) {
-				J9Object *classObject = clazz->classObject;
-				if (setAll || !markMap->isBitSet(classObject)) {
-
-					/* with setAll all classes must be unmarked */
-					Assert_MM_true(!markMap->isBitSet(classObject));
-
-					classUnloadCount += 1;
-
-					/* Remove the class from the subclass traversal list */
-					removeFromSubclassHierarchy(env, clazz);
-
-					/* Mark class as dying */
-					clazz->classDepthAndFlags |= J9AccClassDying;
-
-					/* For CMVC 137275. For all dying classes we poison the classObject
-					 * field to J9_INVALID_OBJECT to investigate the origin of a class object
-					 * reference whose class has been unloaded.
-					 */
-					clazz->classObject = (j9object_t) J9_INVALID_OBJECT;
-
-					/* Call class unload hook */
-					Trc_MM_cleanUpClassLoadersStart_triggerClassUnload(env->getLanguageVMThread(),clazz,
-								(UDATA) J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(clazz->romClass)),
-								J9UTF8_DATA(J9ROMCLASS_CLASSNAME(clazz->romClass)));
-					TRIGGER_J9HOOK_VM_CLASS_UNLOAD(_javaVM->hookInterface, vmThread, clazz);
-
-					/* add class to dying classes link list */
-					clazz->gcLink = classUnloadList;
-					classUnloadList = clazz;
+			if (!parallel || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				GC_ClassHeapIterator classHeapIterator(_javaVM, segment);
+				J9Class *clazz = NULL;
+				while(NULL != (clazz = classHeapIterator.nextClass())) {
+					J9Object *classObject = clazz->classObject;
+					if (setAll || !markMap->isBitSet(classObject)) {
+
+						/* with setAll all classes must be unmarked */
+						Assert_MM_true(!markMap->isBitSet(classObject));
+
+						/* Mark class as dying */
+						clazz->classDepthAndFlags |= J9AccClassDying;
+
+						/* For CMVC 137275. For all dying classes we poison the classObject
+						 * field to J9_INVALID_OBJECT to investigate the origin of a class object
+						 * reference whose class has been unloaded.
+						 */
+						clazz->classObject = (j9object_t) J9_INVALID_OBJECT;
+
+						/* add class to dying classes link list */
+						dyingClasses->add(clazz);
+					}
 				}
 			}
 		}
 	}
+}
+
+void
+MM_ClassLoaderManager::notifyDyingClasses(MM_EnvironmentBase *env, J9Class *classUnloadList, UDATA classUnloadCount)
+{
+	J9VMThread *vmThread = (J9VMThread *)env->getLanguageVMThread();
+	J9Class *clazz = classUnloadList;
+
+	for (UDATA i = 0; i < classUnloadCount; i++) {
+		/* Remove the class from the subclass traversal list (neighbours may belong to other loaders, so this is not done in parallel) */
+		removeFromSubclassHierarchy(env, clazz);
 
-	*classUnloadCountResult += classUnloadCount;
-	return classUnloadList;
+		/* Call class unload hook */
+		Trc_MM_cleanUpClassLoadersStart_triggerClassUnload(env->getLanguageVMThread(),clazz,
+					(UDATA) J9UTF8_LENGTH(J9ROMCLASS_CLASSNAME(clazz->romClass)),
+					J9UTF8_DATA(J9ROMCLASS_CLASSNAME(clazz->romClass)));
+		TRIGGER_J9HOOK_VM_CLASS_UNLOAD(_javaVM->hookInterface, vmThread, clazz);
+
+		clazz = clazz->gcLink;
+	}
 }
 
 void
@@ -479,6 +587,14 @@ MM_ClassLoaderManager::cleanUpSegmentsInAnonymousClassLoader(MM_EnvironmentBase
 		J9MemorySegment **previousSegmentPointer = &_javaVM->anonClassLoader->classSegments;
 		J9MemorySegment *segment = *previousSegmentPointer;
 
+		/* Collect the ROM classes of dying anonymous classes so that their segments can be found in one more pass over the
+		 * segment list, rather than a pass per class. Without the table, fall back to searching the list for each class.
+		 */
+		J9HashTable *dyingROMClasses = NULL;
+		if (NULL != segment) {
+			dyingROMClasses = hashTableNew(OMRPORT_FROM_J9PORT(_javaVM->portLibrary), J9_GET_CALLSITE(), 0, sizeof(J9ROMClass *), sizeof(J9ROMClass *), 0, OMRMEM_CATEGORY_MM, dyingROMClassHash, dyingROMClassEqual, NULL, NULL);
+		}
+
 		while (NULL != segment) {
 			J9MemorySegment *nextSegment = segment->nextSegmentInClassLoader;
 			bool removed = false;
@@ -490,11 +606,11 @@ MM_ClassLoaderManager::cleanUpSegmentsInAnonymousClassLoader(MM_EnvironmentBase
 				Assert_MM_true(NULL == classHeapIterator.nextClass());
 
 				if (J9AccClassDying == (J9CLASS_FLAGS(clazz) & J9AccClassDying)) {
-					/* TODO replace this to better algorithm */
 					/* Try to find ROM class for unloading anonymous RAM class if it is not an array */
 					if (!_extensions->objectModel.isIndexable(clazz)) {
 						J9ROMClass *romClass = clazz->romClass;
-						if (NULL != romClass) {
+						/* if the ROM class can't be recorded in the table, search for its segment right away */
+						if ((NULL != romClass) && ((NULL == dyingROMClasses) || (NULL == hashTableAdd(dyingROMClasses, &romClass)))) {
 							J9MemorySegment **previousSegmentPointerROM = &_javaVM->anonClassLoader->classSegments;
 							J9MemorySegment *segmentROM = *previousSegmentPointerROM;
 
@@ -542,6 +658,34 @@ MM_ClassLoaderManager::cleanUpSegmentsInAnonymousClassLoader(MM_EnvironmentBase
 			}
 			segment = nextSegment;
 		}
+
+		if (NULL != dyingROMClasses) {
+			freeDyingAnonymousROMClassSegments(env, dyingROMClasses);
+			hashTableFree(dyingROMClasses);
+		}
+	}
+}
+
+void
+MM_ClassLoaderManager::freeDyingAnonymousROMClassSegments(MM_EnvironmentBase *env, J9HashTable *dyingROMClasses)
+{
+	if (0 != hashTableGetCount(dyingROMClasses)) {
+		J9MemorySegment **previousSegmentPointer = &_javaVM->anonClassLoader->classSegments;
+		J9MemorySegment *segment = *previousSegmentPointer;
+
+		while (NULL != segment) {
+			J9MemorySegment *nextSegment = segment->nextSegmentInClassLoader;
+			J9ROMClass *romClass = (J9ROMClass *)segment->heapBase;
+			if ((MEMORY_TYPE_ROM_CLASS == (segment->type & MEMORY_TYPE_ROM_CLASS)) && (NULL != hashTableFind(dyingROMClasses, &romClass))) {
+				/* remove memory segment from list and free it */
+				*previousSegmentPointer = nextSegment;
+				hashTableRemove(dyingROMClasses, &romClass);
+				_javaVM->internalVMFunctions->freeMemorySegment(_javaVM, segment, 1);
+			} else {
+				previousSegmentPointer = &segment->nextSegmentInClassLoader;
+			}
+			segment = nextSegment;
+		}
 	}
 }
 
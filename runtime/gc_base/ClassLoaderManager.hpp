@@ -43,9 +43,57 @@ class MM_GlobalCollector;
 class MM_HeapMap;
 class MM_ClassUnloadStats;
 
+#if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
+/**
+ * A list of dying classes, linked through J9Class::gcLink, built by a single GC thread.
+ */
+struct MM_DyingClassList {
+	J9Class *_head; /**< first class in the list */
+	J9Class *_tail; /**< last class in the list */
+	UDATA _count; /**< number of classes in the list */
+
+	MMINLINE void
+	clear()
+	{
+		_head = NULL;
+		_tail = NULL;
+		_count = 0;
+	}
+
+	MMINLINE void
+	add(J9Class *clazz)
+	{
+		clazz->gcLink = _head;
+		if (NULL == _head) {
+			_tail = clazz;
+		}
+		_head = clazz;
+		_count += 1;
+	}
+
+	/**
+	 * Move all classes of other to the front of this list, leaving other empty.
+	 */
+	MMINLINE void
+	prepend(MM_DyingClassList *other)
+	{
+		if (NULL != other->_head) {
+			other->_tail->gcLink = _head;
+			if (NULL == _head) {
+				_tail = other->_tail;
+			}
+			_head = other->_head;
+			_count += other->_count;
+			other->clear();
+		}
+	}
+};
+#endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
 class MM_ClassLoaderManager : public MM_BaseNonVirtual
 {
 friend class GC_ClassLoaderLinkedListIterator;
+friend class MM_ClassUnloadingTask;
 	
 public:
 protected:
@@ -130,6 +178,8 @@ public:
 	 * The J9AccClassDying bit is set and J9HOOK_VM_CLASS_UNLOAD is triggered for each class that will be unloaded.
 	 * The J9_GC_CLASS_LOADER_DEAD bit is set for each class loader that will be unloaded.
 	 * J9HOOK_VM_CLASSES_UNLOAD is triggered if any classes will be unloaded.
+	 * When there are enough class segments to walk, dying classes are found by all GC threads; the hooks are
+	 * always triggered by the current thread.
 	 * 
 	 * @param env[in] the main GC thread
 	 * @param classLoaderUnloadList[in] the linked list of loaders to unload, connected through the unloadLink field
@@ -219,6 +269,14 @@ public:
 	 */
 	void cleanUpSegmentsInAnonymousClassLoader(MM_EnvironmentBase *env, J9MemorySegment **reclaimedSegments);
 
+	/**
+	 * Free the ROM class segments of the anonymous classloader which belong to dying anonymous classes, using a
+	 * table of those ROM classes built while the RAM class segments were reclaimed.
+	 * @param env[in] the current thread
+	 * @param dyingROMClasses[in] table of the ROM classes of dying anonymous classes
+	 */
+	void freeDyingAnonymousROMClassSegments(MM_EnvironmentBase *env, J9HashTable *dyingROMClasses);
+
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	
 	/**
@@ -237,16 +295,37 @@ private:
 
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	/**
-	 * Scan classloader for dying classes and add them to the list
+	 * Scan classloader for dying classes, mark them as dying and add them to the list.
+	 * When called from a parallel task each RAM class segment is a work unit, so the classes of a loader may end up on
+	 * the lists of several threads.
 	 * @param env[in] the current thread
 	 * @param classLoader[in] the list of class loaders to clean up
 	 * @param markMap[in] the markMap to use to test for class loader liveness
 	 * @param setAll[in] bool if true if all classes must be set dying, if false unmarked classes only
-	 * @param classUnloadListStart[in] root of list dying classes should be added to
-	 * @param classUnloadCountOut[out] number of classes dying added to the list
-	 * @return new root to list of dying classes
+	 * @param dyingClasses[in/out] list dying classes should be added to
+	 * @param parallel[in] true if called by every thread of a parallel task, false if called by a single thread
+	 */
+	void addDyingClassesToList(MM_EnvironmentBase *env, J9ClassLoader * classLoader, MM_HeapMap *markMap, bool setAll, MM_DyingClassList *dyingClasses, bool parallel);
+
+	/**
+	 * Find the dying anonymous classes and all classes of the dying class loaders.
+	 * @param env[in] the current thread
+	 * @param classLoaderUnloadList[in] the linked list of loaders to unload, connected through the unloadLink field
+	 * @param markMap[in] the markMap to use to test for classes liveness
+	 * @param dyingClasses[out] list the classes of dying class loaders are added to
+	 * @param dyingAnonymousClasses[out] list the dying anonymous classes are added to
+	 * @param parallel[in] true if called by every thread of a parallel task, false if called by a single thread
+	 */
+	void findDyingClasses(MM_EnvironmentBase *env, J9ClassLoader *classLoaderUnloadList, MM_HeapMap *markMap, MM_DyingClassList *dyingClasses, MM_DyingClassList *dyingAnonymousClasses, bool parallel);
+
+	/**
+	 * Remove the given dying classes from the subclass hierarchy and report them through J9HOOK_VM_CLASS_UNLOAD.
+	 * Hook listeners are not thread safe, so this is always done by the main GC thread.
+	 * @param env[in] the main GC thread
+	 * @param classUnloadList[in] list of dying classes, linked through gcLink
+	 * @param classUnloadCount[in] number of classes in the list
 	 */
-	J9Class *addDyingClassesToList(MM_EnvironmentBase *env, J9ClassLoader * classLoader, MM_HeapMap *markMap, bool setAll, J9Class *classUnloadListStart, UDATA *classUnloadCountOut);
+	void notifyDyingClasses(MM_EnvironmentBase *env, J9Class *classUnloadList, UDATA classUnloadCount);
 
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 
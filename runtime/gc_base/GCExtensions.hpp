@@ -187,6 +187,18 @@ public:
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
 	double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 
+#if defined(J9VM_GC_MODRON_SCAVENGER) || defined(J9VM_GC_VLHGC)
+	UDATA hotFieldGCSamplingRate; /**< with dynamicBreadthFirstScanOrdering, copy-forward samples the reference fields of one in this many scanned objects as hot field evidence (0 disables GC sampling) */
+	UDATA hotFieldGCSampleWeight; /**< frequency credited to a field each time a GC sample sees it refer to a live evacuated object */
+	UDATA hotFieldDepthCopyMinShare; /**< percentage of a class' total field hotness its hottest field must hold for the class to be depth copied rather than breadth copied */
+#endif /* J9VM_GC_MODRON_SCAVENGER || J9VM_GC_VLHGC */
+
+#if defined(J9VM_GC_VLHGC)
+	bool tarokEnableConcurrentRememberedSetRebuild; /**< if true, RSCLs of regions overflowed outside of a GMP are rebuilt by the main GC thread concurrently with the mutator */
+	UDATA tarokTargetPauseTimeMillis; /**< soft PGC pause time target in milliseconds that Eden and PGC compaction work are sized to meet (0 disables) */
+	bool tarokCompressRememberedSetCards; /**< if true, RSCL cards on full pointer heaps are stored as 32-bit card indices relative to the heap base (forced false at startup if the heap does not fit) */
+#endif /* J9VM_GC_VLHGC */
+
 protected:
 private:
 protected:
@@ -274,6 +286,15 @@ public:
 	MMINLINE MM_OwnableSynchronizerObjectList* getOwnableSynchronizerObjectLists() { return ownableSynchronizerObjectLists; }
 	MMINLINE void setOwnableSynchronizerObjectLists(MM_OwnableSynchronizerObjectList* newOwnableSynchronizerObjectLists) { ownableSynchronizerObjectLists = newOwnableSynchronizerObjectLists; }
 
+#if defined(J9VM_GC_VLHGC)
+	/**
+	 * Determine if RSCL cards are stored as 32-bit entries. Always true with compressed references, where
+	 * a card is the shifted heap address; on full pointer heaps the card is an index relative to the heap base.
+	 * @return true if RSCL buffers hold 32-bit cards, false if they hold full heap addresses
+	 */
+	MMINLINE bool compressRememberedSetCards() { return compressObjectReferences() || tarokCompressRememberedSetCards; }
+#endif /* J9VM_GC_VLHGC */
+
 	/**
 	 * Create a GCExtensions object
 	 */
@@ -317,6 +338,16 @@ public:
 #endif
 		, maxRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
+#if defined(J9VM_GC_MODRON_SCAVENGER) || defined(J9VM_GC_VLHGC)
+		, hotFieldGCSamplingRate(64)
+		, hotFieldGCSampleWeight(100)
+		, hotFieldDepthCopyMinShare(0)
+#endif /* J9VM_GC_MODRON_SCAVENGER || J9VM_GC_VLHGC */
+#if defined(J9VM_GC_VLHGC)
+		, tarokEnableConcurrentRememberedSetRebuild(true)
+		, tarokTargetPauseTimeMillis(0)
+		, tarokCompressRememberedSetCards(true)
+#endif /* J9VM_GC_VLHGC */
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -79,15 +79,18 @@ MM_HotFieldUtil::sortClassHotFieldList(J9JavaVM *javaVM, J9ClassHotFieldsInfo* h
 	/* compute and update the hot fields for each class */
 	if (1 == hotFieldClassInfo->hotFieldListLength) {
 		hotFieldClassInfo->hotFieldOffset1 = hotFieldClassInfo->hotFieldListHead->hotFieldOffset;
+		hotFieldClassInfo->isBreadthFirstCopyPreferred = FALSE;
 	} else {
 		J9HotField* currentHotField = hotFieldClassInfo->hotFieldListHead;
 		uint64_t hottest = 0;
 		uint64_t secondHottest = 0;
 		uint64_t thirdHottest = 0;
 		uint64_t current = 0;
+		uint64_t totalHotness = 0;
 		while (NULL != currentHotField) {
 			if(currentHotField->cpuUtil > extensions->minCpuUtil) {
 				current = currentHotField->hotness;
+				totalHotness += current;
 				/* compute the three hottest fields if depthCopyThreePaths is enabled, or the two hottest fields if only depthCopyTwoPaths is enabled, otherwise, compute just the hottest field if both depthCopyTwoPaths and depthCopyThreePaths are disabled */
 				if (extensions->depthCopyThreePaths) {
 					if (current > hottest) {
@@ -126,6 +129,8 @@ MM_HotFieldUtil::sortClassHotFieldList(J9JavaVM *javaVM, J9ClassHotFieldsInfo* h
 		if (thirdHottest < MINIMUM_THIRD_HOT_FIELD_HOTNESS) { 
 			hotFieldClassInfo->hotFieldOffset3 = U_8_MAX;
 		}
+		/* depth copying only pays off when one field dominates the accesses to the class; otherwise leave its children to breadth first scanning */
+		hotFieldClassInfo->isBreadthFirstCopyPreferred = ((0 != totalHotness) && ((hottest * 100) < (totalHotness * extensions->hotFieldDepthCopyMinShare))) ? TRUE : FALSE;
 	}
 	/* if permanantHotFields are allowed, update consecutiveHotFieldSelections counter if hot field offsets are the same as the previous time the class hot field list was sorted  */
 	if (extensions->allowPermanantHotFields) {
@@ -165,4 +170,38 @@ MM_HotFieldUtil::resetAllHotFieldData(J9JavaVM *javaVM)
 	omrthread_monitor_exit(javaVM->hotFieldClassInfoPoolMutex);
 }
 
+void
+MM_HotFieldUtil::addHotFieldSample(J9JavaVM *javaVM, MM_HotFieldSample *samples, uintptr_t *sampleCount, J9Class *clazz, uint8_t hotFieldOffset)
+{
+	uintptr_t count = *sampleCount;
+	for (uintptr_t i = 0; i < count; i++) {
+		if ((samples[i].clazz == clazz) && (samples[i].hotFieldOffset == hotFieldOffset)) {
+			samples[i].count += 1;
+			return;
+		}
+	}
+	if (HOT_FIELD_SAMPLE_BUFFER_SIZE == count) {
+		reportHotFieldSamples(javaVM, samples, sampleCount);
+		count = 0;
+	}
+	samples[count].clazz = clazz;
+	samples[count].hotFieldOffset = hotFieldOffset;
+	samples[count].count = 1;
+	*sampleCount = count + 1;
+}
+
+void
+MM_HotFieldUtil::reportHotFieldSamples(J9JavaVM *javaVM, MM_HotFieldSample *samples, uintptr_t *sampleCount)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
+	/* GC evidence must clear the minCpuUtil filter applied when sorting, otherwise it would never influence the ranking */
+	int32_t reducedCpuUtil = (int32_t)extensions->minCpuUtil + 1;
+
+	for (uintptr_t i = 0; i < *sampleCount; i++) {
+		uint32_t reducedFrequency = (uint32_t)OMR_MIN(samples[i].count * extensions->hotFieldGCSampleWeight, (uintptr_t)U_32_MAX);
+		javaVM->internalVMFunctions->reportHotField(javaVM, reducedCpuUtil, samples[i].clazz, samples[i].hotFieldOffset, reducedFrequency);
+	}
+	*sampleCount = 0;
+}
+
 #endif /* J9VM_GC_MODRON_SCAVENGER || J9VM_GC_VLHGC */
@@ -36,6 +36,19 @@
 #include "BaseNonVirtual.hpp"
 #include "GCExtensions.hpp"
 
+/* Number of distinct class/field pairs a GC thread batches before reporting them as hot field evidence */
+#define HOT_FIELD_SAMPLE_BUFFER_SIZE 64
+
+/**
+ * A field observed by a GC thread to refer to a live object being evacuated.
+ * Samples are aggregated per thread and reported in bulk, to keep hot field list locking off the scan path.
+ * @ingroup GC_Base
+ */
+struct MM_HotFieldSample {
+	J9Class *clazz; /**< class of the object holding the field */
+	uintptr_t count; /**< number of times the field was sampled */
+	uint8_t hotFieldOffset; /**< offset of the field, in reference slots from the start of the object */
+};
 
 /**
  * @todo Provide class documentation
@@ -69,6 +82,28 @@ public:
 	 * @param javaVM[in] pointer to the J9JavaVM
 	 */
 	MMINLINE static void resetAllHotFieldData(J9JavaVM *javaVM);
+
+	/**
+	 * Record a field sampled during a GC scan in a thread local sample buffer, reporting the buffer first if it is full.
+	 * Used when dynamicBreadthFirstScanOrdering is enabled and hotFieldGCSamplingRate is non-zero.
+	 *
+	 * @param javaVM[in] pointer to the J9JavaVM
+	 * @param samples[in] thread local buffer of HOT_FIELD_SAMPLE_BUFFER_SIZE samples
+	 * @param sampleCount[in/out] number of samples currently in the buffer
+	 * @param clazz[in] class of the object holding the field
+	 * @param hotFieldOffset[in] offset of the field, in reference slots from the start of the object
+	 */
+	static void addHotFieldSample(J9JavaVM *javaVM, MM_HotFieldSample *samples, uintptr_t *sampleCount, J9Class *clazz, uint8_t hotFieldOffset);
+
+	/**
+	 * Report all samples in a thread local sample buffer as hot fields of their classes and empty the buffer.
+	 * The fields are ranked together with the hot fields reported by the JIT the next time hot field data is sorted.
+	 *
+	 * @param javaVM[in] pointer to the J9JavaVM
+	 * @param samples[in] thread local buffer of samples
+	 * @param sampleCount[in/out] number of samples in the buffer, set to 0 on return
+	 */
+	static void reportHotFieldSamples(J9JavaVM *javaVM, MM_HotFieldSample *samples, uintptr_t *sampleCount);
 };
 
 #endif /* J9VM_GC_MODRON_SCAVENGER || J9VM_GC_VLHGC */
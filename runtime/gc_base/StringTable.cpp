@@ -48,6 +48,103 @@ static UDATA stringHashEqualFn (void *leftKey, void *rightKey, void *userData);
 static IDATA stringComparatorFn(struct J9AVLTree *tree, struct J9AVLTreeNode *leftNode, struct J9AVLTreeNode *rightNode);
 static j9object_t setupCharArray(J9VMThread *vmThread, j9object_t sourceString, j9object_t newString);
 
+/* powers of 31 used to fold four characters per step into a String.hashCode() compatible hash */
+#define STRING_HASH_31_2 ((U_32)961)
+#define STRING_HASH_31_3 ((U_32)29791)
+#define STRING_HASH_31_4 ((U_32)923521)
+
+/**
+ * Find the characters of a String value array in memory.
+ * @param javaVM pointer to the J9JavaVM
+ * @param valueArray the value array of a String
+ * @return pointer to the first element, or NULL if the array is discontiguous and has to be read element by element
+ */
+static void *
+getContiguousStringData(J9JavaVM *javaVM, j9object_t valueArray)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(javaVM);
+	void *data = NULL;
+	if (extensions->indexableObjectModel.isInlineContiguousArraylet((J9IndexableObject *)valueArray)) {
+		data = extensions->indexableObjectModel.getDataPointerForContiguous((J9IndexableObject *)valueArray);
+	}
+	return data;
+}
+
+/**
+ * Compute String.hashCode() for Latin-1 data. The loop consumes four characters per iteration
+ * without a serial dependency between them so the compiler can vectorize it.
+ */
+static U_32
+computeHashForLatin1(const U_8 *data, UDATA length)
+{
+	U_32 hash = 0;
+	UDATA i = 0;
+	for (; (i + 4) <= length; i += 4) {
+		hash = (hash * STRING_HASH_31_4)
+			+ ((U_32)data[i] * STRING_HASH_31_3)
+			+ ((U_32)data[i + 1] * STRING_HASH_31_2)
+			+ ((U_32)data[i + 2] * 31)
+			+ (U_32)data[i + 3];
+	}
+	for (; i < length; i++) {
+		hash = (hash << 5) - hash + (U_32)data[i];
+	}
+	return hash;
+}
+
+/**
+ * Compute String.hashCode() for UTF-16 data. See computeHashForLatin1().
+ */
+static U_32
+computeHashForUTF16(const U_16 *data, UDATA length)
+{
+	U_32 hash = 0;
+	UDATA i = 0;
+	for (; (i + 4) <= length; i += 4) {
+		hash = (hash * STRING_HASH_31_4)
+			+ ((U_32)data[i] * STRING_HASH_31_3)
+			+ ((U_32)data[i + 1] * STRING_HASH_31_2)
+			+ ((U_32)data[i + 2] * 31)
+			+ (U_32)data[i + 3];
+	}
+	for (; i < length; i++) {
+		hash = (hash << 5) - hash + (U_32)data[i];
+	}
+	return hash;
+}
+
+/**
+ * Compare the characters of two Strings of the same length when both value arrays are contiguous.
+ * Arrays with the same representation are compared with memcmp(); mixed Latin-1/UTF-16 pairs are
+ * widened one character at a time.
+ * @param[out] equal set to whether the characters match
+ * @return true if the comparison was done, false if either array is discontiguous
+ */
+static bool
+compareContiguousStringData(J9JavaVM *javaVM, j9object_t left_p, bool leftCompressed, j9object_t right_p, bool rightCompressed, U_32 length, bool *equal)
+{
+	void *leftData = getContiguousStringData(javaVM, left_p);
+	void *rightData = getContiguousStringData(javaVM, right_p);
+	if ((NULL == leftData) || (NULL == rightData)) {
+		return false;
+	}
+	if (leftCompressed == rightCompressed) {
+		UDATA byteLength = leftCompressed ? (UDATA)length : ((UDATA)length * sizeof(U_16));
+		*equal = (0 == memcmp(leftData, rightData, byteLength));
+	} else {
+		const U_8 *latin1 = (const U_8 *)(leftCompressed ? leftData : rightData);
+		const U_16 *utf16 = (const U_16 *)(leftCompressed ? rightData : leftData);
+		U_32 i = 0;
+		for (; i < length; i++) {
+			if ((U_16)latin1[i] != utf16[i]) {
+				break;
+			}
+		}
+		*equal = (i == length);
+	}
+	return true;
+}
+
 MM_StringTable *
 MM_StringTable::newInstance(MM_EnvironmentBase *env, UDATA tableCount)
 {
@@ -380,6 +477,26 @@ stringHashEqualFn(void *leftKey, void *rightKey, void *userData)
 		U_32 right_i = 0;
 		U_32 i;
 
+		/* A Latin-1 String can only match a UTF8 query of the same byte length if every character is ASCII,
+		 * in which case the bytes match exactly. Otherwise fall through to decoding.
+		 */
+		if (leftCompressed && (leftLength == rightLength)) {
+			U_8 *leftData = (U_8 *)getContiguousStringData(javaVM, left_p);
+			if (NULL != leftData) {
+				U_8 highBits = 0;
+				for (i = 0; i < leftLength; i++) {
+					highBits |= leftData[i];
+				}
+				if (0 == (highBits & 0x80)) {
+					if (0 != memcmp(leftData, u8Ptr, leftLength)) {
+						return FALSE;
+					}
+					right_i = rightLength;
+					goto utf8Matched;
+				}
+			}
+		}
+
 		for (i = 0; i < leftLength; i++) {
 			U_16 leftChar, rightChar;
 			U_32 consumed;
@@ -404,6 +521,7 @@ stringHashEqualFn(void *leftKey, void *rightKey, void *userData)
 		if (right_i != rightLength) {
 			return FALSE;
 		}
+utf8Matched:
 		if (isMetronome) {
 #if defined(J9VM_GC_REALTIME) 
 			/*
@@ -427,7 +545,15 @@ stringHashEqualFn(void *leftKey, void *rightKey, void *userData)
 			return FALSE;
 		}
 
-		for (i = 0; i < leftLength; i++) {
+		bool equal = false;
+		if (compareContiguousStringData(javaVM, left_p, leftCompressed, right_p, rightCompressed, leftLength, &equal)) {
+			if (!equal) {
+				return FALSE;
+			}
+			left_i = leftLength;
+		}
+
+		for (i = left_i; i < leftLength; i++) {
 			U_16 leftChar, rightChar;
 			if (rightCompressed) {
 				rightChar = (U_16)J9JAVAARRAYOFBYTE_LOAD_VM(javaVM, right_p, right_i) & (U_16)0xFF;
@@ -472,8 +598,20 @@ computeJavaHashForExpandedString(J9JavaVM *javaVM, j9object_t s)
 	I_32 i;
 	I_32 length = J9VMJAVALANGSTRING_LENGTH_VM(javaVM, s);
 	j9object_t bytes = J9VMJAVALANGSTRING_VALUE_VM(javaVM, s);
+	bool isCompressed = IS_STRING_COMPRESSED_VM(javaVM, s);
 
-	if (IS_STRING_COMPRESSED_VM(javaVM, s)) {
+	if (0 == length) {
+		return 0;
+	}
+
+	void *data = getContiguousStringData(javaVM, bytes);
+	if (NULL != data) {
+		if (isCompressed) {
+			hash = computeHashForLatin1((U_8 *)data, (UDATA)length);
+		} else {
+			hash = computeHashForUTF16((U_16 *)data, (UDATA)length);
+		}
+	} else if (isCompressed) {
 		for (i = 0; i < length; ++i) {
 			hash = (hash << 5) - hash + ((U_16)J9JAVAARRAYOFBYTE_LOAD_VM(javaVM, bytes, i) & (U_16)0xFF);
 		}
@@ -579,14 +717,13 @@ j9gc_createJavaLangString(J9VMThread *vmThread, U_8 *data, UDATA length, UDATA s
 	 */
 
 	if (internString && !translateSlashes && !isUnicode) {
+		/* Select the sub-table with the same 32 bit hash stringHashFn() uses for String keys */
 		UDATA hash = 0;
 
 		if (isASCII) {
-			for (UDATA i = 0; i < length; ++i) {
-				hash = (hash << 5) - hash + data[i];
-			}
+			hash = computeHashForLatin1(data, length);
 		} else {
-			hash = VM_VMHelpers::computeHashForUTF8(data, length);
+			hash = (U_32)VM_VMHelpers::computeHashForUTF8(data, length);
 		}
 
 		UDATA tableIndex = stringTable->getTableIndex(hash);
@@ -383,13 +383,13 @@ public:
 	 * Valid if scavenger dynamicBreadthFirstScanOrdering is enabled.
 	 *
 	 * @param forwardedHeader pointer to the MM_ForwardedHeader instance encapsulating the object
-	 * @return the offset of the hottest field of the given object referred to by the forwarded header, return U_8_MAX if a hot field does not exist
+	 * @return the offset of the hottest field of the given object referred to by the forwarded header, return U_8_MAX if a hot field does not exist or the class prefers breadth first copying
 	 */
 	MMINLINE uint8_t
 	getHotFieldOffset(MM_ForwardedHeader *forwardedHeader)
 	{
 		J9Class* hotClass = ((J9Class *)(((uintptr_t)(forwardedHeader->getPreservedSlot())) & ~(UDATA)_delegateHeaderSlotFlagsMask));
-		if (hotClass->hotFieldsInfo != NULL) {
+		if ((hotClass->hotFieldsInfo != NULL) && !hotClass->hotFieldsInfo->isBreadthFirstCopyPreferred) {
 			return hotClass->hotFieldsInfo->hotFieldOffset1;
 		}
 		
@@ -434,6 +434,13 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			}
 			continue;
 		}
+		if (try_scan(&scan_start, "tarokTargetPauseTimeMillis=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokTargetPauseTimeMillis, "tarokTargetPauseTimeMillis=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 		if (try_scan(&scan_start, "tarokPGCtoGMP=")) {
 			if(!scan_udata_helper(vm, &scan_start, &extensions->tarokPGCtoGMPNumerator, "tarokPGCtoGMP=")) {
 				returnValue = JNI_EINVAL;
@@ -559,6 +566,22 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->tarokEnableStableRegionDetection = false;
 			continue;
 		}
+		if (try_scan(&scan_start, "tarokEnableConcurrentRememberedSetRebuild")) {
+			extensions->tarokEnableConcurrentRememberedSetRebuild = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableConcurrentRememberedSetRebuild")) {
+			extensions->tarokEnableConcurrentRememberedSetRebuild = false;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokEnableCompressedRememberedSetCards")) {
+			extensions->tarokCompressRememberedSetCards = true;
+			continue;
+		}
+		if (try_scan(&scan_start, "tarokDisableCompressedRememberedSetCards")) {
+			extensions->tarokCompressRememberedSetCards = false;
+			continue;
+		}
 		if (try_scan(&scan_start, "tarokAllocationAgeEnabled")) {
 			extensions->tarokAllocationAgeEnabled = true;
 			continue;
@@ -851,6 +874,44 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->minCpuUtil = value;
 			continue;
 		}
+
+		if(try_scan(&scan_start, "dbfGCSamplingRate=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->hotFieldGCSamplingRate, "dbfGCSamplingRate=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if(try_scan(&scan_start, "dbfGCSampleWeight=")) {
+			UDATA value;
+			if(!scan_udata_helper(vm, &scan_start, &value, "dbfGCSampleWeight=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if((0 == value) || (value > 10000)) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "dbfGCSampleWeight=", (UDATA)1, (UDATA)10000);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			extensions->hotFieldGCSampleWeight = value;
+			continue;
+		}
+
+		if(try_scan(&scan_start, "dbfDepthCopyMinShare=")) {
+			UDATA value;
+			if(!scan_udata_helper(vm, &scan_start, &value, "dbfDepthCopyMinShare=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(value > 100) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR, J9NLS_GC_OPTIONS_INTEGER_OUT_OF_RANGE, "dbfDepthCopyMinShare=", (UDATA)0, (UDATA)100);
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			extensions->hotFieldDepthCopyMinShare = value;
+			continue;
+		}
 #endif /* defined(J9VM_GC_MODRON_SCAVENGER) || defined (J9VM_GC_VLHGC) */
 /* End of options relating to dynamicBreadthFirstScanOrdering */
 
@@ -72,6 +72,16 @@ public:
 	uintptr_t _doubleMappedArrayletsCandidates; /**< The number of double mapped arraylets that have been visited during marking */
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
 
+	uintptr_t _stealAttemptCount; /**< The number of times this thread tried to steal a scan cache from the deque of another thread */
+	uintptr_t _stealCount; /**< The number of scan caches this thread successfully stole from other threads */
+	uintptr_t _idleCount; /**< The number of times this thread waited for scan work to become available */
+
+	uintptr_t _hotFieldsSampled; /**< The number of reference fields sampled as hot field evidence */
+	uintptr_t _hotFieldsDepthCopied; /**< The number of objects copied immediately after their parent by hot field depth copying */
+	uintptr_t _hotFieldsCopiedAdjacent; /**< The number of depth copied objects which landed within two cache lines of their parent */
+
+	uintptr_t _crossNodeSurvivorBytes; /**< The number of bytes copied into survivor regions stolen from a NUMA node other than their owning context's */
+
 	uint64_t _cycleStartTime; /**< The start time of a copy forward cycle */
 
 private:
@@ -105,6 +115,16 @@ public:
 		_doubleMappedArrayletsCleared = 0;
 		_doubleMappedArrayletsCandidates = 0;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+
+		_stealAttemptCount = 0;
+		_stealCount = 0;
+		_idleCount = 0;
+
+		_hotFieldsSampled = 0;
+		_hotFieldsDepthCopied = 0;
+		_hotFieldsCopiedAdjacent = 0;
+
+		_crossNodeSurvivorBytes = 0;
 	}
 	
 	/**
@@ -132,6 +152,16 @@ public:
 		_doubleMappedArrayletsCleared += stats->_doubleMappedArrayletsCleared;
 		_doubleMappedArrayletsCandidates += stats->_doubleMappedArrayletsCandidates;
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+
+		_stealAttemptCount += stats->_stealAttemptCount;
+		_stealCount += stats->_stealCount;
+		_idleCount += stats->_idleCount;
+
+		_hotFieldsSampled += stats->_hotFieldsSampled;
+		_hotFieldsDepthCopied += stats->_hotFieldsDepthCopied;
+		_hotFieldsCopiedAdjacent += stats->_hotFieldsCopiedAdjacent;
+
+		_crossNodeSurvivorBytes += stats->_crossNodeSurvivorBytes;
 	}
 
 	MM_CopyForwardStats() :
@@ -151,6 +181,13 @@ public:
 		, _doubleMappedArrayletsCleared(0)
 		, _doubleMappedArrayletsCandidates(0)
 #endif /* J9VM_GC_ENABLE_DOUBLE_MAP */
+		, _stealAttemptCount(0)
+		, _stealCount(0)
+		, _idleCount(0)
+		, _hotFieldsSampled(0)
+		, _hotFieldsDepthCopied(0)
+		, _hotFieldsCopiedAdjacent(0)
+		, _crossNodeSurvivorBytes(0)
 	{}
 };
 
@@ -26,10 +26,14 @@
 #include "j9port.h"
 #include "Tgc.hpp"
 #include "mmhook.h"
+#include "mmprivatehook.h"
 
 #if defined(J9VM_GC_VLHGC)
+#include "AllocationContextBalanced.hpp"
+#include "CopyForwardStats.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
+#include "GlobalAllocationManagerTarok.hpp"
 #include "Heap.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionDescriptor.hpp"
@@ -117,6 +121,32 @@ tgcHookReportNumaStatistics(J9HookInterface** hook, UDATA eventNum, void* eventD
 	}
 }
 
+/**
+ * Report the memory traffic which crossed NUMA nodes since the previous collection: regions mutators had to steal
+ * from foreign nodes and survivors the copy-forward had to place on foreign nodes.
+ */
+static void
+tgcHookReportNumaCrossNodeStatistics(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_CopyForwardEndEvent* event = (MM_CopyForwardEndEvent*)eventData;
+	J9VMThread* vmThread = (J9VMThread*)event->currentThread->_language_vmthread;
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(vmThread->javaVM);
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(extensions);
+	MM_CopyForwardStats *copyForwardStats = (MM_CopyForwardStats *)event->copyForwardStats;
+	MM_GlobalAllocationManagerTarok *allocationManager = (MM_GlobalAllocationManagerTarok *)extensions->globalAllocationManager;
+	UDATA regionSize = extensions->regionSize;
+
+	for (UDATA i = 0; i < allocationManager->getManagedAllocationContextCount(); i++) {
+		MM_AllocationContextBalanced *context = (MM_AllocationContextBalanced *)allocationManager->getAllocationContextByIndex(i);
+		UDATA regionsStolen = context->getRegionsStolenLastCycle();
+		tgcExtensions->printf("NUMA node %zu stole %zu regions (%zu bytes) from other nodes, %zd spare regions\n",
+				context->getNumaNode(),
+				regionsStolen,
+				regionsStolen * regionSize,
+				context->getSpareRegionCount());
+	}
+	tgcExtensions->printf("NUMA copy-forward placed %zu bytes of survivors on other nodes\n", copyForwardStats->_crossNodeSurvivorBytes);
+}
 
 /**
  * Initialize NUMA tgc tracing.
@@ -137,6 +167,9 @@ tgcNumaInitialize(J9JavaVM *javaVM)
 	(*hooks)->J9HookRegisterWithCallSite(hooks, J9HOOK_MM_OMR_LOCAL_GC_START, tgcHookReportNumaStatistics, OMR_GET_CALLSITE(), NULL);
 	(*hooks)->J9HookRegisterWithCallSite(hooks, J9HOOK_MM_OMR_LOCAL_GC_END, tgcHookReportNumaStatistics, OMR_GET_CALLSITE(), NULL);
 
+	J9HookInterface** privateHooks = J9_HOOK_INTERFACE(extensions->privateHookInterface);
+	(*privateHooks)->J9HookRegisterWithCallSite(privateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, tgcHookReportNumaCrossNodeStatistics, OMR_GET_CALLSITE(), NULL);
+
 	return result;
 }
 
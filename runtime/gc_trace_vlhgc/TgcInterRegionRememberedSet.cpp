@@ -36,6 +36,8 @@
 #include "HeapRegionManager.hpp"
 #include "IncrementalGenerationalGC.hpp"
 #include "InterRegionRememberedSet.hpp"
+#include "RememberedSetCard.hpp"
+#include "RememberedSetCardBucket.hpp"
 #include "RememberedSetCardListCardIterator.hpp"
 
 
@@ -187,6 +189,36 @@ calculateAndPrintHistogram(J9VMThread *vmThread, MM_HeapRegionManager *regionMan
 	}
 }
 
+/**
+ * Print the memory footprint of the RSCLs and the cost of the last card list flush scan
+ */
+static void
+printFootprintAndScanCost(MM_EnvironmentVLHGC *env, MM_HeapRegionManager *regionManager, UDATA totalReferences)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	MM_TgcExtensions *tgcExtensions = MM_TgcExtensions::getExtensions(extensions);
+	MM_InterRegionRememberedSet *interRegionRememberedSet = extensions->interRegionRememberedSet;
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	UDATA const cardSize = MM_RememberedSetCard::cardSize(extensions->compressRememberedSetCards());
+	UDATA const bufferSize = MM_RememberedSetCardBucket::MAX_BUFFER_SIZE * cardSize;
+	UDATA regionCount = regionManager->getTableRegionCount();
+	UDATA bufferCount = 0;
+	for (UDATA i = 0; i < regionCount; i++) {
+		MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)regionManager->physicalTableDescriptorForIndex(i);
+		bufferCount += region->getRememberedSetCardList()->getBufferCount();
+	}
+	UDATA usedBytes = bufferCount * bufferSize;
+	UDATA bytesPerCard = (0 != totalReferences) ? (usedBytes / totalReferences) : 0;
+	tgcExtensions->printf("{RSCL: %zu-byte cards; %zu buffers (%zuKB, %zu bytes per card) in use of %zuKB committed }\n",
+		cardSize, bufferCount, usedBytes / 1024, bytesPerCard, (interRegionRememberedSet->_bufferCountTotal * bufferSize) / 1024);
+
+	UDATA flushedCardCount = interRegionRememberedSet->_flushedCardCount;
+	U_64 flushTime = j9time_hires_delta(0, interRegionRememberedSet->_flushTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	U_64 flushTimePerCard = (0 != flushedCardCount) ? ((flushTime * 1000) / flushedCardCount) : 0;
+	tgcExtensions->printf("{RSCL: last flush scanned %zu cards in %llu us (all threads), %llu ns per card }\n",
+		flushedCardCount, flushTime, flushTimePerCard);
+}
 
 /**
  * Report RSCL histogram prior to a collection
@@ -239,6 +271,7 @@ tgcHookReportInterRegionRememberedSetHistogram(J9HookInterface** hookInterface,
 	}
 
 	calculateAndPrintHistogram(vmThread, regionManager, eventString, totalCardsToRegions, maxCardsToRegion);
+	printFootprintAndScanCost(&env, regionManager, totalCardsToRegions);
 }
 
 
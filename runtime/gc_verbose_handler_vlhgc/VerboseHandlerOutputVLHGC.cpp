@@ -30,6 +30,7 @@
 #include "GCExtensions.hpp"
 #include "MarkVLHGCStats.hpp"
 #include "ReferenceStats.hpp"
+#include "SchedulingDelegate.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
 #include "VerboseHandlerJava.hpp"
@@ -51,6 +52,7 @@ static void verboseHandlerFailedAllocationCompleted(J9HookInterface** hook, UDAT
 static void verboseHandlerAllocationFailureEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerCopyForwardStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerCopyForwardEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+static void verboseHandlerGarbageCollectCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerConcurrentEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 static void verboseHandlerGMPMarkStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
@@ -145,6 +147,9 @@ MM_VerboseHandlerOutputVLHGC::enableVerbose()
 	/* Copy Forward */
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_START, verboseHandlerCopyForwardStart, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, verboseHandlerCopyForwardEnd, OMR_GET_CALLSITE(), (void *)this);
+
+	/* Pause time target */
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_VLHGC_GARBAGE_COLLECT_COMPLETED, verboseHandlerGarbageCollectCompleted, OMR_GET_CALLSITE(), (void *)this);
 	
 	/* Concurrent GMP */
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_START, verboseHandlerConcurrentStart, OMR_GET_CALLSITE(), this);
@@ -204,6 +209,9 @@ MM_VerboseHandlerOutputVLHGC::disableVerbose()
 	/* Copy Forward */
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_START, verboseHandlerCopyForwardStart, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COPY_FORWARD_END, verboseHandlerCopyForwardEnd, NULL);
+
+	/* Pause time target */
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_VLHGC_GARBAGE_COLLECT_COMPLETED, verboseHandlerGarbageCollectCompleted, NULL);
 	
 	/* Concurrent GMP */
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_CONCURRENT_PHASE_START, verboseHandlerConcurrentStart, NULL);
@@ -407,6 +415,10 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 				(copyForwardStats->_edenEvacuateRegionCount + copyForwardStats->_nonEdenEvacuateRegionCount - copyForwardStats->_nonEvacuateRegionCount),
 				copyForwardStats->_nonEvacuateRegionCount);
 	}
+	if ((0 != copyForwardStats->_hotFieldsSampled) || (0 != copyForwardStats->_hotFieldsDepthCopied)) {
+		writer->formatAndOutput(env, 1, "<hot-fields sampled=\"%zu\" depthcopied=\"%zu\" adjacent=\"%zu\" />",
+				copyForwardStats->_hotFieldsSampled, copyForwardStats->_hotFieldsDepthCopied, copyForwardStats->_hotFieldsCopiedAdjacent);
+	}
 	outputRememberedSetClearedInfo(env, irrsStats);
 
 	outputUnfinalizedInfo(env, 1, copyForwardStats->_unfinalizedCandidates, copyForwardStats->_unfinalizedEnqueued);
@@ -442,6 +454,39 @@ MM_VerboseHandlerOutputVLHGC::handleCopyForwardEnd(J9HookInterface** hook, UDATA
 	exitAtomicReportingBlock();
 }
 
+void
+MM_VerboseHandlerOutputVLHGC::handleGarbageCollectCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData)
+{
+	MM_VlhgcGarbageCollectCompletedEvent* event = (MM_VlhgcGarbageCollectCompletedEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+	MM_CycleStateVLHGC *cycleState = static_cast<MM_CycleStateVLHGC*>(env->_cycleState);
+
+	/* only PGCs are predicted, and only reported if the user asked for a pause time target */
+	if ((0 != extensions->tarokTargetPauseTimeMillis) && (MM_CycleState::CT_PARTIAL_GARBAGE_COLLECTION == cycleState->_collectionType)) {
+		MM_SchedulingDelegate *schedulingDelegate = cycleState->_schedulingDelegate;
+		U_64 predictedTime = schedulingDelegate->getPredictedPartialGCTimeMicros();
+		U_64 actualTime = schedulingDelegate->getLastPartialGCTimeMicros();
+		MM_VerboseWriterChain* writer = _manager->getWriterChain();
+
+		enterAtomicReportingBlock();
+		if (0 == predictedTime) {
+			writer->formatAndOutput(env, 0, "<pause-target contextid=\"%zu\" targetms=\"%zu\" actualms=\"%llu.%03.3llu\" edenregions=\"%zu\" />",
+					cycleState->_verboseContextID, extensions->tarokTargetPauseTimeMillis,
+					actualTime / 1000, actualTime % 1000,
+					schedulingDelegate->getCurrentEdenSizeInRegions((MM_EnvironmentVLHGC *)env));
+		} else {
+			writer->formatAndOutput(env, 0, "<pause-target contextid=\"%zu\" targetms=\"%zu\" predictedms=\"%llu.%03.3llu\" actualms=\"%llu.%03.3llu\" edenregions=\"%zu\" />",
+					cycleState->_verboseContextID, extensions->tarokTargetPauseTimeMillis,
+					predictedTime / 1000, predictedTime % 1000,
+					actualTime / 1000, actualTime % 1000,
+					schedulingDelegate->getCurrentEdenSizeInRegions((MM_EnvironmentVLHGC *)env));
+		}
+		writer->flush(env);
+		exitAtomicReportingBlock();
+	}
+}
+
 void
 MM_VerboseHandlerOutputVLHGC::handleConcurrentStartInternal(J9HookInterface** hook, UDATA eventNum, void* eventData)
 {
@@ -849,6 +894,12 @@ verboseHandlerCopyForwardEnd(J9HookInterface** hook, UDATA eventNum, void* event
 	((MM_VerboseHandlerOutputVLHGC *)userData)->handleCopyForwardEnd(hook, eventNum, eventData);
 }
 
+void
+verboseHandlerGarbageCollectCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputVLHGC *)userData)->handleGarbageCollectCompleted(hook, eventNum, eventData);
+}
+
 void
 verboseHandlerConcurrentStart(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
 {
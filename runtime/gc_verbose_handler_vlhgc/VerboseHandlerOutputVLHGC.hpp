@@ -153,6 +153,14 @@ public:
 	 * @param eventData hook specific event data.
 	 */
 	void handleCopyForwardEnd(J9HookInterface** hook, UDATA eventNum, void* eventData);
+
+	/**
+	 * Write the predicted and actual PGC time when a PGC pause time target is set.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleGarbageCollectCompleted(J9HookInterface** hook, UDATA eventNum, void* eventData);
 	
 	virtual	void handleConcurrentStartInternal(J9HookInterface** hook, UDATA eventNum, void* eventData);
 	virtual void handleConcurrentEndInternal(J9HookInterface** hook, UDATA eventNum, void* eventData);
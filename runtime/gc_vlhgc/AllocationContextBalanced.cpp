@@ -163,6 +163,12 @@ void
 MM_AllocationContextBalanced::flush(MM_EnvironmentBase *env)
 {
 	flushInternal(env);
+
+	/* fold the regions consumed since the last collection into the demand which bounds how much other nodes may steal from ours */
+	_regionDemand = (_regionDemand + _localRegionsAcquired + _regionsStolen) / 2;
+	_regionsStolenLastCycle = _regionsStolen;
+	_localRegionsAcquired = 0;
+	_regionsStolen = 0;
 }
 
 void
@@ -639,23 +645,38 @@ MM_AllocationContextBalanced::acquireMPBPRegionFromHeap(MM_EnvironmentBase *env,
 	if ((NULL == region) && (_nextToSteal != this)) {
 		MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
 		Assert_MM_true(0 != extensions->_numaManager.getAffinityLeaderCount());
-		/* we didn't get any memory yet we are in a NUMA system so we should steal from a foreign node */
-		MM_AllocationContextBalanced *firstTheftAttempt = _nextToSteal;
-		do {
-			region = _nextToSteal->acquireMPBPRegionFromNode(env, subspace, requestingContext);
+		/* we didn't get any memory yet we are in a NUMA system so we should steal from a foreign node.  Prefer the node with the
+		 * most memory to spare, so that our theft doesn't force that node to steal in turn
+		 */
+		MM_AllocationContextBalanced *victim = selectCousinToStealFrom();
+		if (NULL != victim) {
+			region = victim->acquireMPBPRegionFromNode(env, subspace, requestingContext);
 			if (NULL != region) {
 				/* make sure that we record the original owner so that the region can be identified as foreign */
 				Assert_MM_true(NULL == region->_allocateData._originalOwningContext);
-				region->_allocateData._originalOwningContext = _nextToSteal;
+				region->_allocateData._originalOwningContext = victim;
 			}
-			/* advance to the next node whether we succeeded or not since we want to distribute our "theft" as evenly as possible */
-			_nextToSteal = _nextToSteal->getStealingCousin();
-			if (this == _nextToSteal) {
-				/* never try to steal from ourselves since that wouldn't be possible and the code interprets this case as a uniform system */
+		}
+		if (NULL == region) {
+			/* every node is under pressure so fall back to stealing round-robin rather than failing the allocation */
+			MM_AllocationContextBalanced *firstTheftAttempt = _nextToSteal;
+			do {
+				region = _nextToSteal->acquireMPBPRegionFromNode(env, subspace, requestingContext);
+				if (NULL != region) {
+					/* make sure that we record the original owner so that the region can be identified as foreign */
+					Assert_MM_true(NULL == region->_allocateData._originalOwningContext);
+					region->_allocateData._originalOwningContext = _nextToSteal;
+				}
+				/* advance to the next node whether we succeeded or not since we want to distribute our "theft" as evenly as possible */
 				_nextToSteal = _nextToSteal->getStealingCousin();
-			}
-		} while ((NULL == region) && (firstTheftAttempt != _nextToSteal));
+				if (this == _nextToSteal) {
+					/* never try to steal from ourselves since that wouldn't be possible and the code interprets this case as a uniform system */
+					_nextToSteal = _nextToSteal->getStealingCousin();
+				}
+			} while ((NULL == region) && (firstTheftAttempt != _nextToSteal));
+		}
 	}
+	recordRegionAcquired(region);
 
 	return region;
 }
@@ -669,25 +690,67 @@ MM_AllocationContextBalanced::acquireFreeRegionFromHeap(MM_EnvironmentBase *env)
 	if ((NULL == region) && (_nextToSteal != this)) {
 		MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
 		Assert_MM_true(0 != extensions->_numaManager.getAffinityLeaderCount());
-		/* we didn't get any memory yet we are in a NUMA system so we should steal from a foreign node */
-		MM_AllocationContextBalanced *firstTheftAttempt = _nextToSteal;
-		do {
-			region = _nextToSteal->acquireFreeRegionFromNode(env);
+		/* we didn't get any memory yet we are in a NUMA system so we should steal from a foreign node.  Prefer the node with the
+		 * most memory to spare, so that our theft doesn't force that node to steal in turn
+		 */
+		MM_AllocationContextBalanced *victim = selectCousinToStealFrom();
+		if (NULL != victim) {
+			region = victim->acquireFreeRegionFromNode(env);
 			if (NULL != region) {
-				region->_allocateData._originalOwningContext = _nextToSteal;
+				region->_allocateData._originalOwningContext = victim;
 			}
-			/* advance to the next node whether we succeeded or not since we want to distribute our "theft" as evenly as possible */
-			_nextToSteal = _nextToSteal->getStealingCousin();
-			if (this == _nextToSteal) {
-				/* never try to steal from ourselves since that wouldn't be possible and the code interprets this case as a uniform system */
+		}
+		if (NULL == region) {
+			/* every node is under pressure so fall back to stealing round-robin rather than failing the allocation */
+			MM_AllocationContextBalanced *firstTheftAttempt = _nextToSteal;
+			do {
+				region = _nextToSteal->acquireFreeRegionFromNode(env);
+				if (NULL != region) {
+					region->_allocateData._originalOwningContext = _nextToSteal;
+				}
+				/* advance to the next node whether we succeeded or not since we want to distribute our "theft" as evenly as possible */
 				_nextToSteal = _nextToSteal->getStealingCousin();
-			}
-		} while ((NULL == region) && (firstTheftAttempt != _nextToSteal));
+				if (this == _nextToSteal) {
+					/* never try to steal from ourselves since that wouldn't be possible and the code interprets this case as a uniform system */
+					_nextToSteal = _nextToSteal->getStealingCousin();
+				}
+			} while ((NULL == region) && (firstTheftAttempt != _nextToSteal));
+		}
 	}
+	recordRegionAcquired(region);
 
 	return region;
 }
 
+MM_AllocationContextBalanced *
+MM_AllocationContextBalanced::selectCousinToStealFrom()
+{
+	MM_AllocationContextBalanced *victim = NULL;
+	IDATA mostSpareRegions = 0;
+	MM_AllocationContextBalanced *cousin = _stealingCousin;
+	while (this != cousin) {
+		IDATA spareRegions = cousin->getSpareRegionCount();
+		if (spareRegions > mostSpareRegions) {
+			mostSpareRegions = spareRegions;
+			victim = cousin;
+		}
+		cousin = cousin->getStealingCousin();
+	}
+	return victim;
+}
+
+void
+MM_AllocationContextBalanced::recordRegionAcquired(MM_HeapRegionDescriptorVLHGC *region)
+{
+	if (NULL != region) {
+		if (NULL == region->_allocateData._originalOwningContext) {
+			_localRegionsAcquired += 1;
+		} else {
+			_regionsStolen += 1;
+		}
+	}
+}
+
 MM_HeapRegionDescriptorVLHGC *
 MM_AllocationContextBalanced::acquireMPBPRegionFromNode(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocationContextTarok *requestingContext)
 {
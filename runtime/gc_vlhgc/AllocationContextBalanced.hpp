@@ -70,6 +70,10 @@ private:
 	MM_HeapRegionManager *_heapRegionManager; /**< A cached pointer to the HeapRegionManager */
 	UDATA *_freeProcessorNodes;	/**< The array listing all the NUMA node numbers which account for the nodes with processors but no memory plus an empty slot for each context to use (element 0 is used by this context) - this is used when setting affinity */
 	UDATA _freeProcessorNodeCount;	/**< The length, in elements, of the _freeProcessorNodes array (always at least 1 after startup) */
+	UDATA _localRegionsAcquired; /**< The number of regions the receiver took from its own node since the last flush */
+	UDATA _regionsStolen; /**< The number of regions the receiver stole from foreign nodes since the last flush */
+	UDATA _regionsStolenLastCycle; /**< The value of _regionsStolen at the last flush (reported by TGC) */
+	UDATA _regionDemand; /**< Smoothed number of regions the receiver consumes between flushes.  Other nodes only steal from the receiver's node while it has more free regions than this */
 
 /* Methods */
 public:
@@ -211,6 +215,18 @@ public:
 	 */
 	MM_AllocationContextBalanced *getStealingCousin() { return _stealingCousin; }
 
+	/**
+	 * Measure how many free regions the receiver's node can give away without running dry before the next collection.
+	 * @note Reads the free lists without locking so the answer is only a hint
+	 * @return The number of free regions beyond the receiver's measured demand (negative if the node is under pressure)
+	 */
+	IDATA getSpareRegionCount() { return (IDATA)getFreeRegionCount() - (IDATA)_regionDemand; }
+
+	/**
+	 * @return The number of regions the receiver stole from foreign nodes between the last two flushes, used by TGC
+	 */
+	UDATA getRegionsStolenLastCycle() { return _regionsStolenLastCycle; }
+
 	/**
 	 * Called to reset the largest free entry in all the MemoryPoolBumpPointer instances in the regions managed by the receiver.
 	 */
@@ -293,6 +309,10 @@ protected:
 		, _heapRegionManager(NULL)
 		, _freeProcessorNodes(NULL)
 		, _freeProcessorNodeCount(0)
+		, _localRegionsAcquired(0)
+		, _regionsStolen(0)
+		, _regionsStolenLastCycle(0)
+		, _regionDemand(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -336,6 +356,19 @@ private:
 	 * @return The region or NULL if there were none available in the heap
 	 */
 	MM_HeapRegionDescriptorVLHGC *acquireFreeRegionFromHeap(MM_EnvironmentBase *env);
+
+	/**
+	 * Find the foreign node with the most free regions beyond its own measured demand.
+	 * @return The cousin context managing that node, or NULL if every foreign node is under pressure
+	 */
+	MM_AllocationContextBalanced *selectCousinToStealFrom();
+
+	/**
+	 * Record that the receiver acquired the given region, distinguishing regions taken from its own node from stolen ones.
+	 * @note Caller must hold this context's @ref _contextLock
+	 * @param region[in] The region the receiver acquired (may be NULL)
+	 */
+	void recordRegionAcquired(MM_HeapRegionDescriptorVLHGC *region);
 	
 	/**
 	 * Returns a region descriptor of BUMP_ALLOCATED type on the node where the receiver is resident.  The region may not have been found
@@ -29,6 +29,8 @@
 
 #include "CardListFlushTask.hpp"
 
+#include "AtomicOperations.hpp"
+
 #include "CardTable.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentVLHGC.hpp"
@@ -45,6 +47,10 @@ void
 MM_CardListFlushTask::mainSetup(MM_EnvironmentBase *env)
 {
 	Assert_MM_true(MM_CycleState::CT_PARTIAL_GARBAGE_COLLECTION == env->_cycleState->_collectionType);
+
+	MM_InterRegionRememberedSet *interRegionRememberedSet = MM_GCExtensions::getExtensions(env)->interRegionRememberedSet;
+	interRegionRememberedSet->_flushedCardCount = 0;
+	interRegionRememberedSet->_flushTime = 0;
 }
 
 void
@@ -105,6 +111,9 @@ MM_CardListFlushTask::run(MM_EnvironmentBase *envBase)
 	/* this function has knowledge of the collection set, which is only valid during a PGC */
 	Assert_MM_true(MM_CycleState::CT_PARTIAL_GARBAGE_COLLECTION == env->_cycleState->_collectionType);
 	bool gmpIsActive = (NULL != env->_cycleState->_externalCycleState);
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	U_64 startTime = j9time_hires_clock();
+	UDATA flushedCardCount = 0;
 
 	/* flush RS Lists for CollectionSet and dirty card table */
 	GC_HeapRegionIteratorVLHGC regionIterator(_regionManager);
@@ -121,6 +130,7 @@ MM_CardListFlushTask::run(MM_EnvironmentBase *envBase)
 					GC_RememberedSetCardListCardIterator rsclCardIterator(region->getRememberedSetCardList());
 					UDATA card = 0;
 					while(0 != (card = rsclCardIterator.nextReferencingCard(env))) {
+						flushedCardCount += 1;
 						/* For Marking purposes we do not need to track references within Collection Set */
 						MM_HeapRegionDescriptorVLHGC *referencingRegion = interRegionRememberedSet->tableDescriptorForRememberedSetCard(card);
 						if (interRegionRememberedSet->cardMayContainObjects(card, referencingRegion, markMap) && !referencingRegion->_markData._shouldMark) {
@@ -137,7 +147,7 @@ MM_CardListFlushTask::run(MM_EnvironmentBase *envBase)
 			} else if (shouldFlushBuffersForUnregisteredRegions) {
 				if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
 					/* flush the content of buffers owned by decommitted regions (but used/borrowed by other active regions) */
-					bool const compressed = env->compressObjectReferences();
+					bool const compressed = MM_GCExtensions::getExtensions(env)->compressRememberedSetCards();
 					UDATA toRemoveCount = 0;
 					UDATA totalCountBefore = region->getRememberedSetCardList()->getSize(env);
 					MM_RememberedSetCard *lastCardInCurrentBuffer = NULL;
@@ -163,10 +173,15 @@ MM_CardListFlushTask::run(MM_EnvironmentBase *envBase)
 					}
 					UDATA totalCountAfter = region->getRememberedSetCardList()->getSize(env);
 					Assert_MM_true(totalCountBefore == (toRemoveCount + totalCountAfter));
+					flushedCardCount += toRemoveCount;
 				}
 			}
 		}
 	}
+
+	/* RSCL footprint and scan cost are reported by -Xtgc:interRegionRememberedSet */
+	MM_AtomicOperations::add(&interRegionRememberedSet->_flushedCardCount, flushedCardCount);
+	MM_AtomicOperations::addU64(&interRegionRememberedSet->_flushTime, j9time_hires_clock() - startTime);
 }
 
 void
@@ -129,6 +129,15 @@
 /* If scavenger dynamicBreadthFirstScanOrdering and alwaysDepthCopyFirstOffset is enabled, always copy the first offset of each object after the object itself is copied */
 #define DEFAULT_HOT_FIELD_OFFSET 1
 
+/* The number of reference slots of an object whose referents are prefetched before the slots are copied */
+#define PREFETCH_SLOT_REFERENTS 8
+
+#if defined(__GNUC__) || defined(__clang__)
+#define COPYFORWARD_PREFETCH(address) __builtin_prefetch((const void *)(address))
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define COPYFORWARD_PREFETCH(address)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
 MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegionManager *manager)
 	: MM_BaseNonVirtual()
 	, _javaVM((J9JavaVM *)env->getLanguageVM())
@@ -144,6 +153,8 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegi
 	, _cacheFreeList()
 	, _cacheScanLists(NULL)
 	, _scanCacheListSize(_extensions->_numaManager.getMaximumNodeNumber() + 1)
+	, _scanCacheDeques(NULL)
+	, _scanCacheDequeCount(0)
 	, _scanCacheWaitCount(0)
 	, _scanCacheMonitor(NULL)
 	, _workQueueWaitCountPtr(&_scanCacheWaitCount)
@@ -162,6 +173,7 @@ MM_CopyForwardScheme::MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegi
 	, _dynamicClassUnloadingEnabled(false)
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	, _collectStringConstantsEnabled(false)
+	, _hotFieldGCSamplingRate(0)
 	, _tracingEnabled(false)
 	, _cacheTracingEnabled(false)
 	, _commonContext(NULL)
@@ -308,6 +320,16 @@ MM_CopyForwardScheme::initialize(MM_EnvironmentVLHGC *env)
 	if (NULL == _compactGroupBlock) {
 		return false;
 	}
+
+	/* allocate the per-thread scan cache deques */
+	_scanCacheDeques = (MM_CopyScanCacheDequeVLHGC *)_extensions->getForge()->allocate(sizeof(MM_CopyScanCacheDequeVLHGC) * _extensions->gcThreadCount, MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL == _scanCacheDeques) {
+		return false;
+	}
+	_scanCacheDequeCount = _extensions->gcThreadCount;
+	for (UDATA i = 0; i < _scanCacheDequeCount; i++) {
+		new(&_scanCacheDeques[i]) MM_CopyScanCacheDequeVLHGC();
+	}
 	
 	return true;
 }
@@ -325,6 +347,12 @@ MM_CopyForwardScheme::tearDown(MM_EnvironmentVLHGC *env)
 		_cacheScanLists = NULL;
 	}
 
+	if (NULL != _scanCacheDeques) {
+		env->getForge()->free(_scanCacheDeques);
+		_scanCacheDeques = NULL;
+		_scanCacheDequeCount = 0;
+	}
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -541,6 +569,10 @@ MM_CopyForwardScheme::postProcessRegions(MM_EnvironmentVLHGC *env)
 			} else {
 				/* this is non-empty merged region - estimate its age based on compact group */
 				setAllocationAgeForMergedRegion(env, region);
+				if ((region->getLowAddress() == region->_copyForwardData._survivorBase) && (NULL != region->_allocateData._originalOwningContext)) {
+					/* the whole region was filled with survivors but it had to be stolen from another node */
+					static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats._crossNodeSurvivorBytes += region->getSize() - pool->getActualFreeMemorySize();
+				}
 			}
 		}
 
@@ -1386,6 +1418,12 @@ MM_CopyForwardScheme::mainSetupForCopyForward(MM_EnvironmentVLHGC *env)
 	if (MM_GCExtensions::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == _extensions->scavengerScanOrdering) {
 		MM_HotFieldUtil::sortAllHotFieldData(_javaVM, _extensions->globalVLHGCStats.gcCount);
 	}
+	/* Sample hot fields during this cycle only if there is somewhere to report them */
+	if ((MM_GCExtensions::OMR_GC_SCAVENGER_SCANORDERING_DYNAMIC_BREADTH_FIRST == _extensions->scavengerScanOrdering) && (NULL != _javaVM->hotFieldClassInfoPool)) {
+		_hotFieldGCSamplingRate = _extensions->hotFieldGCSamplingRate;
+	} else {
+		_hotFieldGCSamplingRate = 0;
+	}
 
 	/* Cache of the mark map */
 	_markMap = env->_cycleState->_markMap;
@@ -1716,8 +1754,15 @@ MM_CopyForwardScheme::addCacheEntryToFreeCacheList(MM_EnvironmentVLHGC *env, MM_
 void
 MM_CopyForwardScheme::addCacheEntryToScanCacheListAndNotify(MM_EnvironmentVLHGC *env, MM_CopyScanCacheVLHGC *newCacheEntry)
 {
-	UDATA numaNode = _regionManager->tableDescriptorForAddress(newCacheEntry->scanCurrent)->getNumaNode();
-	_cacheScanLists[numaNode].pushCache(env, newCacheEntry);
+	UDATA workerID = env->getWorkerID();
+	if ((workerID < _scanCacheDequeCount) && _scanCacheDeques[workerID].push(newCacheEntry)) {
+		/* The deque push is not done under a lock, so make it visible before checking for waiting threads */
+		MM_AtomicOperations::sync();
+	} else {
+		/* The deque is full - overflow to the list of the node the cache memory belongs to */
+		UDATA numaNode = _regionManager->tableDescriptorForAddress(newCacheEntry->scanCurrent)->getNumaNode();
+		_cacheScanLists[numaNode].pushCache(env, newCacheEntry);
+	}
 	if (0 != *_workQueueWaitCountPtr) {
 		/* Added an entry to the scan list - notify any other threads that a new entry has appeared on the list */
 		omrthread_monitor_enter(*_workQueueMonitorPtr);
@@ -2094,7 +2139,7 @@ MMINLINE void
 MM_CopyForwardScheme::depthCopyHotFields(MM_EnvironmentVLHGC *env, J9Class *clazz, J9Object *destinationObjectPtr, MM_AllocationContextTarok *reservingContext) {
 	/* depth copy the hot fields of an object up to a depth specified by depthCopyMax */
 	J9ClassHotFieldsInfo* hotFieldsInfo = clazz->hotFieldsInfo;
-	if (env->_hotFieldCopyDepthCount < _extensions->depthCopyMax && NULL != hotFieldsInfo) {
+	if (env->_hotFieldCopyDepthCount < _extensions->depthCopyMax && NULL != hotFieldsInfo && !hotFieldsInfo->isBreadthFirstCopyPreferred) {
 		U_8 hotFieldOffset = hotFieldsInfo->hotFieldOffset1;
 		if (U_8_MAX != hotFieldOffset) {
 			copyHotField(env, destinationObjectPtr, hotFieldOffset, reservingContext);
@@ -2122,8 +2167,45 @@ MM_CopyForwardScheme::copyHotField(MM_EnvironmentVLHGC *env, J9Object *destinati
 		MM_ForwardedHeader forwardHeaderHotField(objectPtr, compressed);
 		if (!forwardHeaderHotField.isForwardedPointer()) {
 			env->_hotFieldCopyDepthCount += 1;
-			copy(env, reservingContext, &forwardHeaderHotField);
+			J9Object *hotFieldDestinationPtr = copy(env, reservingContext, &forwardHeaderHotField);
 			env->_hotFieldCopyDepthCount -= 1;
+			if (hotFieldDestinationPtr != objectPtr) {
+				env->_copyForwardStats._hotFieldsDepthCopied += 1;
+				/* the mutator gets the locality benefit if the hot referent shares a cache line pair with its parent's header */
+				if (((UDATA)hotFieldDestinationPtr - (UDATA)destinationObjectPtr) < (2 * _cacheLineAlignment)) {
+					env->_copyForwardStats._hotFieldsCopiedAdjacent += 1;
+				}
+			}
+		}
+	}
+}
+
+MMINLINE bool
+MM_CopyForwardScheme::shouldSampleHotFields(MM_EnvironmentVLHGC *env)
+{
+	bool result = false;
+	if (0 != _hotFieldGCSamplingRate) {
+		if (0 == env->_hotFieldSampleCountdown) {
+			env->_hotFieldSampleCountdown = _hotFieldGCSamplingRate;
+			result = true;
+		}
+		env->_hotFieldSampleCountdown -= 1;
+	}
+	return result;
+}
+
+MMINLINE void
+MM_CopyForwardScheme::sampleHotField(MM_EnvironmentVLHGC *env, J9Object *objectPtr, GC_SlotObject *slotObject)
+{
+	J9Object *referent = slotObject->readReferenceFromSlot();
+	if (isObjectInEvacuateMemory(referent)) {
+		J9Class *clazz = J9GC_J9OBJECT_CLAZZ(objectPtr, env);
+		/* hot field offsets are in reference slots from the start of the object, as reported by the JIT */
+		UDATA hotFieldOffset = ((UDATA)slotObject->readAddressFromSlot() - (UDATA)objectPtr) / J9JAVAVM_REFERENCE_SIZE(_javaVM);
+		/* like the JIT, never report fields of anonymous classes */
+		if ((hotFieldOffset < U_8_MAX) && J9_ARE_NO_BITS_SET(J9CLASS_EXTENDED_FLAGS(clazz), J9ClassIsAnonymous)) {
+			MM_HotFieldUtil::addHotFieldSample(_javaVM, env->_hotFieldSamples, &env->_hotFieldSampleCount, clazz, (uint8_t)hotFieldOffset);
+			env->_copyForwardStats._hotFieldsSampled += 1;
 		}
 	}
 }
@@ -2270,6 +2352,9 @@ MM_CopyForwardScheme::iterateAndCopyforwardSlotReference(MM_EnvironmentVLHGC *en
 	UDATA leafBits;
 #endif /* J9VM_GC_LEAF_BITS */
 	bool const compressed = env->compressObjectReferences();
+	bool const sampleHotFields = shouldSampleHotFields(env);
+
+	prefetchSlotReferents(env, objectPtr);
 
 	/* Object slots */
 	volatile fj9object_t* scanPtr = _extensions->mixedObjectModel.getHeadlessObject(objectPtr);
@@ -2296,6 +2381,10 @@ MM_CopyForwardScheme::iterateAndCopyforwardSlotReference(MM_EnvironmentVLHGC *en
 		if (descriptionBits & 1) {
 			GC_SlotObject slotObject(_javaVM->omrVM, scanPtr);
 
+			if (sampleHotFields) {
+				sampleHotField(env, objectPtr, &slotObject);
+			}
+
 		/* Copy/Forward the slot reference and perform any inter-region remember work that is required */
 #if defined(J9VM_GC_LEAF_BITS)
 			success = copyAndForward(env, reservingContext, objectPtr, &slotObject, 1 == (leafBits & 1));
@@ -2319,6 +2408,36 @@ MM_CopyForwardScheme::iterateAndCopyforwardSlotReference(MM_EnvironmentVLHGC *en
 	return success;
 }
 
+MMINLINE void
+MM_CopyForwardScheme::prefetchSlotReferents(MM_EnvironmentVLHGC *env, J9Object *objectPtr)
+{
+	bool const compressed = env->compressObjectReferences();
+	fomrobject_t *scanPtr = (fomrobject_t *)_extensions->mixedObjectModel.getHeadlessObject(objectPtr);
+	fomrobject_t *endScanPtr = (fomrobject_t *)(((U_8 *)objectPtr) + _extensions->mixedObjectModel.getSizeInBytesWithHeader(objectPtr));
+	UDATA *descriptionPtr = (UDATA *)J9GC_J9OBJECT_CLAZZ(objectPtr, env)->instanceDescription;
+	UDATA descriptionBits = 0;
+	if (((UDATA)descriptionPtr) & 1) {
+		descriptionBits = ((UDATA)descriptionPtr) >> 1;
+	} else {
+		descriptionBits = *descriptionPtr;
+	}
+
+	/* Only the first description word is looked at; it covers the slots most likely to be hot */
+	UDATA prefetched = 0;
+	for (UDATA descriptionIndex = 0; (0 != descriptionBits) && (scanPtr < endScanPtr) && (descriptionIndex < J9_OBJECT_DESCRIPTION_SIZE) && (prefetched < PREFETCH_SLOT_REFERENTS); descriptionIndex++) {
+		if (descriptionBits & 1) {
+			GC_SlotObject slotObject(_javaVM->omrVM, scanPtr);
+			omrobjectptr_t referent = slotObject.readReferenceFromSlot();
+			if (NULL != referent) {
+				COPYFORWARD_PREFETCH(referent);
+				prefetched += 1;
+			}
+		}
+		descriptionBits >>= 1;
+		scanPtr = GC_SlotObject::addToSlotAddress(scanPtr, 1, compressed);
+	}
+}
+
 void
 MM_CopyForwardScheme::scanMixedObjectSlots(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr, ScanReason reason)
 {
@@ -2614,9 +2733,19 @@ MM_CopyForwardScheme::isScanCacheWorkAvailable(MM_CopyScanCacheListVLHGC *scanCa
 }
 
 bool
-MM_CopyForwardScheme::isAnyScanCacheWorkAvailable()
+MM_CopyForwardScheme::isAnyScanCacheDequeWorkAvailable()
 {
 	bool result = false;
+	for (UDATA i = 0; (!result) && (i < _scanCacheDequeCount); i++) {
+		result = !_scanCacheDeques[i].isEmpty();
+	}
+	return result;
+}
+
+bool
+MM_CopyForwardScheme::isAnyScanCacheWorkAvailable()
+{
+	bool result = isAnyScanCacheDequeWorkAvailable();
 	UDATA nodeLists = _scanCacheListSize;
 	for (UDATA i = 0; (!result) && (i < nodeLists); i++) {
 		result = isScanCacheWorkAvailable(&_cacheScanLists[i]);
@@ -2690,6 +2819,7 @@ MM_CopyForwardScheme::getNextWorkUnit(MM_EnvironmentVLHGC *env, UDATA preferredN
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 						PORT_ACCESS_FROM_ENVIRONMENT(env);
 						U_64 waitEndTime, waitStartTime;
+						env->_copyForwardStats._idleCount += 1;
 						waitStartTime = j9time_hires_clock();
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 						omrthread_monitor_wait(*_workQueueMonitorPtr);
@@ -2739,12 +2869,53 @@ MM_CopyForwardScheme::getNextWorkUnitOnNode(MM_EnvironmentVLHGC *env, UDATA numa
 	return ret;
 }
 
+MM_CopyForwardScheme::ScanReason
+MM_CopyForwardScheme::stealWorkUnit(MM_EnvironmentVLHGC *env)
+{
+	ScanReason ret = SCAN_REASON_NONE;
+	UDATA workerID = env->getWorkerID();
+	for (UDATA i = 1; (SCAN_REASON_NONE == ret) && (i < _scanCacheDequeCount); i++) {
+		MM_CopyScanCacheDequeVLHGC *victim = &_scanCacheDeques[(workerID + i) % _scanCacheDequeCount];
+		if (!victim->isEmpty()) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_copyForwardStats._stealAttemptCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			MM_CopyScanCacheVLHGC *cache = victim->steal();
+			if (NULL != cache) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				env->_copyForwardStats._stealCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				env->_scanCache = cache;
+				ret = SCAN_REASON_COPYSCANCACHE;
+			}
+		}
+	}
+	return ret;
+}
+
 MM_CopyForwardScheme::ScanReason
 MM_CopyForwardScheme::getNextWorkUnitNoWait(MM_EnvironmentVLHGC *env, UDATA preferredNumaNode)
 {
 	UDATA nodeLists = _scanCacheListSize;
 	ScanReason ret = SCAN_REASON_NONE;
-	/* local node first */
+	/* own deque first, it holds the caches most recently produced (and still hot in the cache) for this thread */
+	UDATA workerID = env->getWorkerID();
+	if (workerID < _scanCacheDequeCount) {
+		MM_CopyScanCacheVLHGC *cache = _scanCacheDeques[workerID].pop();
+		if (NULL != cache) {
+			/* Check if there are threads waiting that could steal the remaining entries */
+			if ((0 != *_workQueueWaitCountPtr) && !_scanCacheDeques[workerID].isEmpty()) {
+				omrthread_monitor_enter(*_workQueueMonitorPtr);
+				if (0 != *_workQueueWaitCountPtr) {
+					omrthread_monitor_notify(*_workQueueMonitorPtr);
+				}
+				omrthread_monitor_exit(*_workQueueMonitorPtr);
+			}
+			env->_scanCache = cache;
+			return SCAN_REASON_COPYSCANCACHE;
+		}
+	}
+	/* then the local node */
 	ret = getNextWorkUnitOnNode(env, preferredNumaNode);
 	if (SCAN_REASON_NONE == ret) {
 		/* we failed to find a scan cache on our preferred node */
@@ -2761,6 +2932,10 @@ MM_CopyForwardScheme::getNextWorkUnitNoWait(MM_EnvironmentVLHGC *env, UDATA pref
 			nextNode = (nextNode + 1) % nodeLists;
 		}
 	}
+	if (SCAN_REASON_NONE == ret) {
+		/* all lists are empty, steal from the other threads */
+		ret = stealWorkUnit(env);
+	}
 	if (SCAN_REASON_NONE == ret && (0 != _regionCountCannotBeEvacuated) && !abortFlagRaised()) {
 		if (env->_workStack.retrieveInputPacket(env)) {
 			ret = SCAN_REASON_PACKET;
@@ -4214,6 +4389,11 @@ MM_CopyForwardScheme::workThreadGarbageCollect(MM_EnvironmentVLHGC *env)
 	/* flush ownable synchronizer object buffer after rebuild the ownableSynchronizerObjectList during main scan phase */
 	env->getGCEnvironment()->_ownableSynchronizerObjectBuffer->flush(env);
 
+	/* report the hot fields sampled by this thread so they are ranked with the JIT's hot fields at the next sort */
+	if (0 != env->_hotFieldSampleCount) {
+		MM_HotFieldUtil::reportHotFieldSamples(_javaVM, env->_hotFieldSamples, &env->_hotFieldSampleCount);
+	}
+
 	/* No matter what happens, always sum up the gc stats */
 	mergeGCStats(env);
 
@@ -34,6 +34,7 @@
 
 #include "BaseNonVirtual.hpp"
 
+#include "CopyScanCacheDequeVLHGC.hpp"
 #include "CopyScanCacheListVLHGC.hpp"
 #include "EnvironmentVLHGC.hpp"
 #include "GCExtensions.hpp"
@@ -118,6 +119,8 @@ private:
 	MM_CopyScanCacheListVLHGC _cacheFreeList;  /**< Caches which are not bound to heap memory and available to be populated */
 	MM_CopyScanCacheListVLHGC *_cacheScanLists;  /**< An array of per-node caches which contains objects still to be scanned (1+node_count elements in array)*/
 	UDATA _scanCacheListSize;	/**< The number of entries in _cacheScanLists */
+	MM_CopyScanCacheDequeVLHGC *_scanCacheDeques; /**< Per-thread (indexed by worker ID) deques of caches still to be scanned. Overflow goes to _cacheScanLists */
+	UDATA _scanCacheDequeCount; /**< The number of entries in _scanCacheDeques */
 	volatile UDATA _scanCacheWaitCount;	/**< The number of threads currently sleeping on _scanCacheMonitor, awaiting scan cache work */
 	omrthread_monitor_t _scanCacheMonitor;	/**< Used when waiting on work on any of the _cacheScanLists */
 
@@ -145,6 +148,7 @@ private:
 	bool _dynamicClassUnloadingEnabled;  /**< Local cached value from cycle state for performance reasons (TODO: Reevaluate) */
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
 	bool _collectStringConstantsEnabled;  /**< Local cached value which determines whether string constants are roots */
+	UDATA _hotFieldGCSamplingRate;  /**< Local cached value of hotFieldGCSamplingRate for this cycle (0 if hot fields are not being sampled) */
 
 	bool _tracingEnabled;  /**< Temporary variable to enable tracing of activity */
 	bool _cacheTracingEnabled;  /**< Temporary variable to enable tracing of activity */
@@ -613,6 +617,19 @@ private:
 	 */
 	ScanReason getNextWorkUnitOnNode(MM_EnvironmentVLHGC *env, UDATA numaNode);
 
+	/**
+	 * Tries to steal a scan cache from the deque of another GC thread, starting with the thread following the caller
+	 * @param env[in] The GC thread
+	 * @return possible return value(SCAN_REASON_NONE, SCAN_REASON_COPYSCANCACHE)
+	 */
+	ScanReason stealWorkUnit(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Checks to see if there is scan work in any of the per-thread deques.
+	 * @return True if any deque contains work
+	 */
+	bool isAnyScanCacheDequeWorkAvailable();
+
 	/**
 	 * Complete scanning in Copy-Forward fashion (consume&produce CopyScanCaches)
 	 * If abort happens midway through all produced work is pushed on Marking WorkStack
@@ -871,6 +888,21 @@ private:
 	 * @param offset  - the object field offset of the hot field to be copied 
 	 */ 
 	MMINLINE void copyHotField(MM_EnvironmentVLHGC *env, J9Object *destinationObjectPtr, U_8 offset, MM_AllocationContextTarok *reservingContext);
+
+	/**
+	 * Determine if the reference fields of the next object scanned by this thread should be sampled as hot field evidence.
+	 * One in every _hotFieldGCSamplingRate objects is sampled.
+	 */
+	MMINLINE bool shouldSampleHotFields(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Record the slot of objectPtr as a hot field sample if it refers to an object being evacuated, that is a live object
+	 * whose placement relative to objectPtr is decided by this copy-forward.
+	 * Valid if dynamicBreadthFirstScanOrdering is enabled.
+	 * @param objectPtr - the object being scanned
+	 * @param slotObject - a reference slot of objectPtr, not yet copied
+	 */
+	MMINLINE void sampleHotField(MM_EnvironmentVLHGC *env, J9Object *objectPtr, GC_SlotObject *slotObject);
 	/**
 	 * Push any remaining cached mark map data out before the copy scan cache is released.
 	 * @param env GC thread.
@@ -981,6 +1013,12 @@ private:
 	 */
 	MMINLINE bool iterateAndCopyforwardSlotReference(MM_EnvironmentVLHGC *env, MM_AllocationContextTarok *reservingContext, J9Object *objectPtr);
 
+	/**
+	 * Issue software prefetches for the objects referenced by the first slots of objectPtr, so that their
+	 * headers are (being) brought into the cache by the time the slots are copied.
+	 */
+	MMINLINE void prefetchSlotReferents(MM_EnvironmentVLHGC *env, J9Object *objectPtr);
+
 protected:
 
 	MM_CopyForwardScheme(MM_EnvironmentVLHGC *env, MM_HeapRegionManager *manager);
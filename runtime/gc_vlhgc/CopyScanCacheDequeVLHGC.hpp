@@ -0,0 +1,147 @@
+/*******************************************************************************
+ * Copyright (c) 2022, 2022 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(COPYSCANCACHEDEQUEVLHGC_HPP_)
+#define COPYSCANCACHEDEQUEVLHGC_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+
+class MM_CopyScanCacheVLHGC;
+
+/**
+ * Bounded work-stealing deque of scan caches (Chase-Lev). Each GC thread owns one deque:
+ * the owner pushes and pops at the bottom without locking, other threads steal from the top
+ * with a single compare-and-swap. When the deque is full the owner falls back to the shared
+ * scan cache lists.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_CopyScanCacheDequeVLHGC
+{
+	/* Data Members */
+public:
+	enum {
+		CAPACITY = 64 /**< number of entries; must be a power of two */
+	};
+
+private:
+	volatile UDATA _top; /**< next index to steal from; only ever incremented, by CAS */
+	volatile UDATA _bottom; /**< next index to push to; written only by the owner */
+	MM_CopyScanCacheVLHGC * volatile _entries[CAPACITY];
+
+	/* Member Functions */
+public:
+	/**
+	 * Push a cache on the bottom of the deque. Must only be called by the owning thread.
+	 * @return false if the deque is full, in which case the cache was not pushed
+	 */
+	MMINLINE bool
+	push(MM_CopyScanCacheVLHGC *cache)
+	{
+		UDATA bottom = _bottom;
+		UDATA top = _top;
+		if ((IDATA)(bottom - top) >= (IDATA)CAPACITY) {
+			return false;
+		}
+		_entries[bottom & (CAPACITY - 1)] = cache;
+		/* the entry must be visible before thieves can see the new bottom */
+		MM_AtomicOperations::storeSync();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed cache. Must only be called by the owning thread.
+	 * @return the cache, or NULL if the deque is empty or the last entry was stolen
+	 */
+	MMINLINE MM_CopyScanCacheVLHGC *
+	pop()
+	{
+		UDATA bottom = _bottom - 1;
+		_bottom = bottom;
+		/* the new bottom must be visible to thieves before we read top */
+		MM_AtomicOperations::sync();
+		UDATA top = _top;
+		MM_CopyScanCacheVLHGC *cache = NULL;
+		if ((IDATA)(bottom - top) >= 0) {
+			cache = _entries[bottom & (CAPACITY - 1)];
+			if (bottom == top) {
+				/* last entry - race with thieves for it */
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					cache = NULL;
+				}
+				_bottom = bottom + 1;
+			}
+		} else {
+			_bottom = bottom + 1;
+		}
+		return cache;
+	}
+
+	/**
+	 * Steal the oldest cache. May be called by any thread.
+	 * @return the cache, or NULL if the deque is empty or another thread won the race for the entry
+	 */
+	MMINLINE MM_CopyScanCacheVLHGC *
+	steal()
+	{
+		UDATA top = _top;
+		MM_AtomicOperations::sync();
+		UDATA bottom = _bottom;
+		MM_CopyScanCacheVLHGC *cache = NULL;
+		if ((IDATA)(bottom - top) > 0) {
+			cache = _entries[top & (CAPACITY - 1)];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				cache = NULL;
+			}
+		}
+		return cache;
+	}
+
+	/**
+	 * Determine if the deque looks empty. The answer is only a hint unless all threads are idle.
+	 */
+	MMINLINE bool isEmpty() { return (IDATA)(_bottom - _top) <= 0; }
+
+	void
+	clear()
+	{
+		_top = 0;
+		_bottom = 0;
+	}
+
+	MM_CopyScanCacheDequeVLHGC()
+		: _top(0)
+		, _bottom(0)
+	{
+	}
+};
+
+#endif /* COPYSCANCACHEDEQUEVLHGC_HPP_ */
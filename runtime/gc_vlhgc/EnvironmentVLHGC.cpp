@@ -41,6 +41,8 @@ MM_EnvironmentVLHGC::MM_EnvironmentVLHGC(OMR_VMThread *omrVMThread)
 	, _rsclBufferControlBlockCount(0)
 	, _rememberedSetCardBucketPool(NULL)
 	, _lastOverflowedRsclWithReleasedBuffers(NULL)
+	, _hotFieldSampleCount(0)
+	, _hotFieldSampleCountdown(0)
 {
 	_typeId = __FUNCTION__;
 }
@@ -60,6 +62,8 @@ MM_EnvironmentVLHGC::MM_EnvironmentVLHGC(J9JavaVM *javaVM)
 	, _rsclBufferControlBlockCount(0)
 	, _rememberedSetCardBucketPool(NULL)
 	, _lastOverflowedRsclWithReleasedBuffers(NULL)
+	, _hotFieldSampleCount(0)
+	, _hotFieldSampleCountdown(0)
 {
 	_typeId = __FUNCTION__;
 }
@@ -40,6 +40,7 @@
 #endif /* J9VM_GC_MODRON_COMPACTION */
 #include "CycleStateVLHGC.hpp"
 #include "EnvironmentBase.hpp"
+#include "HotFieldUtil.hpp"
 #include "OwnableSynchronizerObjectBufferVLHGC.hpp"
 #include "ReferenceObjectBufferVLHGC.hpp"
 #include "UnfinalizedObjectBufferVLHGC.hpp"
@@ -76,6 +77,9 @@ public:
 	MM_RememberedSetCardList *_lastOverflowedRsclWithReleasedBuffers; /**< in global list of overflowed RSCL, this is the last RSCL this thread visited */
 
 	MM_CopyForwardStats _copyForwardStats;  /**< GC thread local statistics structure for copy forward collections */
+	MM_HotFieldSample _hotFieldSamples[HOT_FIELD_SAMPLE_BUFFER_SIZE]; /**< hot field samples taken by this thread during copy forward, not yet reported */
+	UDATA _hotFieldSampleCount; /**< number of entries in use in _hotFieldSamples */
+	UDATA _hotFieldSampleCountdown; /**< number of objects this thread scans before sampling the next one */
 
 	MM_MarkVLHGCStats _markVLHGCStats;
 	MM_SweepVLHGCStats _sweepVLHGCStats;
@@ -915,6 +915,11 @@ MM_IncrementalGenerationalGC::partialGarbageCollectPreWork(MM_EnvironmentVLHGC *
 	/* Perform any main-specific setup */
 	_extensions->globalVLHGCStats.gcCount += 1;
 
+	/* Regions whose RSCL was rebuilt concurrently can be collected again. References the mutator created since the
+	 * walk passed their source are in dirty cards, which this PGC scans, so the RSCLs are accurate for this collection.
+	 */
+	_interRegionRememberedSet->completeConcurrentRebuild(env);
+
 	/*
 	 * Core collection work.
 	 */
@@ -997,6 +1002,11 @@ MM_IncrementalGenerationalGC::partialGarbageCollectPostWork(MM_EnvironmentVLHGC
 
 	incrementRegionAges(env, _taxationThreshold, true);
 
+	if (!isGlobalMarkPhaseRunning()) {
+		/* rebuild RSCLs which overflowed during this PGC concurrently, rather than leave the regions uncollectable until the next GMP */
+		_interRegionRememberedSet->startConcurrentRebuild(env);
+	}
+
 	reportGCCycleFinalIncrementEnding(env);
 	reportGCIncrementEnd(env);
 	reportPGCEnd(env);
@@ -1943,8 +1953,10 @@ MM_IncrementalGenerationalGC::isConcurrentWorkAvailable(MM_EnvironmentBase *env)
 	bool isProcessingWorkPackets = MM_CycleState::state_process_work_packets_after_initial_mark == _persistentGlobalMarkPhaseState._markDelegateState;
 	bool isStillPermittedToRun = !_forceConcurrentTermination;
 	bool isGMPWorkAvailable = _globalMarkPhaseIncrementBytesStillToScan > 0;
+	/* outside of a GMP, the main thread rebuilds the RSCLs of regions which overflowed since the last GMP */
+	bool isRebuildWorkAvailable = !isGMPRunning && !_copyForwardDelegate.isConcurrentCycleInProgress() && _interRegionRememberedSet->isConcurrentRebuildWorkAvailable();
 	
-	return isConcurrentEnabled && isGMPRunning && isProcessingWorkPackets && isStillPermittedToRun && isGMPWorkAvailable;
+	return isStillPermittedToRun && ((isConcurrentEnabled && isGMPRunning && isProcessingWorkPackets && isGMPWorkAvailable) || isRebuildWorkAvailable);
 }
 
 void
@@ -1954,6 +1966,11 @@ MM_IncrementalGenerationalGC::preConcurrentInitializeStatsAndReport(MM_Environme
 	Assert_MM_true(NULL == env->_cycleState);
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
 
+	if (!isGlobalMarkPhaseRunning()) {
+		/* the concurrent RSCL rebuild has no cycle state and is not reported as a concurrent mark phase */
+		return;
+	}
+
 	stats->_cycleID = _persistentGlobalMarkPhaseState._verboseContextID;
 	stats->_scanTargetInBytes = _globalMarkPhaseIncrementBytesStillToScan;
 	env->_cycleState = &_persistentGlobalMarkPhaseState;
@@ -1974,6 +1991,13 @@ MM_IncrementalGenerationalGC::mainThreadConcurrentCollect(MM_EnvironmentBase *en
 	/* note that we can't check isConcurrentWorkAvailable at this point since another thread could have set _forceConcurrentTermination since the
 	 * main thread calls this outside of the control monitor
 	 */
+	if (!isGlobalMarkPhaseRunning()) {
+		/* We pass a pointer to _forceConcurrentTermination for the same reason as for the concurrent GMP work below */
+		UDATA bytesConcurrentlyScanned = _interRegionRememberedSet->rebuildOverflowedRegionsConcurrently(env, &_forceConcurrentTermination);
+		_interRegionRememberedSet->releaseCardBufferControlBlockListForThread(env, env);
+		return bytesConcurrentlyScanned;
+	}
+
 	Assert_MM_true(env->_cycleState == &_persistentGlobalMarkPhaseState);
 	Assert_MM_true(isGlobalMarkPhaseRunning());
 	Assert_MM_true(MM_CycleState::state_process_work_packets_after_initial_mark == _persistentGlobalMarkPhaseState._markDelegateState);
@@ -2002,6 +2026,10 @@ void
 MM_IncrementalGenerationalGC::postConcurrentUpdateStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats, UDATA bytesConcurrentlyScanned)
 {
 	Assert_MM_false(isConcurrentWorkAvailable(env));
+	if (!isGlobalMarkPhaseRunning()) {
+		Assert_MM_true(NULL == env->_cycleState);
+		return;
+	}
 	Assert_MM_true(env->_cycleState == &_persistentGlobalMarkPhaseState);
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
 
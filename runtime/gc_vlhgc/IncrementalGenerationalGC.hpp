@@ -372,7 +372,8 @@ public:
 	virtual void preConcurrentInitializeStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats);
 
 	/**
-	 * The entry-point used by the main GC thread to perform concurrent GMP work.  isConcurrentWorkAvailable must be true.
+	 * The entry-point used by the main GC thread to perform concurrent GMP work or, if no GMP is running, the concurrent rebuild
+	 * of overflowed RSCLs.  isConcurrentWorkAvailable must be true.
 	 * @param env[in] The main GC thread
 	 * @return The number of bytes scanned by this invocation of the concurrent task
 	 */
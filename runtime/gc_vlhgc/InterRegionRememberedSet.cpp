@@ -32,10 +32,14 @@
 #include "AtomicOperations.hpp"
 #include "Bits.hpp"
 #include "CardTable.hpp"
+#include "ClassIterator.hpp"
+#include "ClassIteratorClassSlots.hpp"
+#include "ClassLoaderClassesIterator.hpp"
 #include "ClassLoaderRememberedSet.hpp"
 #include "CollectionStatisticsVLHGC.hpp"
 #include "CycleState.hpp"
 #include "EnvironmentVLHGC.hpp"
+#include "HeapMapIterator.hpp"
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "MixedObjectIterator.hpp"
 #include "ParallelDispatcher.hpp"
@@ -43,6 +47,7 @@
 #include "RememberedSetCardListBufferIterator.hpp"
 #include "RememberedSetCardListCardIterator.hpp"
 #include "Task.hpp"
+#include "VMInterface.hpp"
 #include "VMThreadListIterator.hpp"
 
 MM_InterRegionRememberedSet::MM_InterRegionRememberedSet(MM_HeapRegionManager *heapRegionManager)
@@ -59,16 +64,23 @@ MM_InterRegionRememberedSet::MM_InterRegionRememberedSet(MM_HeapRegionManager *h
 	, _overflowedRegionCount(0)
 	, _stableRegionCount(0)
 	, _beingRebuiltRegionCount(0)
+	, _concurrentRebuildInProgress(false)
+	, _concurrentRebuildWalkComplete(false)
+	, _concurrentRebuildNextRegionIndex(0)
 	, _unusedRegionThreshold(0.0)
 	, _regionTable(NULL)
 	, _tableDescriptorSize(0)
 	, _cardToRegionShift(0)
 	, _cardToRegionDisplacement(0)
+	, _cardIndexBase(0)
+	, _flushedCardCount(0)
+	, _flushTime(0)
 	, _cardTable(NULL)
 	, _rememberedSetCardBucketPool(NULL)
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
 	, _compressObjectReferences(false)
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
+	, _compressRememberedSetCards(false)
 {
 	_typeId = __FUNCTION__;
 }
@@ -91,7 +103,7 @@ MM_InterRegionRememberedSet::newInstance(MM_EnvironmentVLHGC* env, MM_HeapRegion
 void
 MM_InterRegionRememberedSet::exportStats(MM_EnvironmentVLHGC* env, MM_CollectionStatisticsVLHGC *stats)
 {
-	uintptr_t const cardSize = MM_RememberedSetCard::cardSize(env->compressObjectReferences());
+	uintptr_t const cardSize = MM_RememberedSetCard::cardSize(MM_GCExtensions::getExtensions(env)->compressRememberedSetCards());
 	/* TODO: this formula for _rememberedSetCount is an overstatement - try to be more accurate */
 	stats->_rememberedSetCount = (_bufferCountTotal - _freeBufferCount) * MM_RememberedSetCardBucket::MAX_BUFFER_SIZE;
 	stats->_rememberedSetBytesFree = _freeBufferCount * MM_RememberedSetCardBucket::MAX_BUFFER_SIZE * cardSize;
@@ -182,7 +194,7 @@ MM_InterRegionRememberedSet::allocateRegionBuffers(MM_EnvironmentVLHGC* env, MM_
 		success = true;
 	} else {
 		MM_GCExtensions *ext = MM_GCExtensions::getExtensions(env);
-		bool const compressed = env->compressObjectReferences();
+		bool const compressed = ext->compressRememberedSetCards();
 		uintptr_t const cardSize = MM_RememberedSetCard::cardSize(compressed);
 		UDATA bufferSize = MM_RememberedSetCardBucket::MAX_BUFFER_SIZE * cardSize;
 		UDATA bufferCount = ext->tarokRememberedSetCardListSize / MM_RememberedSetCardBucket::MAX_BUFFER_SIZE;
@@ -246,12 +258,23 @@ MM_InterRegionRememberedSet::initialize(MM_EnvironmentVLHGC* env)
 	if (!_lock.initialize(env, &ext->lnrlOptions, "MM_InterRegionRememberedSet:_lock")) {
 		return false;
 	}
+	if (!env->compressObjectReferences() && ext->tarokCompressRememberedSetCards) {
+		/* 32-bit cards on a full pointer heap are card indices relative to the heap base, and card 0 is reserved
+		 * for empty entries. Fall back to full heap address cards if the heap spans too many cards to index.
+		 * This has to be decided before the first RSCL buffer is carved out.
+		 */
+		UDATA heapCardCount = (_heapRegionManager->getTableRegionCount() * _heapRegionManager->getRegionSize()) >> CARD_SIZE_SHIFT;
+		if (heapCardCount >= (UDATA)U_32_MAX) {
+			ext->tarokCompressRememberedSetCards = false;
+		}
+	}
+
 	/* if tarokRememberedSetCardListSize is not a multiple of  MM_RememberedSetCardBucket::MAX_BUFFER_SIZE, we are going to allocate a little less */
 	_bufferControlBlockCountPerRegion = ext->tarokRememberedSetCardListSize / MM_RememberedSetCardBucket::MAX_BUFFER_SIZE;
 	UDATA totalBufferControlBlockCount = _bufferControlBlockCountPerRegion * _heapRegionManager->getTableRegionCount();
 	UDATA rsclBufferControlBlockPoolSize = totalBufferControlBlockCount * sizeof(MM_CardBufferControlBlock);
 	/* buffer size has to be a power of 2 */
-	uintptr_t const cardSize = MM_RememberedSetCard::cardSize(env->compressObjectReferences());
+	uintptr_t const cardSize = MM_RememberedSetCard::cardSize(ext->compressRememberedSetCards());
 	UDATA bufferSize = MM_RememberedSetCardBucket::MAX_BUFFER_SIZE * cardSize;
 	Assert_MM_true(((UDATA)1 << MM_Bits::leadingZeroes(bufferSize)) == bufferSize);
 
@@ -279,7 +302,13 @@ MM_InterRegionRememberedSet::initialize(MM_EnvironmentVLHGC* env)
 		_cardToRegionDisplacement = baseOfHeap >> CARD_SIZE_SHIFT;
 	} else
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) */
-	{
+	if (ext->compressRememberedSetCards()) {
+		/* card 0 must never refer to the heap, so the first card of the heap is card 1 */
+		_compressRememberedSetCards = true;
+		_cardIndexBase = baseOfHeap - CARD_SIZE;
+		_cardToRegionShift = _heapRegionManager->_regionShift - CARD_SIZE_SHIFT;
+		_cardToRegionDisplacement = 1;
+	} else {
 		_cardToRegionShift = _heapRegionManager->_regionShift;
 		_cardToRegionDisplacement = baseOfHeap;
 	}
@@ -604,12 +633,18 @@ void
 MM_InterRegionRememberedSet::prepareRegionsForGlobalCollect(MM_EnvironmentVLHGC *env, bool gmpInProgress)
 {
 	if (!gmpInProgress) {
-		Assert_MM_true(0 == _beingRebuiltRegionCount);
+		/* a concurrent rebuild is superseded by the global collect, which rebuilds all RSCLs */
+		Assert_MM_true(_concurrentRebuildInProgress || (0 == _beingRebuiltRegionCount));
+		_concurrentRebuildInProgress = false;
+		_concurrentRebuildWalkComplete = false;
 		/* since we aren't picking up a partially-completed mark state, we can safely clear all remembered object meta-data */
 		GC_HeapRegionIteratorVLHGC regionIterator(_heapRegionManager);
 		MM_HeapRegionDescriptorVLHGC *region = NULL;
 		while (NULL != (region = regionIterator.nextRegion())) {
-			Assert_MM_false(region->getRememberedSetCardList()->isBeingRebuilt());
+			if (region->getRememberedSetCardList()->isBeingRebuilt()) {
+				region->getRememberedSetCardList()->setAsRebuildingComplete();
+				_beingRebuiltRegionCount -= 1;
+			}
 			if (region->getRememberedSetCardList()->isOverflowed()) {
 				if (region->getRememberedSetCardList()->isStable()) {
 					_stableRegionCount -= 1;
@@ -621,6 +656,7 @@ MM_InterRegionRememberedSet::prepareRegionsForGlobalCollect(MM_EnvironmentVLHGC
 		}
 		Assert_MM_true(0 == _overflowedRegionCount);
 		Assert_MM_true(0 == _stableRegionCount);
+		Assert_MM_true(0 == _beingRebuiltRegionCount);
 	}
 }
 
@@ -629,11 +665,21 @@ MM_InterRegionRememberedSet::prepareOverflowedRegionsForRebuilding(MM_Environmen
 {
 	/* do not need to call this for global GC - it rebuilds all RSCLs */
 	if (MM_CycleState::CT_GLOBAL_MARK_PHASE == env->_cycleState->_collectionType) {
-		Assert_MM_true(0 == _beingRebuiltRegionCount);
+		/* regions of an unfinished concurrent rebuild are handed over to the GMP: they stay as being rebuilt and
+		 * the GMP remembers every reference into them (cards remembered so far are a subset of those)
+		 */
+		Assert_MM_true(_concurrentRebuildInProgress || (0 == _beingRebuiltRegionCount));
+		_concurrentRebuildInProgress = false;
+		_concurrentRebuildWalkComplete = false;
 		for (UDATA index = 0; index < _heapRegionManager->getTableRegionCount(); index++) {
 			MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)_heapRegionManager->physicalTableDescriptorForIndex(index);
-			Assert_MM_false(region->getRememberedSetCardList()->isBeingRebuilt());
-			if (region->getRememberedSetCardList()->isOverflowed()) {
+			if (region->getRememberedSetCardList()->isBeingRebuilt()) {
+				if (region->getRememberedSetCardList()->isOverflowed()) {
+					/* overflowed again during the concurrent rebuild */
+					_overflowedRegionCount -= 1;
+					region->getRememberedSetCardList()->clear(env);
+				}
+			} else if (region->getRememberedSetCardList()->isOverflowed()) {
 				_beingRebuiltRegionCount += 1;
 				if (region->getRememberedSetCardList()->isStable()) {
 					_stableRegionCount -= 1;
@@ -674,6 +720,193 @@ MM_InterRegionRememberedSet::setRegionsAsRebuildingComplete(MM_EnvironmentVLHGC
 	Assert_MM_true(0 == _beingRebuiltRegionCount);
 }
 
+UDATA
+MM_InterRegionRememberedSet::startConcurrentRebuild(MM_EnvironmentVLHGC *env)
+{
+	UDATA regionCount = 0;
+
+	if (!_concurrentRebuildInProgress && (0 != _overflowedRegionCount) && MM_GCExtensions::getExtensions(env)->tarokEnableConcurrentRememberedSetRebuild) {
+		Assert_MM_true(0 == _beingRebuiltRegionCount);
+		for (UDATA index = 0; index < _heapRegionManager->getTableRegionCount(); index++) {
+			MM_HeapRegionDescriptorVLHGC *region = (MM_HeapRegionDescriptorVLHGC *)_heapRegionManager->physicalTableDescriptorForIndex(index);
+			MM_RememberedSetCardList *rscl = region->getRememberedSetCardList();
+			Assert_MM_false(rscl->isBeingRebuilt());
+			/* stable regions are overflowed on purpose and are left to the next GMP */
+			if (rscl->isOverflowed() && !rscl->isStable() && region->containsObjects()) {
+				_overflowedRegionCount -= 1;
+				_beingRebuiltRegionCount += 1;
+				rscl->clear(env);
+				rscl->setAsBeingRebuilt();
+				regionCount += 1;
+			}
+		}
+
+		if (0 != regionCount) {
+			_concurrentRebuildInProgress = true;
+			_concurrentRebuildWalkComplete = false;
+			_concurrentRebuildNextRegionIndex = 0;
+		}
+	}
+
+	return regionCount;
+}
+
+UDATA
+MM_InterRegionRememberedSet::rebuildOverflowedRegionsConcurrently(MM_EnvironmentVLHGC *env, volatile bool *forceExit)
+{
+	Assert_MM_true(_concurrentRebuildInProgress);
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	MM_HeapMap *markMap = extensions->previousMarkMap;
+	UDATA regionCount = _heapRegionManager->getTableRegionCount();
+	UDATA bytesScanned = 0;
+
+	while (!*forceExit && (_concurrentRebuildNextRegionIndex < regionCount)) {
+		MM_HeapRegionDescriptorVLHGC *region = physicalTableDescriptorForIndex(_concurrentRebuildNextRegionIndex);
+		/* Eden has no valid mark map. It is always collected by the next PGC, and copy-forward remembers every reference of its survivors */
+		if (region->hasValidMarkMap()) {
+			MM_HeapMapIterator objectIterator(extensions, markMap, (UDATA *)region->getLowAddress(), (UDATA *)region->getHighAddress(), false);
+			J9Object *objectPtr = NULL;
+			while (NULL != (objectPtr = objectIterator.nextObject())) {
+				bytesScanned += rememberReferencesForConcurrentRebuild(env, objectPtr);
+			}
+		}
+		_concurrentRebuildNextRegionIndex += 1;
+	}
+
+	if (_concurrentRebuildNextRegionIndex == regionCount) {
+		_concurrentRebuildWalkComplete = true;
+	}
+
+	/* as for the GC tasks, the list of RSCLs overflowed while remembering is private to this increment */
+	env->_lastOverflowedRsclWithReleasedBuffers = NULL;
+	resetOverflowedList();
+
+	return bytesScanned;
+}
+
+UDATA
+MM_InterRegionRememberedSet::completeConcurrentRebuild(MM_EnvironmentVLHGC *env)
+{
+	UDATA regionCount = 0;
+
+	if (_concurrentRebuildInProgress && _concurrentRebuildWalkComplete) {
+		for (UDATA index = 0; index < _heapRegionManager->getTableRegionCount(); index++) {
+			MM_HeapRegionDescriptorVLHGC *region = physicalTableDescriptorForIndex(index);
+			if (region->getRememberedSetCardList()->isBeingRebuilt()) {
+				region->getRememberedSetCardList()->setAsRebuildingComplete();
+				_beingRebuiltRegionCount -= 1;
+				regionCount += 1;
+			}
+		}
+		Assert_MM_true(0 == _beingRebuiltRegionCount);
+		_concurrentRebuildInProgress = false;
+		_concurrentRebuildWalkComplete = false;
+	}
+
+	return regionCount;
+}
+
+MMINLINE void
+MM_InterRegionRememberedSet::rememberReferenceForConcurrentRebuild(MM_EnvironmentVLHGC* env, J9Object* fromObject, J9Object* toObject)
+{
+	if ((NULL != toObject) && ((((UDATA)fromObject) ^ ((UDATA)toObject)) >= _regionSize)) {
+		MM_HeapRegionDescriptorVLHGC *toRegion = (MM_HeapRegionDescriptorVLHGC *)_heapRegionManager->tableDescriptorForAddress(toObject);
+		if (toRegion->getRememberedSetCardList()->isBeingRebuilt()) {
+			rememberReferenceInternal(env, fromObject, toRegion);
+		}
+	}
+}
+
+UDATA
+MM_InterRegionRememberedSet::rememberReferencesForConcurrentRebuild(MM_EnvironmentVLHGC* env, J9Object* objectPtr)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	J9JavaVM *javaVM = (J9JavaVM *)env->getLanguageVM();
+	J9Class *clazz = J9GC_J9OBJECT_CLAZZ(objectPtr, env);
+	Assert_MM_mustBeClass(clazz);
+	GC_ObjectModel::ScanType scanType = extensions->objectModel.getScanType(clazz);
+	UDATA bytesScanned = 0;
+
+	switch(scanType) {
+	case GC_ObjectModel::SCAN_MIXED_OBJECT_LINKED:
+	case GC_ObjectModel::SCAN_ATOMIC_MARKABLE_REFERENCE_OBJECT:
+	case GC_ObjectModel::SCAN_MIXED_OBJECT:
+	case GC_ObjectModel::SCAN_OWNABLESYNCHRONIZER_OBJECT:
+	case GC_ObjectModel::SCAN_REFERENCE_MIXED_OBJECT:
+	case GC_ObjectModel::SCAN_CLASS_OBJECT:
+	case GC_ObjectModel::SCAN_CLASSLOADER_OBJECT:
+	{
+		/* the referent of a reference object is remembered as well, which is conservative but correct */
+		GC_MixedObjectIterator mixedObjectIterator(javaVM->omrVM, objectPtr);
+		GC_SlotObject *slotObject = NULL;
+		while (NULL != (slotObject = mixedObjectIterator.nextSlot())) {
+			rememberReferenceForConcurrentRebuild(env, objectPtr, slotObject->readReferenceFromSlot());
+		}
+		bytesScanned = extensions->mixedObjectModel.getSizeInBytesWithHeader(objectPtr);
+		break;
+	}
+	case GC_ObjectModel::SCAN_POINTER_ARRAY_OBJECT:
+	{
+		GC_PointerArrayIterator pointerArrayIterator(javaVM, objectPtr);
+		GC_SlotObject *slotObject = NULL;
+		while (NULL != (slotObject = pointerArrayIterator.nextSlot())) {
+			rememberReferenceForConcurrentRebuild(env, objectPtr, slotObject->readReferenceFromSlot());
+		}
+		bytesScanned = extensions->indexableObjectModel.getSizeInBytesWithHeader((J9IndexableObject *)objectPtr);
+		break;
+	}
+	case GC_ObjectModel::SCAN_PRIMITIVE_ARRAY_OBJECT:
+		/* nothing to do */
+		break;
+	default:
+		Assert_MM_unreachable();
+	}
+
+	if (GC_ObjectModel::SCAN_CLASS_OBJECT == scanType) {
+		/* the same J9Class slots as scanned by GMP (statics, constant pool, call sites and class slots of anonymous classes) */
+		J9Class *classPtr = J9VM_J9CLASS_FROM_HEAPCLASS((J9VMThread*)env->getLanguageVMThread(), objectPtr);
+		while (NULL != classPtr) {
+			GC_ClassIterator classIterator(env, classPtr, false);
+			J9Object * volatile * slotPtr = NULL;
+			while (NULL != (slotPtr = classIterator.nextSlot())) {
+				rememberReferenceForConcurrentRebuild(env, objectPtr, *slotPtr);
+			}
+			if (J9_ARE_ANY_BITS_SET(J9CLASS_EXTENDED_FLAGS(classPtr), J9ClassIsAnonymous)) {
+				GC_ClassIteratorClassSlots classSlotIterator(javaVM, classPtr);
+				J9Class *slotClass = NULL;
+				while (NULL != (slotClass = classSlotIterator.nextSlot())) {
+					rememberReferenceForConcurrentRebuild(env, objectPtr, slotClass->classObject);
+				}
+			}
+			classPtr = classPtr->replacedClass;
+		}
+	} else if (GC_ObjectModel::SCAN_CLASSLOADER_OBJECT == scanType) {
+		J9ClassLoader *classLoader = J9VMJAVALANGCLASSLOADER_VMREF((J9VMThread*)env->getLanguageVMThread(), objectPtr);
+		if ((NULL != classLoader) && (0 == (classLoader->flags & J9CLASSLOADER_ANON_CLASS_LOADER))) {
+			GC_VMInterface::lockClasses(extensions);
+			GC_ClassLoaderClassesIterator iterator(extensions, classLoader);
+			J9Class *loadedClass = NULL;
+			while (NULL != (loadedClass = iterator.nextClass())) {
+				rememberReferenceForConcurrentRebuild(env, objectPtr, J9VM_J9CLASS_TO_HEAPCLASS(loadedClass));
+			}
+			if (NULL != classLoader->moduleHashTable) {
+				J9HashTableState walkState;
+				J9Module **modulePtr = (J9Module **)hashTableStartDo(classLoader->moduleHashTable, &walkState);
+				while (NULL != modulePtr) {
+					J9Module * const module = *modulePtr;
+					rememberReferenceForConcurrentRebuild(env, objectPtr, module->moduleObject);
+					rememberReferenceForConcurrentRebuild(env, objectPtr, module->moduleName);
+					rememberReferenceForConcurrentRebuild(env, objectPtr, module->version);
+					modulePtr = (J9Module **)hashTableNextDo(&walkState);
+				}
+			}
+			GC_VMInterface::unlockClasses(extensions);
+		}
+	}
+
+	return bytesScanned;
+}
+
 void
 MM_InterRegionRememberedSet::rememberReferenceForMarkInternal(MM_EnvironmentVLHGC* env, J9Object* fromObject, J9Object* toObject)
 {
@@ -74,12 +74,18 @@ public:
 	volatile UDATA _overflowedRegionCount;					/**< count of regions overflowed as full */
 	UDATA _stableRegionCount;								/**< count of regions overflowed as stable */
 	volatile UDATA _beingRebuiltRegionCount;				/**< count of overflowed regions currently being rebuilt */
+	bool _concurrentRebuildInProgress;						/**< true if regions overflowed outside of a GMP are being rebuilt by the concurrent heap walk */
+	bool _concurrentRebuildWalkComplete;					/**< true once the concurrent heap walk has visited every region (rebuilt regions are released at the next PGC) */
+	UDATA _concurrentRebuildNextRegionIndex;				/**< table index of the next region to be scanned by the concurrent heap walk */
 	double _unusedRegionThreshold;							/**< fraction of region unused (free&fragmented) to be considered full (used for stable region detection) */
 
 	MM_HeapRegionDescriptor *_regionTable;					/**< cached copy of regionTable (from HeapRegionManager) */
 	UDATA _tableDescriptorSize;								/**< cached heap region tableDescriptorSize (from  HeapRegionManager)*/
 	UDATA _cardToRegionShift;  								/**< the shift value to use against RememberedSetCards to determine the corresponding region index */
 	UDATA _cardToRegionDisplacement;						/**< the displacement value to use against RememberedSetcards to determine the corresponding region index */
+	UDATA _cardIndexBase;									/**< heap address subtracted from a card address before it is shifted into a 32-bit RememberedSetCard (0 with compressed references) */
+	volatile UDATA _flushedCardCount;						/**< count of RSCL cards scanned by the last card list flush */
+	volatile U_64 _flushTime;								/**< total time (hi-res ticks, summed over GC threads) spent scanning RSCLs in the last card list flush */
 	MM_CardTable *_cardTable;								/**< cached copy of card table */
 
 	MM_RememberedSetCardBucket *_rememberedSetCardBucketPool; /**< RS bucket pool (for all regions) for Main thread or any other thread that caused GC in absence of Main thread */
@@ -88,6 +94,7 @@ protected:
 #if defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS)
 	bool _compressObjectReferences;
 #endif /* defined(OMR_GC_COMPRESSED_POINTERS) && defined(OMR_GC_FULL_POINTERS) */
+	bool _compressRememberedSetCards;						/**< true if RememberedSetCards are 32-bit card indices relative to _cardIndexBase on a full pointer heap */
 
 private:
 
@@ -124,6 +131,20 @@ private:
 	 */
 	void enqueueOverflowedRscl(MM_EnvironmentVLHGC *env, MM_RememberedSetCardList *rsclToEnqueue);
 
+	/**
+	 * Remember a reference found by the concurrent rebuild, if it points into a region being rebuilt
+	 * @param fromObject object (its slot) pointing from
+	 * @param toObject object being pointed (may be NULL)
+	 */
+	MMINLINE void rememberReferenceForConcurrentRebuild(MM_EnvironmentVLHGC* env, J9Object* fromObject, J9Object* toObject);
+
+	/**
+	 * Remember all references of an object that point into regions being rebuilt by the concurrent rebuild
+	 * @param objectPtr marked object in a region that is not being collected
+	 * @return number of bytes scanned
+	 */
+	UDATA rememberReferencesForConcurrentRebuild(MM_EnvironmentVLHGC* env, J9Object* objectPtr);
+
 	/**
 	 * Out-of-line implementation of rememberReferenceForMark()
 	 * @param fromObject object (its slot) pointing from (must not be NULL)
@@ -236,6 +257,16 @@ public:
 		return OMR_COMPRESS_OBJECT_REFERENCES(_compressObjectReferences);
 	}
 
+	/**
+	 * Return back true if RememberedSetCards are stored as 32-bit card indices
+	 * @return true, if cards are 32-bit card indices, false if they are heap addresses
+	 */
+	MMINLINE bool
+	compressRememberedSetCards()
+	{
+		return compressObjectReferences() || _compressRememberedSetCards;
+	}
+
 	/**
 	 *	Setup for partial collect
 	 *	@param env current thread environment
@@ -431,8 +462,8 @@ public:
 	convertRememberedSetCardFromHeapAddress(void* address)
 	{
 		UDATA card = (UDATA)address;
-		if (compressObjectReferences()) {
-			card >>= CARD_SIZE_SHIFT;
+		if (compressRememberedSetCards()) {
+			card = (card - _cardIndexBase) >> CARD_SIZE_SHIFT;
 		}
 		return card;
 	}
@@ -446,8 +477,8 @@ public:
 	convertHeapAddressFromRememberedSetCard(UDATA card)
 	{
 		void *address = (void *)card;
-		if (compressObjectReferences()) {
-			address = (void *)(card << CARD_SIZE_SHIFT);
+		if (compressRememberedSetCards()) {
+			address = (void *)((card << CARD_SIZE_SHIFT) + _cardIndexBase);
 		}
 		return address;
 	}
@@ -461,8 +492,8 @@ public:
 	MMINLINE Card *rememberedSetCardToCardAddr(MM_EnvironmentVLHGC *env, UDATA card)
 	{
 		Card *result = NULL;
-		if (compressObjectReferences()) {
-			result = _cardTable->getCardTableVirtualStart() + card;
+		if (compressRememberedSetCards()) {
+			result = _cardTable->getCardTableVirtualStart() + card + (_cardIndexBase >> CARD_SIZE_SHIFT);
 		} else {
 			result = _cardTable->heapAddrToCardAddr(env, (void*)card);
 		}
@@ -543,6 +574,35 @@ public:
 	 */
 	void setRegionsAsRebuildingComplete(MM_EnvironmentVLHGC *env);
 
+	/**
+	 * Clear RSCL for regions that overflowed since the last GMP, and set them as being rebuilt by the concurrent heap walk.
+	 * Invoked at the end of a PGC when no GMP is in progress. Stable regions are left for the next GMP.
+	 * @return number of regions set as being rebuilt
+	 */
+	UDATA startConcurrentRebuild(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * @return true if the concurrent heap walk has regions left to scan
+	 */
+	bool isConcurrentRebuildWorkAvailable() { return _concurrentRebuildInProgress && !_concurrentRebuildWalkComplete; }
+
+	/**
+	 * Walk the previous mark map of every region with a valid mark map and remember references into regions being rebuilt.
+	 * Called by the main GC thread while the mutator is running. The walk resumes at the region where the previous call stopped.
+	 * References created by the mutator behind the walk are in dirty cards, which the next PGC scans (and remembers) before it
+	 * selects the collection set.
+	 * @param forceExit set asynchronously to request the walk to return at the next region boundary
+	 * @return number of bytes scanned
+	 */
+	UDATA rebuildOverflowedRegionsConcurrently(MM_EnvironmentVLHGC *env, volatile bool *forceExit);
+
+	/**
+	 * If the concurrent heap walk has completed, reset the rebuild flag for the regions it rebuilt, so that they can be collected again.
+	 * PGC invokes this before it selects the collection set.
+	 * @return number of regions released
+	 */
+	UDATA completeConcurrentRebuild(MM_EnvironmentVLHGC *env);
+
 	/** 
 	 * Given a pointer to a buffer (its control block) return the region that owns this buffer
 	 * @param cardBufferControlBlock buffer for which region is to be returned
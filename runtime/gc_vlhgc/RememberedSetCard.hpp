@@ -39,7 +39,7 @@ public:
 	 * Read the value of a card.
 	 *
 	 * @param[in] addr the card address
-	 * @param[in] compressed true if cards are compressed, false if not
+	 * @param[in] compressed true if cards are 32-bit values (see MM_GCExtensions::compressRememberedSetCards()), false if they are full heap addresses
 	 * @return the card value
 	 */
 	MMINLINE static UDATA readCard(MM_RememberedSetCard *addr, bool compressed)
@@ -51,7 +51,7 @@ public:
 	 * Write the value of a card.
 	 *
 	 * @param[in] addr the card address
-	 * @param[in] compressed true if cards are compressed, false if not
+	 * @param[in] compressed true if cards are 32-bit values (see MM_GCExtensions::compressRememberedSetCards()), false if they are full heap addresses
 	 * @param[in] card the card value
 	 */
 	MMINLINE static void writeCard(MM_RememberedSetCard *addr, UDATA card, bool compressed)
@@ -68,7 +68,7 @@ public:
 	 *
 	 * @param[in] base the base card address
 	 * @param[in] index the index to add
-	 * @param[in] compressed true if cards are compressed, false if not
+	 * @param[in] compressed true if cards are 32-bit values (see MM_GCExtensions::compressRememberedSetCards()), false if they are full heap addresses
 	 * @return the adjusted address
 	 */
 	MMINLINE static MM_RememberedSetCard* addToCardAddress(MM_RememberedSetCard *base, intptr_t index, bool compressed)
@@ -85,7 +85,7 @@ public:
 	 *
 	 * @param[in] base the base card address
 	 * @param[in] index the index to subtract
-	 * @param[in] compressed true if cards are compressed, false if not
+	 * @param[in] compressed true if cards are 32-bit values (see MM_GCExtensions::compressRememberedSetCards()), false if they are full heap addresses
 	 * @return the adjusted address
 	 */
 	MMINLINE static MM_RememberedSetCard* subtractFromCardAddress(MM_RememberedSetCard *base, intptr_t index, bool compressed)
@@ -102,7 +102,7 @@ public:
 	 *
 	 * @param[in] p1 the value to be subtracted from
 	 * @param[in] p2 the value to be subtracted
-	 * @param[in] compressed true if cards are compressed, false if not
+	 * @param[in] compressed true if cards are 32-bit values (see MM_GCExtensions::compressRememberedSetCards()), false if they are full heap addresses
 	 * @return p1 - p2 in slots
 	 */
 	MMINLINE static intptr_t subtractCardAddresses(MM_RememberedSetCard *p1, MM_RememberedSetCard *p2, bool compressed)
@@ -108,7 +108,7 @@ MM_RememberedSetCardBucket::addToNewBuffer(MM_EnvironmentVLHGC *env, UDATA card)
 
 			if (NULL != newBuffer) {
 				/* reserve space for current add */
-				bool const compressed = env->compressObjectReferences();
+				bool const compressed = MM_GCExtensions::getExtensions(env)->compressRememberedSetCards();
 				_current = MM_RememberedSetCard::addToCardAddress(newBuffer->_card, 1, compressed);
 				MM_RememberedSetCard::writeCard(newBuffer->_card, card, compressed);
 
@@ -130,7 +130,7 @@ MM_RememberedSetCardBucket::isRemembered(MM_EnvironmentVLHGC *env, UDATA card)
 {
 	UDATA bufferCount = 0;
 	MM_CardBufferControlBlock *currentCardBufferControlBlock = _cardBufferControlBlockHead;
-	bool const compressed = env->compressObjectReferences();
+	bool const compressed = MM_GCExtensions::getExtensions(env)->compressRememberedSetCards();
 	while (NULL != currentCardBufferControlBlock) {
 		bufferCount += 1;
 
@@ -190,7 +190,7 @@ MM_RememberedSetCardBucket::getSize(MM_EnvironmentVLHGC *env)
 		UDATA offset = (UDATA)_current & offsetMask(env);
 		if (0 != offset) {
 			/* subtract the unused portion of the current buffer */
-			size -= (MAX_BUFFER_SIZE - (offset / MM_RememberedSetCard::cardSize(env->compressObjectReferences())));
+			size -= (MAX_BUFFER_SIZE - (offset / MM_RememberedSetCard::cardSize(MM_GCExtensions::getExtensions(env)->compressRememberedSetCards())));
 		}
 	}
 
@@ -203,7 +203,7 @@ MM_RememberedSetCardBucket::compact(MM_EnvironmentVLHGC *env)
 	Assert_MM_true(_rscl->_bufferCount >= _bufferCount);
 	
 	if (NULL != _cardBufferControlBlockHead) {
-		bool const compressed = env->compressObjectReferences();
+		bool const compressed = MM_GCExtensions::getExtensions(env)->compressRememberedSetCards();
 		UDATA toIndex = 0;
 		MM_CardBufferControlBlock *toCardBufferControlBlock = _cardBufferControlBlockHead;
 		MM_CardBufferControlBlock *prevToCardBufferControlBlock = NULL;
@@ -64,7 +64,7 @@ public:
 private:
 	MMINLINE uintptr_t offsetMask(MM_EnvironmentVLHGC *env)
 	{
-		return (MAX_BUFFER_SIZE * MM_RememberedSetCard::cardSize(env->compressObjectReferences())) - 1;
+		return (MAX_BUFFER_SIZE * MM_RememberedSetCard::cardSize(MM_GCExtensions::getExtensions(env)->compressRememberedSetCards())) - 1;
 	}
 
 	/**
@@ -91,7 +91,7 @@ public:
 			 * simple optimization to avoid duplicates: check if this card is same as the last stored card
 			 * (at this point we know current is no NULL)
 			 */
-			bool const compressed = env->compressObjectReferences();
+			bool const compressed = MM_GCExtensions::getExtensions(env)->compressRememberedSetCards();
 			MM_RememberedSetCard *cardAddress = MM_RememberedSetCard::subtractFromCardAddress(current, 1, compressed);
 			if (card != MM_RememberedSetCard::readCard(cardAddress, compressed)) {
 				/* no, not same, add it */
@@ -168,7 +168,7 @@ public:
 	 * @return true if _current pointer points within the provided buffer's card list
 	 */
 	bool isCurrentSlotWithinBuffer(MM_EnvironmentBase *env, MM_RememberedSetCard *bufferCardList) {
-		return ((bufferCardList < _current) && (_current < MM_RememberedSetCard::addToCardAddress(bufferCardList, MAX_BUFFER_SIZE, env->compressObjectReferences())));
+		return ((bufferCardList < _current) && (_current < MM_RememberedSetCard::addToCardAddress(bufferCardList, MAX_BUFFER_SIZE, MM_GCExtensions::getExtensions(env)->compressRememberedSetCards())));
 	}
 
 	MM_RememberedSetCardBucket()
@@ -55,7 +55,7 @@ private:
 	 * Remove an entry. This just NULLs the entry. Compaction/shifting is to be done later, explicitly.
 	 */
 	void removeCard(MM_EnvironmentBase *env, MM_RememberedSetCard *bucketCardList, UDATA index) {
-		bool const compressed = env->compressObjectReferences();
+		bool const compressed = MM_GCExtensions::getExtensions(env)->compressRememberedSetCards();
 		MM_RememberedSetCard *cardAddress = MM_RememberedSetCard::addToCardAddress(bucketCardList, index, compressed);
 		MM_RememberedSetCard::writeCard(cardAddress, 0, compressed);
 	}
@@ -37,7 +37,7 @@ GC_RememberedSetCardListBufferIterator::unlinkCurrentBuffer(MM_EnvironmentBase *
 
 	if (_currentBucket->isCurrentSlotWithinBuffer(env, _bufferCardList)) {
 		/* make the _current bucket looks like point to the end of a full buffer */
-		bool const compressed = env->compressObjectReferences();
+		bool const compressed = MM_GCExtensions::getExtensions(env)->compressRememberedSetCards();
 		_currentBucket->_current = MM_RememberedSetCard::addToCardAddress(_bufferCardList, MM_RememberedSetCardBucket::MAX_BUFFER_SIZE, compressed);
 	}
 
@@ -77,7 +77,7 @@ GC_RememberedSetCardListBufferIterator::nextBucket(MM_EnvironmentBase* env)
 MM_CardBufferControlBlock *
 GC_RememberedSetCardListBufferIterator::nextBuffer(MM_EnvironmentBase *env, MM_RememberedSetCard **lastCard)
 {
-	bool const compressed = env->compressObjectReferences();
+	bool const compressed = MM_GCExtensions::getExtensions(env)->compressRememberedSetCards();
 	do {
 		if (NULL != _cardBufferControlBlockNext) {
 			/* TODO: could this condition be simplified? */
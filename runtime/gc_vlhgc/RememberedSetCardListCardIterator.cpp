@@ -38,7 +38,7 @@ GC_RememberedSetCardListCardIterator::nextBuffer(MM_EnvironmentBase *env, MM_Car
 
 		/* _cardIndexTop has to be between 1 and MM_RememberedSetCardBucket::MAX_BUFFER_SIZE, inclusive */
 		if (_currentBucket->isCurrentSlotWithinBuffer(env, _bufferCardList)) {
-			bool const compressed = env->compressObjectReferences();
+			bool const compressed = MM_GCExtensions::getExtensions(env)->compressRememberedSetCards();
 			_cardIndexTop = MM_RememberedSetCard::subtractCardAddresses(_currentBucket->_current, _bufferCardList, compressed);
 		} else {
 			_cardIndexTop = MM_RememberedSetCardBucket::MAX_BUFFER_SIZE;
@@ -72,7 +72,7 @@ GC_RememberedSetCardListCardIterator::nextBucket(MM_EnvironmentBase* env)
 UDATA
 GC_RememberedSetCardListCardIterator::nextReferencingCard(MM_EnvironmentBase *env)
 {
-	bool const compressed = env->compressObjectReferences();
+	bool const compressed = MM_GCExtensions::getExtensions(env)->compressRememberedSetCards();
 	do {
 		do {
 			/* next card within the buffer */
@@ -45,7 +45,9 @@
 #include "HeapRegionIteratorVLHGC.hpp"
 #include "HeapRegionManager.hpp"
 #include "IncrementalGenerationalGC.hpp"
+#include "InterRegionRememberedSet.hpp"
 #include "MemoryPoolBumpPointer.hpp"
+#include "ParallelDispatcher.hpp"
 
 /* NOTE: old logic for determining incremental thresholds has been deleted. Please 
  * see CVS history, version 1.14, if you need to find this logic
@@ -60,6 +62,7 @@ const double measureScanRateHistoricWeightForPGC = 0.95;
 const double partialGCTimeHistoricWeight = 0.80;
 const double incrementalScanTimePerGMPHistoricWeight = 0.50;
 const double bytesScannedConcurrentlyPerGMPHistoricWeight = 0.50;
+const double partialGCTimeModelHistoricWeight = 0.70;
 
 MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapRegionManager *manager)
 	: MM_BaseNonVirtual()
@@ -100,6 +103,12 @@ MM_SchedulingDelegate::MM_SchedulingDelegate (MM_EnvironmentVLHGC *env, MM_HeapR
 	, _partialGcStartTime(0)
 	, _historicalPartialGCTime(0)
 	, _dynamicGlobalMarkIncrementTimeMillis(50)
+	, _pauseTimeModelPrimed(false)
+	, _averagePartialGCOverheadMicros(0.0)
+	, _averageRememberedSetFlushMicrosPerRegion(0.0)
+	, _averagePartialGCTimeDeviationMicros(0.0)
+	, _predictedPartialGCTimeMicros(0)
+	, _lastPartialGCTimeMicros(0)
 	, _scanRateStats()
 {
 	_typeId = __FUNCTION__;
@@ -189,6 +198,12 @@ MM_SchedulingDelegate::partialGarbageCollectStarted(MM_EnvironmentVLHGC *env)
 
 	/* Record the GC start time in order to track Partial GC times (and averages) over the course of the application lifetime */
 	_partialGcStartTime = j9time_hires_clock();
+
+	/* the collection set has been selected, so predict how long this PGC will take (to be compared with the actual time once it completes) */
+	_predictedPartialGCTimeMicros = 0;
+	if (_pauseTimeModelPrimed) {
+		_predictedPartialGCTimeMicros = (U_64)predictPartialGCTimeMicros(_edenRegionCount, static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_desiredCompactWork);
+	}
 }
 
 void
@@ -284,6 +299,15 @@ MM_SchedulingDelegate::partialGarbageCollectCompleted(MM_EnvironmentVLHGC *env,
 
 	measureConsumptionForPartialGC(env, reclaimableRegions, defragmentReclaimableRegions);
 	calculateAutomaticGMPIntermission(env);
+	U_64 pgcTimeMicros = j9time_hires_delta(_partialGcStartTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	if (((U_64)U_32_MAX * 1000) >= pgcTimeMicros) {
+		/* every PGC reports its own time against the pause time target, whether it copied forward or compacted */
+		_lastPartialGCTimeMicros = pgcTimeMicros;
+		if (env->_cycleState->_shouldRunCopyForward) {
+			/* update the PGC time model before Eden is sized against the pause time target */
+			updatePartialGCTimeModel(env, pgcTimeMicros);
+		}
+	}
 	calculateEdenSize(env);
 	estimateMacroDefragmentationWork(env);
 	
@@ -864,9 +888,94 @@ MM_SchedulingDelegate::getDesiredCompactWork()
 	/* defragmentation work (mostly) driven by compact group merging (maxAge - 1 into maxAge) */
 	desiredCompactWork += (UDATA)_averageMacroDefragmentationWork;
 
+	if (isPauseTimeTargetActive()) {
+		/* compact no more than fits in the pause time target next to a minimum Eden, but always allow at least a region's worth
+		 * so that defragmentation makes progress (the target is soft; if we fall behind, the usual GMP and AF mechanisms take over)
+		 */
+		UDATA regionSize = _regionManager->getRegionSize();
+		double edenRegionMicros = predictPartialGCTimeMicros(_minimumEdenRegionCount, 0) - predictPartialGCTimeMicros(0, 0);
+		double compactMicrosPerByte = (predictPartialGCTimeMicros(0, regionSize) - predictPartialGCTimeMicros(0, 0)) / (double)regionSize;
+		double compactBudgetMicros = getPauseTimeBudgetMicros() - edenRegionMicros;
+		UDATA compactWorkLimit = regionSize;
+		if ((compactBudgetMicros > 0.0) && (compactMicrosPerByte > 0.0)) {
+			compactWorkLimit = OMR_MAX(regionSize, (UDATA)(compactBudgetMicros / compactMicrosPerByte));
+		}
+		desiredCompactWork = OMR_MIN(desiredCompactWork, compactWorkLimit);
+	}
+
 	return desiredCompactWork;
 }
 
+double
+MM_SchedulingDelegate::predictPartialGCTimeMicros(UDATA edenRegionCount, UDATA compactBytes) const
+{
+	UDATA regionSize = _regionManager->getRegionSize();
+	double copyBytes = ((double)edenRegionCount * (double)regionSize * _edenSurvivalRateCopyForward) + (double)compactBytes;
+	double collectionSetRegions = (double)edenRegionCount + ((double)compactBytes / (double)regionSize);
+	double copyMicros = (_averageCopyForwardRate > 0.0) ? (copyBytes / _averageCopyForwardRate) : 0.0;
+	double flushMicros = collectionSetRegions * _averageRememberedSetFlushMicrosPerRegion;
+
+	return _averagePartialGCOverheadMicros + copyMicros + flushMicros;
+}
+
+double
+MM_SchedulingDelegate::getPauseTimeBudgetMicros() const
+{
+	double targetMicros = (double)_extensions->tarokTargetPauseTimeMillis * 1000.0;
+	return targetMicros - _averagePartialGCOverheadMicros - (2.0 * _averagePartialGCTimeDeviationMicros);
+}
+
+void
+MM_SchedulingDelegate::updatePartialGCTimeModel(MM_EnvironmentVLHGC *env, U_64 pgcTimeMicros)
+{
+	PORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_CopyForwardStats *copyForwardStats = &static_cast<MM_CycleStateVLHGC*>(env->_cycleState)->_vlhgcIncrementStats._copyForwardStats;
+	MM_InterRegionRememberedSet *interRegionRememberedSet = _extensions->interRegionRememberedSet;
+
+	if (((U_64)U_32_MAX * 1000) < pgcTimeMicros) {
+		/* Time likely traveled backwards due to a clock adjustment - just ignore this round */
+		return;
+	}
+
+	U_64 copyForwardMicros = j9time_hires_delta(copyForwardStats->_startTime, copyForwardStats->_endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	/* the flush time is summed over all GC threads which took part in the flush */
+	U_64 flushMicros = j9time_hires_delta(0, interRegionRememberedSet->_flushTime, J9PORT_TIME_DELTA_IN_MICROSECONDS) / OMR_MAX(_extensions->dispatcher->activeThreadCount(), (UDATA)1);
+	UDATA collectionSetRegions = OMR_MAX(copyForwardStats->_edenEvacuateRegionCount + copyForwardStats->_nonEdenEvacuateRegionCount, (UDATA)1);
+	double flushMicrosPerRegion = (double)flushMicros / (double)collectionSetRegions;
+	double overheadMicros = 0.0;
+	if (pgcTimeMicros > (copyForwardMicros + flushMicros)) {
+		overheadMicros = (double)(pgcTimeMicros - copyForwardMicros - flushMicros);
+	}
+
+	if (_pauseTimeModelPrimed) {
+		if (0 != _predictedPartialGCTimeMicros) {
+			double predictionError = fabs((double)pgcTimeMicros - (double)_predictedPartialGCTimeMicros);
+			_averagePartialGCTimeDeviationMicros = (_averagePartialGCTimeDeviationMicros * partialGCTimeModelHistoricWeight) + (predictionError * (1.0 - partialGCTimeModelHistoricWeight));
+		}
+		_averagePartialGCOverheadMicros = (_averagePartialGCOverheadMicros * partialGCTimeModelHistoricWeight) + (overheadMicros * (1.0 - partialGCTimeModelHistoricWeight));
+		_averageRememberedSetFlushMicrosPerRegion = (_averageRememberedSetFlushMicrosPerRegion * partialGCTimeModelHistoricWeight) + (flushMicrosPerRegion * (1.0 - partialGCTimeModelHistoricWeight));
+	} else {
+		_averagePartialGCOverheadMicros = overheadMicros;
+		_averageRememberedSetFlushMicrosPerRegion = flushMicrosPerRegion;
+		_pauseTimeModelPrimed = true;
+	}
+}
+
+UDATA
+MM_SchedulingDelegate::calculatePauseTimeTargetEdenRegionCount(MM_EnvironmentVLHGC *env)
+{
+	UDATA edenRegionCount = 0;
+	double edenRegionMicros = predictPartialGCTimeMicros(1, 0) - predictPartialGCTimeMicros(0, 0);
+	double compactMicros = predictPartialGCTimeMicros(0, getDesiredCompactWork()) - predictPartialGCTimeMicros(0, 0);
+	double edenBudgetMicros = getPauseTimeBudgetMicros() - compactMicros;
+
+	if ((edenBudgetMicros > 0.0) && (edenRegionMicros > 0.0)) {
+		edenRegionCount = (UDATA)(edenBudgetMicros / edenRegionMicros);
+	}
+
+	return edenRegionCount;
+}
+
 bool
 MM_SchedulingDelegate::isFirstPGCAfterGMP()
 {
@@ -997,6 +1106,12 @@ MM_SchedulingDelegate::calculateEdenSize(MM_EnvironmentVLHGC *env)
 	Assert_MM_true(edenMinimumCount >= 1);
 	Assert_MM_true(edenMaximumCount >= 1);
 	Assert_MM_true(edenMaximumCount >= edenMinimumCount);
+
+	if (isPauseTimeTargetActive()) {
+		/* shrink Eden (never below its minimum) if the ideal Eden is predicted to miss the pause time target */
+		UDATA pauseTimeTargetEdenCount = calculatePauseTimeTargetEdenRegionCount(env);
+		edenMaximumCount = OMR_MAX(edenMinimumCount, OMR_MIN(edenMaximumCount, pauseTimeTargetEdenCount));
+	}
 	
 	UDATA desiredEdenCount = freeRegions;
 	if (desiredEdenCount > edenMaximumCount) {
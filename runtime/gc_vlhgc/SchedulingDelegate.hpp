@@ -81,6 +81,13 @@ private:
 
 	UDATA _dynamicGlobalMarkIncrementTimeMillis;  /**< The dynamically calculated current time to be spent per GMP increment (subject to change over the course of the run) */
 
+	bool _pauseTimeModelPrimed; /**< True once a copy-forward PGC has been measured, so the PGC time model below can be used for predictions */
+	double _averagePartialGCOverheadMicros; /**< Weighted average of PGC time not spent copying or flushing RSCLs (root and card scanning, reclaim, etc.), in microseconds */
+	double _averageRememberedSetFlushMicrosPerRegion; /**< Weighted average wall-clock time spent flushing the RSCL of one collection set region into the card table, in microseconds */
+	double _averagePartialGCTimeDeviationMicros; /**< Weighted average of the absolute difference between predicted and actual PGC times, in microseconds */
+	U_64 _predictedPartialGCTimeMicros; /**< Predicted time of the most recent PGC (0 if the model was not primed when it started), in microseconds */
+	U_64 _lastPartialGCTimeMicros; /**< Measured time of the most recent PGC, in microseconds */
+
 	struct MM_SchedulingDelegate_ScanRateStats {
 		UDATA historicalBytesScanned;		/**< Historical number of bytes scanned for mark operations */
 		U_64 historicalScanMicroseconds;	/**< Historical scan times for mark operations */
@@ -237,6 +244,42 @@ private:
 	 */
 	double calculateAverageCopyForwardRate(MM_EnvironmentVLHGC *env);
 
+	/**
+	 * @return true if a PGC pause time target is set and the PGC time model has been primed
+	 */
+	bool isPauseTimeTargetActive() const { return (0 != _extensions->tarokTargetPauseTimeMillis) && _pauseTimeModelPrimed; }
+
+	/**
+	 * Predict the time of a copy-forward PGC from the copy-forward rate, the RSCL flush cost and the residual overhead
+	 * measured in recent PGCs.
+	 * @param edenRegionCount[in] The number of Eden regions in the collection set
+	 * @param compactBytes[in] The number of non-Eden bytes to be compacted
+	 * @return the predicted PGC time, in microseconds
+	 */
+	double predictPartialGCTimeMicros(UDATA edenRegionCount, UDATA compactBytes) const;
+
+	/**
+	 * @return The part of the pause time target available to copying and RSCL flushing, in microseconds.  The target is
+	 * reduced by the residual overhead and by twice the average prediction error, so that most (rather than half) of
+	 * the PGCs meet it.
+	 */
+	double getPauseTimeBudgetMicros() const;
+
+	/**
+	 * Called after a copy-forward PGC to compare the predicted and the actual PGC time and update the PGC time model.
+	 * @param env[in] the main GC thread
+	 * @param pgcTimeMicros[in] The measured time of the PGC, in microseconds
+	 */
+	void updatePartialGCTimeModel(MM_EnvironmentVLHGC *env, U_64 pgcTimeMicros);
+
+	/**
+	 * Calculate the largest Eden, in regions, which is predicted to keep the next PGC within the pause time target.
+	 * Only meaningful if isPauseTimeTargetActive().
+	 * @param env[in] the main GC thread
+	 * @return the number of Eden regions (may be below the minimum Eden size, or 0)
+	 */
+	UDATA calculatePauseTimeTargetEdenRegionCount(MM_EnvironmentVLHGC *env);
+
 	/**
 	 * Estimate total free memory
 	 * @param env[in] the main GC thread
@@ -462,6 +505,16 @@ public:
 	
 	double getAvgEdenSurvivalRateCopyForward(MM_EnvironmentVLHGC *env) { return _edenSurvivalRateCopyForward; }
 
+	/**
+	 * @return The predicted time of the most recent copy-forward PGC in microseconds, or 0 if none was predicted
+	 */
+	U_64 getPredictedPartialGCTimeMicros() const { return _predictedPartialGCTimeMicros; }
+
+	/**
+	 * @return The measured time of the most recent copy-forward PGC in microseconds
+	 */
+	U_64 getLastPartialGCTimeMicros() const { return _lastPartialGCTimeMicros; }
+
 	MM_SchedulingDelegate(MM_EnvironmentVLHGC *env, MM_HeapRegionManager *manager);
 };
 
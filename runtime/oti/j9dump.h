@@ -36,6 +36,8 @@ typedef struct RasDumpGlobalStorage {
 	
 	UDATA noProtect; /* If set, do not take dumps under their own signal handler */
 	UDATA noFailover; /* If set, do not failover to /tmp etc if unable to write dump */
+
+	void* heapDumpDeltaBaseline; /* Chunks seen by the previous delta heap dump, see heapdump.cpp */
 } RasDumpGlobalStorage;
 
 struct J9RASdumpAgent; /* Forward struct declaration */
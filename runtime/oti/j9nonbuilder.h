@@ -628,6 +628,7 @@ typedef struct J9ClassHotFieldsInfo {
 	struct J9HotField* hotFieldListHead;
 	struct J9ClassLoader* classLoader;
 	BOOLEAN isClassHotFieldListDirty;	
+	BOOLEAN isBreadthFirstCopyPreferred;
 	uint8_t hotFieldOffset1;
 	uint8_t hotFieldOffset2;
 	uint8_t hotFieldOffset3;
@@ -1048,6 +1049,21 @@ typedef struct J9SharedLocalStartupHints {
 	struct J9SharedStartupHintsDataDescriptor hintsData;
 } J9SharedLocalStartupHints;
 
+typedef struct J9SharedStartupClassTraceEntry {
+	U_32 romClassOffset;
+	U_32 layer;
+} J9SharedStartupClassTraceEntry;
+
+typedef struct J9SharedLocalStartupClassTrace {
+	UDATA flags;
+	UDATA count;
+	struct J9SharedStartupClassTraceEntry* entries;
+	const struct J9SharedStartupClassTraceEntry* prefaultEntries;
+	UDATA prefaultCount;
+	omrthread_monitor_t prefaultMonitor;
+	UDATA prefaultThreadRunning;
+} J9SharedLocalStartupClassTrace;
+
 typedef struct J9SharedClassJavacoreDataDescriptor {
 	void* romClassStart;
 	void* romClassEnd;
@@ -1113,6 +1129,8 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
 	UDATA numObjects;
 	UDATA numStartupHints;
 	UDATA startupHintBytes;
+	UDATA numStartupClassTraces;
+	UDATA startupClassTraceBytes;
 } J9SharedClassJavacoreDataDescriptor;
 
 typedef struct J9SharedStringFarm {
@@ -1137,6 +1155,16 @@ typedef struct J9SharedCacheInfo {
 	I_8 layer;
 } J9SharedCacheInfo;
 
+#define J9SH_READER_SLOT_COUNT 16
+
+/* Each JVM counts its readers in its own slot, so readers in different JVMs do not write the same cache line.
+ * The padding keeps the counts of neighbouring slots 128 bytes apart, beyond the reach of adjacent-line prefetch.
+ */
+typedef struct J9SharedCacheReaderSlot {
+	volatile UDATA readerCount;
+	UDATA padding[15];
+} J9SharedCacheReaderSlot;
+
 typedef struct J9SharedCacheHeader {
 	U_32 totalBytes;
 	U_32 readWriteBytes;
@@ -1145,7 +1173,7 @@ typedef struct J9SharedCacheHeader {
 	UDATA segmentSRP;
 	UDATA updateCount;
 	J9WSRP updateCountPtr;
-	volatile UDATA readerCount;
+	UDATA unused7;
 	UDATA unused2;
 	UDATA writeHash;
 	UDATA unused3;
@@ -1190,9 +1218,10 @@ typedef struct J9SharedCacheHeader {
 	UDATA unused5;
 	UDATA unused6;
 	U_32 softMaxBytes;
-	UDATA unused8;
+	UDATA lookupIndexOffset;
 	UDATA unused9;
 	UDATA unused10;
+	J9SharedCacheReaderSlot readerSlots[J9SH_READER_SLOT_COUNT];
 } J9SharedCacheHeader;
 
 #define J9SHAREDCACHEHEADER_UPDATECOUNTPTR(base) WSRP_GET((base)->updateCountPtr, UDATA*)
@@ -1226,6 +1255,7 @@ typedef struct J9SharedCacheAPI {
 	UDATA cacheType;
 	UDATA parseResult;
 	UDATA storageKeyTesting;
+	UDATA mappingFlags;
 	UDATA xShareClassesPresent;
 	UDATA cacheDirPerm;
 	IDATA  ( *iterateSharedCaches)(struct J9JavaVM *vm, const char *cacheDir, UDATA groupPerm, BOOLEAN useCommandLineValues, IDATA (*callback)(struct J9JavaVM *vm, struct J9SharedCacheInfo *event_data, void *user_data), void *user_data) ;
@@ -1298,6 +1328,7 @@ typedef struct J9SharedClassConfig {
 	I_32 minJIT;
 	I_32 maxJIT;
 	struct J9SharedLocalStartupHints localStartupHints;
+	struct J9SharedLocalStartupClassTrace localStartupClassTrace;
 	const char* cacheName;
 	I_8 layer;
 	U_64 readOnlyCacheRuntimeFlags;
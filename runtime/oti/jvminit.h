@@ -425,6 +425,10 @@ enum INIT_STAGE {
 
 #define VMOPT_XXENABLESHAREUNSAFECLASSES "-XX:+ShareUnsafeClasses"
 #define VMOPT_XXDISABLESHAREUNSAFECLASSES "-XX:-ShareUnsafeClasses"
+#define VMOPT_XXSHARECLASSESUSEHUGEPAGES "-XX:+ShareClassesUseHugePages"
+#define VMOPT_XXNOSHARECLASSESUSEHUGEPAGES "-XX:-ShareClassesUseHugePages"
+#define VMOPT_XXSHARECLASSESNUMAINTERLEAVE "-XX:+ShareClassesNUMAInterleave"
+#define VMOPT_XXNOSHARECLASSESNUMAINTERLEAVE "-XX:-ShareClassesNUMAInterleave"
 
 #define VMOPT_XXFORCECLASSFILEASINTERMEDIATEDATA "-XX:ForceClassfileAsIntermediateData"
 #define VMOPT_XXRECREATECLASSFILEONLOAD "-XX:RecreateClassfileOnload"
@@ -224,6 +224,36 @@ typedef struct AttachedDataWrapper {
 #define ADWDATA(adw) (((U_8*)(adw)) + sizeof(AttachedDataWrapper))
 #define ADWITEM(adw) (((U_8*)(adw)) - sizeof(ShcItem))
 
+/* The lookup index is stored as unindexed byte data and found through J9SharedCacheHeader.lookupIndexOffset.
+ * It covers itemCount consecutive items from the start of the cache. Items that are looked up by key are kept in a
+ * hash table that is probed in place, the others are replayed in cache order at startup.
+ * Item offsets are relative to the cache header, so the index does not depend on where the cache is mapped. */
+typedef struct LookupIndexHeader {
+	U_32 eyecatcher;
+	U_32 version;
+	U_32 itemCount;
+	U_32 startOffset; /* offset of the ShcItemHdr of the first item covered */
+	U_32 scanOffset; /* offset of the ShcItemHdr following the last item covered */
+	U_32 bucketCount; /* a power of 2 */
+	U_32 keyedCount;
+	U_32 replayCount;
+} LookupIndexHeader;
+
+typedef struct LookupIndexEntry {
+	U_32 hashValue;
+	U_32 itemOffset;
+} LookupIndexEntry;
+
+#define LOOKUPINDEX_EYECATCHER 0x58444953 /* "SIDX" */
+#define LOOKUPINDEX_VERSION 1
+
+/* bucketCount + 1 bucket starts, then the keyed entries sorted by bucket, then the replayed item offsets */
+#define LIBUCKETS(lih) ((U_32*)(((U_8*)(lih)) + sizeof(LookupIndexHeader)))
+#define LIENTRIES(lih) ((LookupIndexEntry*)(LIBUCKETS(lih) + J9SHR_READMEM((lih)->bucketCount) + 1))
+#define LIREPLAY(lih) ((U_32*)(LIENTRIES(lih) + J9SHR_READMEM((lih)->keyedCount)))
+#define LILEN(bucketCount, keyedCount, replayCount) \
+	(sizeof(LookupIndexHeader) + (((UDATA)(bucketCount) + 1) * sizeof(U_32)) + ((UDATA)(keyedCount) * sizeof(LookupIndexEntry)) + ((UDATA)(replayCount) * sizeof(U_32)))
+
 #ifdef __cplusplus
 }
 #endif
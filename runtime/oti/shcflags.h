@@ -55,7 +55,8 @@
 #define J9SHR_DATA_TYPE_STARTUP_HINTS 10
 #define J9SHR_DATA_TYPE_AOTCLASSCHAIN 11
 #define J9SHR_DATA_TYPE_AOTTHUNK 12
-#define J9SHR_DATA_TYPE_MAX 12
+#define J9SHR_DATA_TYPE_STARTUP_CLASSES 13
+#define J9SHR_DATA_TYPE_MAX 13
 
 #define J9SHR_ATTACHED_DATA_TYPE_UNKNOWN  0
 #define J9SHR_ATTACHED_DATA_TYPE_JITPROFILE  1
@@ -147,6 +148,17 @@
 /* flags used by J9SharedStartupHintsDataDescriptor->flags */
 #define J9SHR_STARTUPHINTS_HEAPSIZES_SET	1
 
+/* flags used by J9SharedLocalStartupClassTrace.flags */
+#define J9SHR_LOCAL_STARTUPCLASSTRACE_FLAG_RECORD	1
+#define J9SHR_LOCAL_STARTUPCLASSTRACE_FLAG_STOP_PREFAULT	2
+
+/* flags used by J9SharedCacheAPI.mappingFlags */
+#define J9SHR_MAPPINGFLAG_HUGEPAGES	1
+#define J9SHR_MAPPINGFLAG_NUMA_INTERLEAVE	2
+
+/* maximum number of classes recorded in the startup class trace */
+#define J9SHR_STARTUPCLASSTRACE_MAX_ENTRIES	16384
+
 
 #define J9SHR_LOADTYPE_NORMAL  1
 #define J9SHR_LOADTYPE_REDEFINED  2
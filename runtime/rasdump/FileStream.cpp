@@ -24,12 +24,21 @@
 #include <string.h>
 #include "FileStream.hpp"
 #include "../oti/util_api.h"
+#include "zlib.h"
+
+/* Size of the chunks compressed data is written in, and the initial size of an in-memory buffer */
+#define FILESTREAM_BUFFER_SIZE (64 * 1024)
 
 /* Constructor */
 FileStream::FileStream(J9PortLibrary* portLibrary) :
 	_PortLibrary(portLibrary),
 	_FileHandle(-1),
-	_Error(0)
+	_Error(0),
+	_InMemory(false),
+	_Buffer(NULL),
+	_BufferLength(0),
+	_BufferCapacity(0),
+	_ZStream(NULL)
 {
 	/* Nothing to do */
 }
@@ -42,30 +51,113 @@ FileStream::~FileStream()
 
 /* Method for opening the file */
 void
-FileStream::open(const char* fileName)
+FileStream::open(const char* fileName, bool compress)
 {
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
 	if (fileName[0] != '-' ) {
 		_FileHandle = j9cached_file_open(_PortLibrary, fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate | EsOpenCreateNoTag, 0666);
 		_Error = 0;
+
+		if (compress && (_FileHandle != -1)) {
+			/* Compress for speed rather than size: the VM is stopped while the data is written */
+			_ZStream = (z_stream_s*)j9mem_allocate_memory(sizeof(z_stream), OMRMEM_CATEGORY_VM);
+			_Buffer = (char*)j9mem_allocate_memory(FILESTREAM_BUFFER_SIZE, OMRMEM_CATEGORY_VM);
+			if ((NULL != _ZStream) && (NULL != _Buffer)) {
+				memset(_ZStream, 0, sizeof(z_stream));
+				_BufferCapacity = FILESTREAM_BUFFER_SIZE;
+				/* A window size of 15 plus 16 selects the gzip wrapper */
+				if (Z_OK == deflateInit2(_ZStream, Z_BEST_SPEED, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY)) {
+					return;
+				}
+			}
+
+			/* Compression isn't available so fall back to writing the data as is */
+			j9mem_free_memory(_ZStream);
+			j9mem_free_memory(_Buffer);
+			_ZStream = NULL;
+			_Buffer = NULL;
+			_BufferCapacity = 0;
+		}
 	}
 }
 
+/* Method for collecting the data in memory */
+void
+FileStream::openBuffer(void)
+{
+	_InMemory = true;
+	_Error = 0;
+}
+
+/* Methods for accessing the data collected in memory */
+char*
+FileStream::buffer(void) const
+{
+	return _Buffer;
+}
+
+UDATA
+FileStream::bufferLength(void) const
+{
+	return _BufferLength;
+}
+
+/* Method for handing the data collected in memory over to the caller */
+char*
+FileStream::releaseBuffer(UDATA* length)
+{
+	char* result = _Buffer;
+
+	*length = _BufferLength;
+	_Buffer = NULL;
+	_BufferLength = 0;
+	_BufferCapacity = 0;
+
+	return result;
+}
+
+/* Method for discarding the data collected in memory */
+void
+FileStream::resetBuffer(void)
+{
+	_BufferLength = 0;
+}
+
 /* Method for closing the file */
 void 
 FileStream::close(void)
 {
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (NULL != _ZStream) {
+		/* Flush whatever the compressor is still holding on to */
+		if (0 == _Error) {
+			deflateCharacters(NULL, 0, Z_FINISH);
+		}
+		deflateEnd(_ZStream);
+		j9mem_free_memory(_ZStream);
+		_ZStream = NULL;
+	}
+
 	if (_FileHandle != -1) {
 		j9cached_file_sync(_PortLibrary, _FileHandle);
 		j9cached_file_close(_PortLibrary, _FileHandle);
 	}
 
+	j9mem_free_memory(_Buffer);
+	_Buffer = NULL;
+	_BufferLength = 0;
+	_BufferCapacity = 0;
+	_InMemory = false;
+
 	_FileHandle = -1;	
 }
 
 /* Methods for getting the object's status */
 bool FileStream::isOpen(void) const
 {
-	return _FileHandle != -1;
+	return _InMemory || (_FileHandle != -1);
 }
 
 bool FileStream::hasError(void) const
@@ -77,11 +169,17 @@ bool FileStream::hasError(void) const
 void
 FileStream::writeCharacters(const char* data, IDATA length)
 {
-	if (_FileHandle != -1 && ! _Error) {
-		IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
+	if (_InMemory && ! _Error) {
+		appendToBuffer(data, length);
+	} else if (_FileHandle != -1 && ! _Error) {
+		if (NULL != _ZStream) {
+			deflateCharacters(data, length, Z_NO_FLUSH);
+		} else {
+			IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, data, length);
 
-		if (rc != length) {
-			_Error = rc;
+			if (rc != length) {
+				_Error = rc;
+			}
 		}
 	}
 }
@@ -111,3 +209,67 @@ FileStream::writeNumber(IDATA data, int length)
 	/* Write the data to the file */
 	writeCharacters(buffer, length);
 }
+
+/* Method for compressing data and writing the result to the file */
+void
+FileStream::deflateCharacters(const char* data, IDATA length, int flush)
+{
+	do {
+		/* zlib counts in 32 bits so feed it large blocks a piece at a time */
+		uInt chunk = (uInt)((length > (1 << 30)) ? (1 << 30) : length);
+		int chunkFlush = ((IDATA)chunk == length) ? flush : Z_NO_FLUSH;
+
+		_ZStream->next_in = (Bytef*)data;
+		_ZStream->avail_in = chunk;
+
+		do {
+			_ZStream->next_out = (Bytef*)_Buffer;
+			_ZStream->avail_out = (uInt)_BufferCapacity;
+
+			if (Z_STREAM_ERROR == deflate(_ZStream, chunkFlush)) {
+				_Error = -1;
+				return;
+			}
+
+			IDATA produced = (IDATA)(_BufferCapacity - _ZStream->avail_out);
+			if (produced > 0) {
+				IDATA rc = j9cached_file_write(_PortLibrary, _FileHandle, _Buffer, produced);
+
+				if (rc != produced) {
+					_Error = rc;
+					return;
+				}
+			}
+		} while (0 == _ZStream->avail_out);
+
+		data += chunk;
+		length -= chunk;
+	} while (length > 0);
+}
+
+/* Method for adding data to the in-memory buffer, growing it as needed */
+void
+FileStream::appendToBuffer(const char* data, IDATA length)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if ((_BufferLength + length) > _BufferCapacity) {
+		UDATA newCapacity = (0 == _BufferCapacity) ? FILESTREAM_BUFFER_SIZE : _BufferCapacity;
+
+		while ((_BufferLength + length) > newCapacity) {
+			newCapacity *= 2;
+		}
+
+		char* newBuffer = (char*)j9mem_reallocate_memory(_Buffer, newCapacity, OMRMEM_CATEGORY_VM);
+		if (NULL == newBuffer) {
+			_Error = -1;
+			return;
+		}
+
+		_Buffer = newBuffer;
+		_BufferCapacity = newCapacity;
+	}
+
+	memcpy(_Buffer + _BufferLength, data, length);
+	_BufferLength += length;
+}
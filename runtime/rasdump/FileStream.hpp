@@ -25,6 +25,8 @@
 /* Includes */
 #include "j9port.h"
 
+struct z_stream_s;
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* Class for writing to a file                                                                    */
@@ -39,8 +41,21 @@ public :
 	/* Destructor */
 	~FileStream();
 
-	/* Method for opening the file */
-	void open(const char* fileName);
+	/* Method for opening the file, optionally compressing everything written to it (gzip format) */
+	void open(const char* fileName, bool compress = false);
+
+	/* Method for collecting the data in memory rather than writing it to a file */
+	void openBuffer(void);
+
+	/* Methods for accessing the data collected in memory */
+	char* buffer(void) const;
+	UDATA bufferLength(void) const;
+
+	/* Method for handing the data collected in memory over to the caller, who must free it */
+	char* releaseBuffer(UDATA* length);
+
+	/* Method for discarding the data collected in memory, keeping the space for reuse */
+	void resetBuffer(void);
 
 	/* Method for closing the file */
 	void close(void);
@@ -59,11 +74,20 @@ private :
 	FileStream(const FileStream& source);
 	FileStream& operator=(const FileStream& source);
 
+	/* Internal methods */
+	void deflateCharacters(const char* data, IDATA length, int flush);
+	void appendToBuffer(const char* data, IDATA length);
+
 protected :
 	/* Declared data */
 	J9PortLibrary* _PortLibrary;
 	IDATA          _FileHandle;
 	IDATA          _Error;
+	bool           _InMemory;
+	char*          _Buffer;
+	UDATA          _BufferLength;
+	UDATA          _BufferCapacity;
+	z_stream_s*    _ZStream;
 };
 
 #endif
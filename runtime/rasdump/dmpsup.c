@@ -1219,6 +1219,8 @@ freeRasDumpGlobalStorage(J9JavaVM *vm)
 			j9str_free_tokens(dump_storage->dumpLabelTokens);
 		}
 
+		freeHeapDumpDeltaBaseline(vm, dump_storage);
+
 		/* now free the rasdump global storage */
 		j9mem_free_memory(dump_storage);
 	}
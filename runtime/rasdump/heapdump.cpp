@@ -26,7 +26,11 @@
 #include "j2sever.h"
 #include "HeapIteratorAPI.h"
 #include "j9dmpnls.h"
+#include "j9argscan.h"
+#include "j9dump.h"
+#include "rasdump_internal.h"
 #include "FileStream.hpp"
+#include "zlib.h"
 
 #include "ut_j9dmp.h"
 
@@ -39,6 +43,8 @@ static jvmtiIterationControl binaryHeapDumpHeapIteratorCallback   (J9JavaVM* vm,
 static jvmtiIterationControl binaryHeapDumpSpaceIteratorCallback  (J9JavaVM* vm, J9MM_IterateSpaceDescriptor*  spaceDescriptor,   void* userData);
 static jvmtiIterationControl binaryHeapDumpRegionIteratorCallback (J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
 static jvmtiIterationControl binaryHeapDumpObjectIteratorCallback (J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor,  void* userData);
+static jvmtiIterationControl binaryHeapDumpRegionCollectorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+static int J9THREAD_PROC     binaryHeapDumpHelperThread(void* userData);
 
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorTraitsCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
@@ -52,6 +58,55 @@ static jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback
 #define allClassesEndDo(vm, state) \
 	vm->internalVMFunctions->allClassesEndDo(state)
 
+/* Regions bigger than this are written straight to the file rather than being formatted in memory */
+#define BINARY_HEAPDUMP_MAXIMUM_PARTITION_SIZE ((UDATA)256 * 1024 * 1024)
+
+/* Granularity at which a delta heap dump decides whether objects have changed since the previous dump */
+#define BINARY_HEAPDUMP_DELTA_CHUNK_SIZE ((UDATA)256 * 1024)
+
+/* A chunk of the heap as it was when the previous delta heap dump was taken */
+typedef struct HeapDumpDeltaChunk {
+	UDATA base; /* address of the chunk, or of its region if the region starts part way through it */
+	UDATA generation; /* the dump the chunk was last seen in */
+	U_32 crc; /* checksum of the chunk's records */
+} HeapDumpDeltaChunk;
+
+/* What the next delta heap dump is compared against, kept in the rasdump global storage */
+typedef struct HeapDumpDeltaBaseline {
+	J9HashTable* chunks;
+	UDATA generation;
+} HeapDumpDeltaBaseline;
+
+static UDATA
+deltaChunkHashFunction(void *entry, void *userData)
+{
+	return ((HeapDumpDeltaChunk*)entry)->base >> 3;
+}
+
+static UDATA
+deltaChunkHashEqualFunction(void *left, void *right, void *userData)
+{
+	return ((HeapDumpDeltaChunk*)left)->base == ((HeapDumpDeltaChunk*)right)->base;
+}
+
+/* Is the dump being taken because the VM crashed or ran out of Java heap? */
+static bool
+isCrashOrOutOfMemory(J9RASdumpContext* context)
+{
+	static const char outOfMemoryError[] = "java/lang/OutOfMemoryError";
+
+	if (0 != (context->eventFlags & (J9RAS_DUMP_ON_GP_FAULT | J9RAS_DUMP_ON_ABORT_SIGNAL | J9RAS_DUMP_ON_TRACE_ASSERT))) {
+		return true;
+	}
+	if ((0 != (context->eventFlags & J9RAS_DUMP_ON_EXCEPTION_SYSTHROW)) && (NULL != context->eventData)) {
+		J9RASdumpEventData* eventData = context->eventData;
+
+		return (eventData->detailLength == (sizeof(outOfMemoryError) - 1))
+			&& (0 == strncmp(eventData->detailData, outOfMemoryError, eventData->detailLength));
+	}
+	return false;
+}
+
 /* Function prototypes for performance measurement 
 void startTimer();
 void stopTimer();
@@ -756,6 +811,8 @@ private :
 	friend jvmtiIterationControl binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9MM_IterateObjectDescriptor* objectDescriptor, J9MM_IterateObjectRefDescriptor* referenceDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpHeapIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateHeapDescriptor* heapDescriptor, void* userData);
 	friend jvmtiIterationControl binaryHeapDumpRegionIteratorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend jvmtiIterationControl binaryHeapDumpRegionCollectorCallback(J9JavaVM* virtualMachine, J9MM_IterateRegionDescriptor* regionDescription, void* userData);
+	friend int J9THREAD_PROC     binaryHeapDumpHelperThread(void* userData);
 
 	/* Nested class for determining the characteristics of the references */
 	class ReferenceTraits
@@ -825,9 +882,13 @@ private :
 		
 		/* Methods for getting the object's attributes */
 		int index(void) const;
+		const void* at(int index) const;
 
 		/* Method for setting the object back to its initial state (i.e. empty) */
 		void clear(void);
+
+		/* Method for taking over the classes added to a cache that started out empty, as if they had been added here */
+		void merge(const void* const* classes, int index);
 		
 	private :
 		/* Prevent use of the copy constructor and assignment operator */
@@ -839,19 +900,73 @@ private :
 		int         _Index;
 	};
 
+	/* Nested structure describing a region whose records are formatted in memory by a helper thread.       */
+	/* The records of a region are only position independent once its first object has been written, so    */
+	/* that object is left for the thread writing the file, and the short records, which name a class cache */
+	/* slot, are noted so their slots can be rotated to match the class cache state at the time of writing.  */
+	struct RegionPartition
+	{
+		J9MM_IterateRegionDescriptor _Region;
+		bool                         _DeferFirstObject;
+		bool                         _Direct;
+		volatile bool                _Formatted;
+		bool                         _Failed;
+		char*                        _Records;
+		UDATA                        _RecordsLength;
+		UDATA*                       _ShortRecords;
+		UDATA                        _ShortRecordCount;
+		UDATA                        _ShortRecordCapacity;
+		bool                         _HasFirstObject;
+		J9MM_IterateObjectDescriptor _FirstObject;
+		void*                        _LastObject;
+		const void*                  _Classes[4];
+		int                          _ClassIndex;
+	};
+
+	/* Nested structure shared by the thread writing the file and the helper threads formatting regions */
+	struct ParallelState
+	{
+		omrthread_monitor_t _Monitor;
+		RegionPartition*    _Partitions;
+		UDATA               _PartitionCount;
+		UDATA               _NextToFormat;
+		UDATA               _NextToWrite;
+		UDATA               _Window;
+		UDATA               _ActiveThreads;
+		bool                _Abort;
+	};
+
 	friend class ReferenceTraits;
 	friend class ReferenceWriter;
 
+	/* Constructor for a helper writer formatting the records of one region in memory */
+	BinaryHeapDumpWriter(BinaryHeapDumpWriter* parent, RegionPartition* partition);
+
 	/* Internal methods */
 	void             openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDesriptor);
+	void             writeRegions(J9MM_IterateSpaceDescriptor* spaceDescriptor);
+	bool             writeRegionsInParallel(J9MM_IterateSpaceDescriptor* spaceDescriptor);
+	void             formatPartitions(void);
+	void             formatPartition(void);
+	void             writePartition(RegionPartition* partition);
+	void             noteShortRecord(void);
+	bool             multipleFiles(void) const;
+	void             startDeltaFile(void);
+	void             endDeltaFile(void);
+	void             startDeltaSegment(UDATA base);
+	void             finishDeltaChunk(void);
+	void             writeDeltaSegment(int tag);
+	void             discardDeltaBaseline(void);
 	void             writeDumpFileHeader(void);
 	void             writeDumpFileTrailer(void);
+	void             writeClassRecords(void);
 	void             writeFullVersionRecord(void);
 	void             writeObjectRecord(J9MM_IterateObjectDescriptor* objectDescriptor);
 	void             writeNormalObjectRecord(J9MM_IterateObjectDescriptor* objectDescriptor);
 	void             writeArrayObjectRecord(J9MM_IterateObjectDescriptor* objectDescriptor);
 	void             writeClassRecord(J9Class* clazz);
 	static int       numberSize(IDATA number);
+	int              gapSize(IDATA addressOffset);
 	int              getObjectHashCode(j9object_t object);
 	static int       numberSizeEncoding(int numberSize);
 	static int       wordSize(void);
@@ -873,6 +988,15 @@ private :
 	ClassCache        _ClassCache;
 	bool              _FileMode;
 	bool              _Error;
+	bool              _Compress;
+	UDATA             _HelperThreads;
+	ParallelState*    _Parallel;
+	RegionPartition*  _Partition;
+	HeapDumpDeltaBaseline* _Baseline;
+	FileStream        _DeltaStream;
+	RegionPartition   _Segment;
+	UDATA             _ChunkBase;
+	bool              _WideGap;
 
 	/* Static methods returning constant values */
 	inline static const char* identifierField(void)        {return "portable heap dump";}
@@ -907,6 +1031,14 @@ private :
 	inline static char        arrayObjectRecordField(void) {return 0x08;}
 	inline static char        classObjectRecordField(void) {return 0x06;}
 	inline static char        dumpEndField(void)           {return 0x03;}
+
+	/* Static methods returning constant values for the delta heap dump container */
+	inline static const char* deltaIdentifierField(void)      {return "portable heap dump delta";}
+	inline static char        deltaVersionField(void)         {return 0x01;}
+	inline static char        deltaBaselineFlag(void)         {return 0x01;}
+	inline static char        deltaEndField(void)             {return 0x00;}
+	inline static char        deltaObjectsSegmentField(void)  {return 0x01;}
+	inline static char        deltaClassesSegmentField(void)  {return 0x02;}
 };
 
 /**************************************************************************************************/
@@ -1091,6 +1223,17 @@ BinaryHeapDumpWriter::ClassCache::index(void) const
 	return _Index;
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::ClassCache::at() method implementation                                   */
+/*                                                                                                */
+/**************************************************************************************************/
+const void*
+BinaryHeapDumpWriter::ClassCache::at(int index) const
+{
+	return _Cache[index];
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::ClassCache::clear() method implementation                                */
@@ -1107,6 +1250,24 @@ BinaryHeapDumpWriter::ClassCache::clear(void)
 	_Index = 0;
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::ClassCache::merge() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::ClassCache::merge(const void* const* classes, int index)
+{
+	/* The other cache filled its slots from 0 while a reader fills them from our current index */
+	for (int i = 0; i < 4; i++) {
+		if (classes[i] != 0) {
+			_Cache[(_Index + i) % 4] = classes[i];
+		}
+	}
+
+	_Index = (_Index + index) % 4;
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::BinaryHeapDumpWriter() method implementation                             */
@@ -1124,10 +1285,20 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	_OutputStream(context->javaVM->portLibrary),
 	_CurrentObject(0),
 	_FileMode(false),
-	_Error(false)
+	_Error(false),
+	_Compress(false),
+	_HelperThreads(0),
+	_Parallel(NULL),
+	_Partition(NULL),
+	_Baseline(NULL),
+	_DeltaStream(context->javaVM->portLibrary),
+	_ChunkBase(0),
+	_WideGap(false)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
 
+	memset(&_Segment, 0, sizeof(_Segment));
+
 	/* If a binary heap dump hasn't been requested there's nothing to do */
 	if ((agent->dumpOptions != 0) && (strstr(agent->dumpOptions, "PHD") == 0)) {
 		return;
@@ -1135,31 +1306,95 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 	
 	/* Remember the file name */
 	_FileName += fileName;
+
+	if (agent->dumpOptions != 0) {
+		/* Compress the dump file(s) as they are written? */
+		_Compress = (strstr(agent->dumpOptions, "GZIP") != 0);
+
+		/* Format regions on helper threads only when asked to, the dump is written on this thread alone by default */
+		char* threads = strstr(agent->dumpOptions, "THREADS");
+		if (threads) {
+			threads += 7;
+			scan_udata(&threads, &_HelperThreads);
+		}
+
+		/* Only write what has changed since the previous delta dump? */
+		if (strstr(agent->dumpOptions, "DELTA") != 0) {
+			RasDumpGlobalStorage* dumpGlobal = (RasDumpGlobalStorage*)_VirtualMachine->j9rasdumpGlobalStorage;
+
+			if ((dumpGlobal != NULL) && (dumpGlobal->heapDumpDeltaBaseline == NULL)) {
+				/* This dump will be the baseline */
+				HeapDumpDeltaBaseline* baseline = (HeapDumpDeltaBaseline*)j9mem_allocate_memory(sizeof(HeapDumpDeltaBaseline), OMRMEM_CATEGORY_VM);
+
+				if (baseline != NULL) {
+					baseline->generation = 0;
+					baseline->chunks = hashTableNew(
+						OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 0,
+						sizeof(HeapDumpDeltaChunk), sizeof(UDATA), 0,
+						OMRMEM_CATEGORY_VM,
+						deltaChunkHashFunction,
+						deltaChunkHashEqualFunction,
+						NULL, NULL
+					);
+
+					if (baseline->chunks != NULL) {
+						dumpGlobal->heapDumpDeltaBaseline = baseline;
+					} else {
+						j9mem_free_memory(baseline);
+					}
+				}
+			}
+
+			/* If the baseline can't be kept a full dump is written instead */
+			if (dumpGlobal != NULL) {
+				_Baseline = (HeapDumpDeltaBaseline*)dumpGlobal->heapDumpDeltaBaseline;
+			}
+		}
+	}
+
+	/* Don't start threads or allocate buffers for them when the VM has crashed or run out of memory */
+	if ((_HelperThreads > 0) && isCrashOrOutOfMemory(context)) {
+		_HelperThreads = 0;
+	}
+
+	/* Name compressed files so that tools don't read them as raw PHD, delta dumps are never compressed */
+	if (_Compress && (_Baseline == NULL)) {
+		_FileName += ".gz";
+	}
 	
 	/* Handle the cases of multiple dump files and a single dump file separately */
-	if (!(_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)) {
+	if (!multipleFiles()) {
 		/* Write a message to standard error saying we are about to write a dump file */
-		reportDumpRequest(_PortLibrary,_Context,"Heap",fileName);
+		reportDumpRequest(_PortLibrary,_Context,"Heap",_FileName.data());
 		
-		/* It's a single file so open it */
-		_OutputStream.open(_FileName.data());
-	
 		/* Performance measuring code 
 		startTimer();
 		*/
 
-		/* Start writing the file */
-		writeDumpFileHeader();
+		if (_Baseline != NULL) {
+			/* Open the file and start writing the delta container */
+			startDeltaFile();
+		} else {
+			/* It's a single file so open it */
+			_OutputStream.open(_FileName.data(), _Compress);
+
+			/* Start writing the file */
+			writeDumpFileHeader();
+		}
 	}
 
 	/* It's multiple files so iterate through the heaps and spaces */
 	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_heaps(_VirtualMachine, _PortLibrary, 0, binaryHeapDumpHeapIteratorCallback, this);
 
 	/* Handle the cases of multiple dump files and a single dump file separately */
-	if (!(_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)) {
+	if (!multipleFiles()) {
 		/* Complete the dump file */
 		if (! _Error) {
-			writeDumpFileTrailer();
+			if (_Baseline != NULL) {
+				endDeltaFile();
+			} else {
+				writeDumpFileTrailer();
+			}
 		}
 
 		/* Performance measuring code 
@@ -1167,20 +1402,30 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 		*/
 
 		/* Record the status of the operation */
-		_FileMode = _FileMode || _OutputStream.isOpen();
+		if (_Baseline != NULL) {
+			_FileMode = _FileMode || _DeltaStream.isOpen();
+		} else {
+			_FileMode = _FileMode || _OutputStream.isOpen();
+		}
 
 		/* Close the file */
 		_OutputStream.close();
+		_DeltaStream.close();
+
+		/* Later deltas can't be merged with a dump that wasn't written, so start again */
+		if ((_Baseline != NULL) && (_Error || !_FileMode)) {
+			discardDeltaBaseline();
+		}
 		
 		/* Write a message to standard error saying we have written a dump file */
 		/* If an error occurred, the error message has already been printed in checkForIOError() */
 		if (! _Error) {
 			if (_FileMode) {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_WRITTEN_DUMP_STR, "Heap", _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			} else {
-				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, fileName);
-				Trc_dump_reportDumpEnd_Event2("Heap", fileName);
+				j9nls_printf(PORTLIB, J9NLS_INFO | J9NLS_STDERR, J9NLS_DMP_NO_CREATE, _FileName.data());
+				Trc_dump_reportDumpEnd_Event2("Heap", _FileName.data());
 			}
 		}
 	}
@@ -1193,7 +1438,46 @@ BinaryHeapDumpWriter::BinaryHeapDumpWriter(const char* fileName, J9RASdumpContex
 /**************************************************************************************************/
 BinaryHeapDumpWriter::~BinaryHeapDumpWriter()
 {
-	/* Nothing to do currently */
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	/* Free the short record offsets a delta dump collected, including on the error paths */
+	j9mem_free_memory(_Segment._ShortRecords);
+	_Segment._ShortRecords = NULL;
+	_Segment._ShortRecordCapacity = 0;
+	_Segment._ShortRecordCount = 0;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::BinaryHeapDumpWriter() helper method implementation                      */
+/*                                                                                                */
+/**************************************************************************************************/
+BinaryHeapDumpWriter::BinaryHeapDumpWriter(BinaryHeapDumpWriter* parent, RegionPartition* partition) :
+	_Id(0),
+	_RegionStart(NULL),
+	_RegionEnd(NULL),
+	_Context(parent->_Context),
+	_Agent(parent->_Agent),
+	_VirtualMachine(parent->_VirtualMachine),
+	_PortLibrary(parent->_PortLibrary),
+	_FileName(parent->_PortLibrary),
+	_OutputStream(parent->_PortLibrary),
+	_CurrentObject(0),
+	_FileMode(false),
+	_Error(false),
+	_Compress(false),
+	_HelperThreads(0),
+	_Parallel(NULL),
+	_Partition(partition),
+	_Baseline(NULL),
+	_DeltaStream(parent->_PortLibrary),
+	_ChunkBase(0),
+	_WideGap(false)
+{
+	memset(&_Segment, 0, sizeof(_Segment));
+
+	/* The records are collected in memory and handed over to the parent by formatPartition() */
+	_OutputStream.openBuffer();
 }
 
 /**************************************************************************************************/
@@ -1209,7 +1493,7 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 	CharacterString fileName(PORTLIB);
 	
 	/* Handle the single and multiple dump file cases separately */
-	if (_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS) {
+	if (multipleFiles()) {
 		/* Find the position of the '%id' in the file name */
 		UDATA position = _FileName.find("%id");
 
@@ -1227,23 +1511,17 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 		_ClassCache.clear();
 
 		/* Open the file */
-		_OutputStream.open(fileName.data());
+		_OutputStream.open(fileName.data(), _Compress);
 
 		/* Start writing the file */
 		writeDumpFileHeader();
 	}
 
 	/* Iterate through the regions etc. */
-	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
-			_VirtualMachine,
-			_PortLibrary,
-			spaceDescriptor,
-			j9mm_iterator_flag_regions_read_only,
-			binaryHeapDumpRegionIteratorCallback,
-			this);
+	writeRegions(spaceDescriptor);
 
 	/* Handle the single and multiple dump file cases separately */
-	if (_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS) {
+	if (multipleFiles()) {
 		/* Complete the dump file */
 		if (! _Error) {
 			writeDumpFileTrailer();
@@ -1269,6 +1547,496 @@ BinaryHeapDumpWriter::openNewDumpFile(J9MM_IterateSpaceDescriptor* spaceDescript
 	}
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeRegions() method implementation                                     */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeRegions(J9MM_IterateSpaceDescriptor* spaceDescriptor)
+{
+	/* Format the regions on helper threads if possible (delta dumps are checked chunk by chunk on this thread) */
+	if ((_HelperThreads > 0) && (_Baseline == NULL) && writeRegionsInParallel(spaceDescriptor)) {
+		return;
+	}
+
+	/* Otherwise walk the regions on this thread, writing records as the objects are found */
+	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(
+			_VirtualMachine,
+			_PortLibrary,
+			spaceDescriptor,
+			j9mm_iterator_flag_regions_read_only,
+			binaryHeapDumpRegionIteratorCallback,
+			this);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeRegionsInParallel() method implementation                           */
+/*                                                                                                */
+/**************************************************************************************************/
+bool
+BinaryHeapDumpWriter::writeRegionsInParallel(J9MM_IterateSpaceDescriptor* spaceDescriptor)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+	ParallelState parallel;
+
+	memset(&parallel, 0, sizeof(parallel));
+
+	/* Count the regions, then collect their descriptors */
+	_Parallel = &parallel;
+	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(_VirtualMachine, _PortLibrary, spaceDescriptor, j9mm_iterator_flag_regions_read_only, binaryHeapDumpRegionCollectorCallback, this);
+	if (parallel._PartitionCount < 2) {
+		/* Nothing to share out */
+		_Parallel = NULL;
+		return false;
+	}
+
+	UDATA partitionsSize = parallel._PartitionCount * sizeof(RegionPartition);
+	parallel._Partitions = (RegionPartition*)j9mem_allocate_memory(partitionsSize, OMRMEM_CATEGORY_VM);
+	if (parallel._Partitions == NULL) {
+		_Parallel = NULL;
+		return false;
+	}
+
+	memset(parallel._Partitions, 0, partitionsSize);
+	parallel._PartitionCount = 0;
+	_VirtualMachine->memoryManagerFunctions->j9mm_iterate_regions(_VirtualMachine, _PortLibrary, spaceDescriptor, j9mm_iterator_flag_regions_read_only, binaryHeapDumpRegionCollectorCallback, this);
+
+	/* Bound how far the helpers may run ahead of the file, as that is what the buffered records cost */
+	parallel._Window = 2 * _HelperThreads;
+
+	if (0 != omrthread_monitor_init_with_name(&parallel._Monitor, 0, "heapdump helpers mutex")) {
+		j9mem_free_memory(parallel._Partitions);
+		_Parallel = NULL;
+		return false;
+	}
+
+	/* Start the helpers */
+	omrthread_monitor_enter(parallel._Monitor);
+	for (UDATA i = 0; i < _HelperThreads; i++) {
+		omrthread_t helper = NULL;
+
+		parallel._ActiveThreads += 1;
+		if (0 != _VirtualMachine->internalVMFunctions->createThreadWithCategory(
+				&helper,
+				0,
+				J9THREAD_PRIORITY_NORMAL,
+				0,
+				binaryHeapDumpHelperThread,
+				this,
+				J9THREAD_CATEGORY_SYSTEM_THREAD)
+		) {
+			parallel._ActiveThreads -= 1;
+			break;
+		}
+	}
+	bool started = (parallel._ActiveThreads > 0);
+	omrthread_monitor_exit(parallel._Monitor);
+
+	if (started) {
+		/* Write the regions in address order as their records become available */
+		for (UDATA i = 0; (i < parallel._PartitionCount) && !_Error; i++) {
+			RegionPartition* partition = &parallel._Partitions[i];
+
+			if (partition->_Direct) {
+				/* Too big to hold in memory, so walk it here */
+				binaryHeapDumpRegionIteratorCallback(_VirtualMachine, &partition->_Region, this);
+			} else {
+				omrthread_monitor_enter(parallel._Monitor);
+				while (!partition->_Formatted) {
+					omrthread_monitor_wait(parallel._Monitor);
+				}
+				omrthread_monitor_exit(parallel._Monitor);
+
+				writePartition(partition);
+			}
+
+			omrthread_monitor_enter(parallel._Monitor);
+			parallel._NextToWrite = i + 1;
+			omrthread_monitor_notify_all(parallel._Monitor);
+			omrthread_monitor_exit(parallel._Monitor);
+		}
+	}
+
+	/* Stop the helpers and wait for them to go */
+	omrthread_monitor_enter(parallel._Monitor);
+	parallel._Abort = true;
+	omrthread_monitor_notify_all(parallel._Monitor);
+	while (parallel._ActiveThreads > 0) {
+		omrthread_monitor_wait(parallel._Monitor);
+	}
+	omrthread_monitor_exit(parallel._Monitor);
+
+	/* Release anything left behind by an error */
+	for (UDATA i = 0; i < parallel._PartitionCount; i++) {
+		j9mem_free_memory(parallel._Partitions[i]._Records);
+		j9mem_free_memory(parallel._Partitions[i]._ShortRecords);
+	}
+
+	omrthread_monitor_destroy(parallel._Monitor);
+	j9mem_free_memory(parallel._Partitions);
+	_Parallel = NULL;
+
+	return started;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::formatPartitions() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::formatPartitions(void)
+{
+	ParallelState* parallel = _Parallel;
+
+	omrthread_monitor_enter(parallel->_Monitor);
+	while (!parallel->_Abort) {
+		/* Regions that are too big are left for the thread writing the file */
+		while ((parallel->_NextToFormat < parallel->_PartitionCount) && parallel->_Partitions[parallel->_NextToFormat]._Direct) {
+			parallel->_NextToFormat += 1;
+		}
+
+		if (parallel->_NextToFormat >= parallel->_PartitionCount) {
+			break;
+		}
+
+		if (parallel->_NextToFormat >= (parallel->_NextToWrite + parallel->_Window)) {
+			/* Far enough ahead, wait for the file to catch up */
+			omrthread_monitor_wait(parallel->_Monitor);
+			continue;
+		}
+
+		RegionPartition* partition = &parallel->_Partitions[parallel->_NextToFormat];
+		parallel->_NextToFormat += 1;
+		omrthread_monitor_exit(parallel->_Monitor);
+
+		BinaryHeapDumpWriter helper(this, partition);
+		helper.formatPartition();
+
+		omrthread_monitor_enter(parallel->_Monitor);
+		partition->_Formatted = true;
+		omrthread_monitor_notify_all(parallel->_Monitor);
+	}
+
+	parallel->_ActiveThreads -= 1;
+	omrthread_monitor_notify_all(parallel->_Monitor);
+	omrthread_monitor_exit(parallel->_Monitor);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::formatPartition() method implementation                                  */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::formatPartition(void)
+{
+	/* Format the region's records into memory */
+	binaryHeapDumpRegionIteratorCallback(_VirtualMachine, &_Partition->_Region, this);
+
+	/* Hand the records and the state they leave behind over to the partition */
+	_Partition->_Records = _OutputStream.releaseBuffer(&_Partition->_RecordsLength);
+	_Partition->_LastObject = _CurrentObject;
+	for (int i = 0; i < 4; i++) {
+		_Partition->_Classes[i] = _ClassCache.at(i);
+	}
+	_Partition->_ClassIndex = _ClassCache.index();
+	_Partition->_Failed = _Error;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writePartition() method implementation                                   */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writePartition(RegionPartition* partition)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (partition->_Failed) {
+		/* The helper has already reported the error */
+		_Error = true;
+	} else if (partition->_HasFirstObject) {
+		/* Write the first object now that the previous object and the class cache are known */
+		writeObjectRecord(&partition->_FirstObject);
+
+		if (!_Error) {
+			/* The helper numbered the class cache slots from 0, the reader will number them from here */
+			int rotation = _ClassCache.index();
+
+			if (rotation != 0) {
+				for (UDATA i = 0; i < partition->_ShortRecordCount; i++) {
+					U_8* flags = (U_8*)partition->_Records + partition->_ShortRecords[i];
+
+					*flags = (U_8)((*flags & ~0x60) | ((((*flags >> 5) + rotation) << 5) & 0x60));
+				}
+			}
+
+			/* Write the rest of the region's records */
+			writeCharacters(partition->_Records, partition->_RecordsLength);
+
+			/* Pick up the state the records leave behind */
+			_ClassCache.merge(partition->_Classes, partition->_ClassIndex);
+			_CurrentObject = partition->_LastObject;
+		}
+	}
+
+	j9mem_free_memory(partition->_Records);
+	j9mem_free_memory(partition->_ShortRecords);
+	partition->_Records = NULL;
+	partition->_ShortRecords = NULL;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::noteShortRecord() method implementation                                  */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::noteShortRecord(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	/* Remember where the record's tag/flags will be written */
+	if (_Partition->_ShortRecordCount == _Partition->_ShortRecordCapacity) {
+		UDATA newCapacity = (_Partition->_ShortRecordCapacity == 0) ? 1024 : (2 * _Partition->_ShortRecordCapacity);
+		UDATA* newShortRecords = (UDATA*)j9mem_reallocate_memory(_Partition->_ShortRecords, newCapacity * sizeof(UDATA), OMRMEM_CATEGORY_VM);
+
+		if (newShortRecords == NULL) {
+			_Error = true;
+			return;
+		}
+
+		_Partition->_ShortRecords = newShortRecords;
+		_Partition->_ShortRecordCapacity = newCapacity;
+	}
+
+	_Partition->_ShortRecords[_Partition->_ShortRecordCount] = _OutputStream.bufferLength();
+	_Partition->_ShortRecordCount += 1;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::multipleFiles() method implementation                                    */
+/*                                                                                                */
+/**************************************************************************************************/
+bool
+BinaryHeapDumpWriter::multipleFiles(void) const
+{
+	/* A delta dump is always a single file as its chunks are tracked across the whole heap */
+	return (0 != (_Agent->requestMask & J9RAS_DUMP_DO_MULTIPLE_HEAPS)) && (_Baseline == NULL);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::startDeltaFile() method implementation                                   */
+/*                                                                                                */
+/*   A delta dump is a container of segments, each holding the PHD records of one chunk of the   */
+/*   heap which has changed since the previous delta dump. Each segment starts with an empty      */
+/*   class cache and its first record carries the object's full address, so the phdmerge tool    */
+/*   can re-base the segments and splice them into a complete PHD file.                           */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::startDeltaFile(void)
+{
+	_Baseline->generation += 1;
+
+	/* Open the file, the records are formatted in memory and copied to it a segment at a time */
+	_DeltaStream.open(_FileName.data());
+	_OutputStream.openBuffer();
+	_Partition = &_Segment;
+
+	/* Write the container identifier */
+	_DeltaStream.writeNumber(strlen(deltaIdentifierField()), 2);
+	_DeltaStream.writeCharacters(deltaIdentifierField(), strlen(deltaIdentifierField()));
+
+	/* Write the version, the word size and which delta this is */
+	_DeltaStream.writeNumber(deltaVersionField(), 4);
+	_DeltaStream.writeNumber(wordSize(), 1);
+	_DeltaStream.writeNumber(_Baseline->generation, 8);
+	_DeltaStream.writeNumber((1 == _Baseline->generation) ? deltaBaselineFlag() : 0, 4);
+	checkForIOError();
+	if (_Error) {
+		return;
+	}
+
+	/* Write the header of the heap dump the merged deltas make up */
+	writeDumpFileHeader();
+	if (_Error) {
+		return;
+	}
+
+	_DeltaStream.writeNumber(_OutputStream.bufferLength(), 4);
+	_DeltaStream.writeCharacters(_OutputStream.buffer(), _OutputStream.bufferLength());
+	_OutputStream.resetBuffer();
+	checkForIOError();
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::endDeltaFile() method implementation                                     */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::endDeltaFile(void)
+{
+	/* Finish the chunk the walk ended in */
+	finishDeltaChunk();
+	if (_Error) {
+		return;
+	}
+
+	/* Chunks the walk didn't visit no longer hold any objects */
+	J9HashTableState state;
+	HeapDumpDeltaChunk* chunk = (HeapDumpDeltaChunk*)hashTableStartDo(_Baseline->chunks, &state);
+	while ((chunk != NULL) && !_Error) {
+		if (chunk->generation != _Baseline->generation) {
+			startDeltaSegment(chunk->base);
+			writeDeltaSegment(deltaObjectsSegmentField());
+			hashTableDoRemove(&state);
+		}
+		chunk = (HeapDumpDeltaChunk*)hashTableNextDo(&state);
+	}
+	if (_Error) {
+		return;
+	}
+
+	/* The classes are always written in full */
+	startDeltaSegment(0);
+	writeClassRecords();
+	if (_Error) {
+		return;
+	}
+
+	writeDeltaSegment(deltaClassesSegmentField());
+	if (_Error) {
+		return;
+	}
+
+	/* Write the container end tag */
+	_DeltaStream.writeNumber(deltaEndField(), 1);
+	checkForIOError();
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::startDeltaSegment() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::startDeltaSegment(UDATA base)
+{
+	/* Each segment is formatted as though it were the first in the dump */
+	_ChunkBase = base;
+	_CurrentObject = 0;
+	_ClassCache.clear();
+	_WideGap = true;
+	_Segment._ShortRecordCount = 0;
+	_OutputStream.resetBuffer();
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::finishDeltaChunk() method implementation                                 */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::finishDeltaChunk(void)
+{
+	PORT_ACCESS_FROM_PORT(_PortLibrary);
+
+	if (_ChunkBase == 0) {
+		return;
+	}
+
+	/* The records cover the addresses, classes, hash codes and references of the chunk's objects */
+	UDATA length = _OutputStream.bufferLength();
+	HeapDumpDeltaChunk key;
+
+	key.base = _ChunkBase;
+	key.generation = _Baseline->generation;
+	key.crc = (U_32)crc32(0, (const Bytef*)_OutputStream.buffer(), (uInt)length);
+
+	HeapDumpDeltaChunk* chunk = (HeapDumpDeltaChunk*)hashTableFind(_Baseline->chunks, &key);
+	if (chunk == NULL) {
+		/* New since the previous dump */
+		if (length != 0) {
+			if (hashTableAdd(_Baseline->chunks, &key) == NULL) {
+				j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", "cannot allocate delta baseline");
+				Trc_dump_reportDumpError_Event2("Heap", "cannot allocate delta baseline");
+				_Error = true;
+			} else {
+				writeDeltaSegment(deltaObjectsSegmentField());
+			}
+		}
+	} else if (length == 0) {
+		/* Emptied since the previous dump */
+		writeDeltaSegment(deltaObjectsSegmentField());
+		hashTableRemove(_Baseline->chunks, chunk);
+	} else {
+		/* Only write the chunk again if it has changed */
+		chunk->generation = key.generation;
+		if (chunk->crc != key.crc) {
+			chunk->crc = key.crc;
+			writeDeltaSegment(deltaObjectsSegmentField());
+		}
+	}
+
+	_ChunkBase = 0;
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeDeltaSegment() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeDeltaSegment(int tag)
+{
+	/* Write the segment tag and the chunk it describes */
+	_DeltaStream.writeNumber(tag, 1);
+	_DeltaStream.writeNumber((IDATA)_ChunkBase, wordSize());
+
+	/* Write the state the records leave behind for the segment that follows */
+	_DeltaStream.writeNumber((IDATA)_CurrentObject, wordSize());
+	_DeltaStream.writeNumber(_ClassCache.index(), 1);
+
+	/* Write where the short records are, as their class cache indexes are relative to the segment */
+	_DeltaStream.writeNumber(_Segment._ShortRecordCount, 4);
+	for (UDATA i = 0; i < _Segment._ShortRecordCount; i++) {
+		_DeltaStream.writeNumber(_Segment._ShortRecords[i], 4);
+	}
+
+	/* Write the records */
+	_DeltaStream.writeNumber(_OutputStream.bufferLength(), 4);
+	if (_OutputStream.bufferLength() != 0) {
+		_DeltaStream.writeCharacters(_OutputStream.buffer(), _OutputStream.bufferLength());
+	}
+
+	checkForIOError();
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::discardDeltaBaseline() method implementation                             */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::discardDeltaBaseline(void)
+{
+	RasDumpGlobalStorage* dumpGlobal = (RasDumpGlobalStorage*)_VirtualMachine->j9rasdumpGlobalStorage;
+
+	if ((dumpGlobal != NULL) && (dumpGlobal->heapDumpDeltaBaseline == _Baseline)) {
+		freeHeapDumpDeltaBaseline(_VirtualMachine, dumpGlobal);
+	}
+
+	_Baseline = NULL;
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::writeDumpFileHeader() method implementation                              */
@@ -1332,6 +2100,24 @@ BinaryHeapDumpWriter::writeDumpFileHeader(void)
 /**************************************************************************************************/
 void
 BinaryHeapDumpWriter::writeDumpFileTrailer(void)
+{
+	/* Write the classes */
+	writeClassRecords();
+	if (_Error) {
+		return;
+	}
+
+	/* Write the dump end tag */
+	writeNumber(dumpEndField(), 1);
+}
+
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::writeClassRecords() method implementation                                */
+/*                                                                                                */
+/**************************************************************************************************/
+void
+BinaryHeapDumpWriter::writeClassRecords(void)
 {
 	J9ClassWalkState state;
 	J9Class *clazz;
@@ -1348,9 +2134,6 @@ BinaryHeapDumpWriter::writeDumpFileTrailer(void)
 		clazz = allClassesNextDo(_VirtualMachine, &state);
 	}
 	allClassesEndDo(_VirtualMachine, &state);
-
-	/* Write the dump end tag */
-	writeNumber(dumpEndField(), 1);
 }
 
 /**********************************************{****************************************************/
@@ -1400,9 +2183,31 @@ BinaryHeapDumpWriter::writeObjectRecord(J9MM_IterateObjectDescriptor* objectDesc
 	j9object_t currentObject = objectDescriptor->object;
 	J9Class*  currentClass  = J9OBJECT_CLAZZ_VM(_VirtualMachine, currentObject);
 
+	/* Delta dumps write the objects a chunk at a time, so note when the walk moves into the next one */
+	if (_Baseline != NULL) {
+		UDATA chunkBase = (UDATA)currentObject & ~(BINARY_HEAPDUMP_DELTA_CHUNK_SIZE - 1);
+
+		if (chunkBase < (UDATA)_RegionStart) {
+			chunkBase = (UDATA)_RegionStart;
+		}
+
+		if (chunkBase != _ChunkBase) {
+			finishDeltaChunk();
+			if (_Error) {
+				return;
+			}
+			startDeltaSegment(chunkBase);
+		}
+	}
+
 	/* Handle class, array and normal objects separately */
 	if (J9VM_IS_INITIALIZED_HEAPCLASS_VM(_VirtualMachine, currentObject)) {
 		/* Do nothing - heap classes are handled in a separate walk */
+	} else if ((_Partition != NULL) && _Partition->_DeferFirstObject && !_Partition->_HasFirstObject) {
+		/* Its gap depends on where the previous region ended, so the thread writing the file writes it */
+		_Partition->_FirstObject    = *objectDescriptor;
+		_Partition->_HasFirstObject = true;
+		_CurrentObject              = currentObject;
 	} else if (J9ROMCLASS_IS_ARRAY(currentClass->romClass)) {
 		writeArrayObjectRecord(objectDescriptor);
 	} else {
@@ -1424,7 +2229,7 @@ BinaryHeapDumpWriter::writeNormalObjectRecord(J9MM_IterateObjectDescriptor* obje
 	/* Calculate the address delta (gap) from the previous object                 */
 	/* NB : The gap is defined in terms of 32 bit words regardless of the machine */
 	IDATA addressOffset         = ((char*)(currentObject) - (char*)_CurrentObject) / 4;
-	int   addressOffsetSize     = numberSize(addressOffset);
+	int   addressOffsetSize     = gapSize(addressOffset);
 	int   addressOffsetEncoding = numberSizeEncoding(addressOffsetSize);
 
 	/* Iterate through the references counting them and noting the biggest offset */
@@ -1458,6 +2263,14 @@ BinaryHeapDumpWriter::writeNormalObjectRecord(J9MM_IterateObjectDescriptor* obje
 	     (classCacheIndex         != -1) &&
 	     (0 == hashCode)) {
 		/* It is so generate a short format record */
+		/* Records formatted in memory may need their class cache index rotating when written out */
+		if (_Partition != NULL) {
+			noteShortRecord();
+			if (_Error) {
+				return;
+			}
+		}
+
 		/* Calculate the flags */
 		int flags = 
 		    0x80                                    | 
@@ -1634,7 +2447,7 @@ BinaryHeapDumpWriter::writeArrayObjectRecord(J9MM_IterateObjectDescriptor* objec
 	/* Calculate the address offset (gap) from the previous object                */
 	/* NB : The gap is defined in terms of 32 bit words regardless of the machine */
 	IDATA addressOffset         = ((char*)(currentObject) - (char*)_CurrentObject) / 4;
-	int   addressOffsetSize     = numberSize(addressOffset);
+	int   addressOffsetSize     = gapSize(addressOffset);
 	
 	/* Extract the object's class */
 	J9ArrayClass* arrayClass = (J9ArrayClass*)J9OBJECT_CLAZZ_VM(_VirtualMachine, currentObject);
@@ -1928,7 +2741,7 @@ BinaryHeapDumpWriter::writeClassRecord(J9Class *currentClass)
 	/* Calculate the address delta (gap) from the previous object                 */
 	/* NB : The gap is defined in terms of 32 bit words regardless of the machine */
 	IDATA addressOffset         = ((char*)(currentObject) - (char*)_CurrentObject) / 4;
-	int   addressOffsetSize     = numberSize(addressOffset);
+	int   addressOffsetSize     = gapSize(addressOffset);
 	int   addressOffsetEncoding = numberSizeEncoding(addressOffsetSize);
 
 	/* Iterate through the instance references counting them and noting the biggest offset */
@@ -2347,6 +3160,23 @@ BinaryHeapDumpWriter::numberSize(IDATA number)
 #endif
 }
 
+/**************************************************************************************************/
+/*                                                                                                */
+/* BinaryHeapDumpWriter::gapSize() method implementation                                          */
+/*                                                                                                */
+/**************************************************************************************************/
+int
+BinaryHeapDumpWriter::gapSize(IDATA addressOffset)
+{
+	/* The first record of a delta dump segment gets a full word gap so it can be re-based */
+	if (_WideGap) {
+		_WideGap = false;
+		return wordSize();
+	}
+
+	return numberSize(addressOffset);
+}
+
 /**************************************************************************************************/
 /*                                                                                                */
 /* BinaryHeapDumpWriter::numberSizeEncoding() method implementation                               */
@@ -2384,7 +3214,7 @@ void
 BinaryHeapDumpWriter::checkForIOError(void)
 {
 	PORT_ACCESS_FROM_PORT(_PortLibrary);
-	if (_OutputStream.hasError()) {
+	if (_OutputStream.hasError() || _DeltaStream.hasError()) {
 		j9nls_printf(PORTLIB, J9NLS_ERROR | J9NLS_STDERR, J9NLS_DMP_ERROR_IN_DUMP_STR, "Heap", j9error_last_error_message());
 		Trc_dump_reportDumpError_Event2("Heap", j9error_last_error_message());
 		_Error = true;
@@ -2452,6 +3282,31 @@ binaryHeapDumpRegionIteratorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor*
 	return ((BinaryHeapDumpWriter*)userData)->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
 }
 
+static jvmtiIterationControl
+binaryHeapDumpRegionCollectorCallback(J9JavaVM* vm, J9MM_IterateRegionDescriptor* regionDescription, void* userData)
+{
+	BinaryHeapDumpWriter::ParallelState* parallel = ((BinaryHeapDumpWriter*)userData)->_Parallel;
+
+	/* The first pass just counts the regions */
+	if (parallel->_Partitions != NULL) {
+		BinaryHeapDumpWriter::RegionPartition* partition = &parallel->_Partitions[parallel->_PartitionCount];
+
+		partition->_Region = *regionDescription;
+		partition->_DeferFirstObject = true;
+		partition->_Direct = (regionDescription->regionSize > BINARY_HEAPDUMP_MAXIMUM_PARTITION_SIZE);
+	}
+
+	parallel->_PartitionCount += 1;
+	return JVMTI_ITERATION_CONTINUE;
+}
+
+static int J9THREAD_PROC
+binaryHeapDumpHelperThread(void* userData)
+{
+	((BinaryHeapDumpWriter*)userData)->formatPartitions();
+	return 0;
+}
+
 static jvmtiIterationControl
 binaryHeapDumpObjectIteratorCallback(J9JavaVM* vm, J9MM_IterateObjectDescriptor* objectDescriptor, void* userData)
 {
@@ -2477,6 +3332,21 @@ binaryHeapDumpObjectReferenceIteratorWriterCallback(J9JavaVM* virtualMachine, J9
 	return referenceWriter->_HeapDumpWriter->_Error ? JVMTI_ITERATION_ABORT : JVMTI_ITERATION_CONTINUE;
 }
 
+/* Release the chunks remembered from the previous delta heap dump */
+extern "C" void
+freeHeapDumpDeltaBaseline(J9JavaVM *vm, RasDumpGlobalStorage *dumpGlobal)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if ((dumpGlobal != NULL) && (dumpGlobal->heapDumpDeltaBaseline != NULL)) {
+		HeapDumpDeltaBaseline* baseline = (HeapDumpDeltaBaseline*)dumpGlobal->heapDumpDeltaBaseline;
+
+		dumpGlobal->heapDumpDeltaBaseline = NULL;
+		hashTableFree(baseline->chunks);
+		j9mem_free_memory(baseline);
+	}
+}
+
 void
 writePHD(char *label, J9RASdumpContext *context, J9RASdumpAgent* agent)
 {
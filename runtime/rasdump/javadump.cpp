@@ -3178,6 +3178,11 @@ JavaCoreDumpWriter::writeSharedClassSectionAllLayersStatsHelper(J9SharedClassJav
 	);
 	_OutputStream.writeInteger(javacoreData->startupHintBytes, "%zu");
 
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTSCB            Startup class trace bytes                 = "
+	);
+	_OutputStream.writeInteger(javacoreData->startupClassTraceBytes, "%zu");
+
 	_OutputStream.writeCharacters(
 			"\n2SCLTEXTJCB            JCL data bytes                            = "
 	);
@@ -3254,6 +3259,11 @@ JavaCoreDumpWriter::writeSharedClassSectionAllLayersStatsHelper(J9SharedClassJav
 	);
 	_OutputStream.writeInteger(javacoreData->numStartupHints, "%zu");
 
+	_OutputStream.writeCharacters(
+			"\n2SCLTEXTNSC            Number Startup Class Traces               = "
+	);
+	_OutputStream.writeInteger(javacoreData->numStartupClassTraces, "%zu");
+
 	_OutputStream.writeCharacters(
 			"\n2SCLTEXTNJC            Number JCL Entries                        = "
 	);
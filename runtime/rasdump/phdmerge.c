@@ -0,0 +1,551 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * phdmerge rebuilds a complete portable heap dump from a baseline delta heap dump
+ * (-Xdump:heap:opts=PHD+DELTA) and the deltas written after it:
+ *
+ *     phdmerge <output.phd> <baseline> [<delta> ...]
+ *
+ * Each delta holds the PHD records of the heap chunks that changed since the previous
+ * one. For every chunk the latest segment wins; the segments are then written in address
+ * order, re-basing the first record of each against the last object of the one before and
+ * rotating the class cache indexes of its short records to match the cache it now follows.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "j9comp.h"
+#include "j9port.h"
+#include "libhlp.h"
+
+#define PHDMERGE_DELTA_IDENTIFIER "portable heap dump delta"
+#define PHDMERGE_DELTA_VERSION 1
+#define PHDMERGE_DELTA_BASELINE_FLAG 1
+#define PHDMERGE_DELTA_END 0
+#define PHDMERGE_DELTA_OBJECTS_SEGMENT 1
+#define PHDMERGE_DELTA_CLASSES_SEGMENT 2
+
+#define PHDMERGE_DUMP_END 3
+
+typedef struct PHDMergeInput {
+	const char *fileName;
+	IDATA fd;
+	U_64 generation;
+	U_32 flags;
+	U_8 *header;
+	U_32 headerLength;
+	I_64 classesSegment; /* offset of the classes segment, -1 if there isn't one */
+} PHDMergeInput;
+
+typedef struct PHDMergeSegment {
+	U_64 base;
+	UDATA input;
+	I_64 offset; /* offset of the segment tag in the input */
+	U_32 recordsLength;
+} PHDMergeSegment;
+
+typedef struct PHDMergeState {
+	J9PortLibrary *portLibrary;
+	IDATA output;
+	UDATA wordSize;
+	U_64 previousObject;
+	UDATA classCacheIndex;
+} PHDMergeState;
+
+static BOOLEAN readBytes(J9PortLibrary *portLibrary, PHDMergeInput *input, void *buffer, UDATA length);
+static BOOLEAN readNumber(J9PortLibrary *portLibrary, PHDMergeInput *input, UDATA length, U_64 *value);
+static BOOLEAN readInputHeader(J9PortLibrary *portLibrary, PHDMergeInput *input, UDATA *wordSize);
+static BOOLEAN scanInputSegments(J9PortLibrary *portLibrary, PHDMergeInput *input, UDATA inputIndex, UDATA wordSize, PHDMergeSegment **segments, UDATA *segmentCount, UDATA *segmentCapacity);
+static BOOLEAN copySegment(PHDMergeState *state, PHDMergeInput *input, I_64 offset);
+static BOOLEAN rebaseFirstRecord(U_8 *records, U_32 recordsLength, UDATA wordSize, U_64 previousObject);
+static U_64 decodeNumber(const U_8 *bytes, UDATA length);
+static void encodeNumber(U_8 *bytes, UDATA length, U_64 value);
+static int compareSegments(const void *left, const void *right);
+
+UDATA
+signalProtectedMain(struct J9PortLibrary *portLibrary, void *arg)
+{
+	struct j9cmdlineOptions *args = arg;
+	int argc = args->argc;
+	char **argv = args->argv;
+	PORT_ACCESS_FROM_PORT(args->portLibrary);
+	PHDMergeInput *inputs = NULL;
+	PHDMergeSegment *segments = NULL;
+	UDATA inputCount = 0;
+	UDATA segmentCount = 0;
+	UDATA segmentCapacity = 0;
+	UDATA wordSize = 0;
+	PHDMergeState state;
+	UDATA rc = 1;
+	UDATA i = 0;
+
+	memset(&state, 0, sizeof(state));
+	state.portLibrary = PORTLIB;
+	state.output = -1;
+
+	if (argc < 3) {
+		j9tty_err_printf(PORTLIB, "Usage: %s <output.phd> <baseline delta heap dump> [<delta heap dump> ...]\n", argv[0]);
+		j9tty_err_printf(PORTLIB, "  The deltas must be given in the order they were written.\n");
+		return 1;
+	}
+
+	inputCount = (UDATA)(argc - 2);
+	inputs = j9mem_allocate_memory(inputCount * sizeof(PHDMergeInput), OMRMEM_CATEGORY_VM);
+	if (NULL == inputs) {
+		j9tty_err_printf(PORTLIB, "phdmerge: out of memory\n");
+		return 1;
+	}
+	memset(inputs, 0, inputCount * sizeof(PHDMergeInput));
+	for (i = 0; i < inputCount; i++) {
+		inputs[i].fileName = argv[i + 2];
+		inputs[i].fd = -1;
+		inputs[i].classesSegment = -1;
+	}
+
+	/* Read the inputs' headers and check they form an unbroken chain from the baseline */
+	for (i = 0; i < inputCount; i++) {
+		PHDMergeInput *input = &inputs[i];
+
+		input->fd = j9file_open(input->fileName, EsOpenRead, 0);
+		if (-1 == input->fd) {
+			j9tty_err_printf(PORTLIB, "phdmerge: cannot open %s\n", input->fileName);
+			goto done;
+		}
+		if (!readInputHeader(PORTLIB, input, &wordSize)) {
+			goto done;
+		}
+		if (0 == i) {
+			if (0 == (input->flags & PHDMERGE_DELTA_BASELINE_FLAG)) {
+				j9tty_err_printf(PORTLIB, "phdmerge: %s is not a baseline delta heap dump\n", input->fileName);
+				goto done;
+			}
+		} else if (input->generation != (inputs[0].generation + i)) {
+			j9tty_err_printf(PORTLIB, "phdmerge: %s does not follow %s\n", input->fileName, inputs[i - 1].fileName);
+			goto done;
+		}
+		if (!scanInputSegments(PORTLIB, input, i, wordSize, &segments, &segmentCount, &segmentCapacity)) {
+			goto done;
+		}
+	}
+
+	if (-1 == inputs[inputCount - 1].classesSegment) {
+		j9tty_err_printf(PORTLIB, "phdmerge: %s is incomplete\n", inputs[inputCount - 1].fileName);
+		goto done;
+	}
+
+	/* The latest segment for each chunk is last among those with the same base */
+	if (0 != segmentCount) {
+		qsort(segments, segmentCount, sizeof(PHDMergeSegment), compareSegments);
+	}
+
+	state.output = j9file_open(argv[1], EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == state.output) {
+		j9tty_err_printf(PORTLIB, "phdmerge: cannot create %s\n", argv[1]);
+		goto done;
+	}
+	state.wordSize = wordSize;
+
+	/* The header describes the latest dump */
+	if ((IDATA)inputs[inputCount - 1].headerLength != j9file_write(state.output, inputs[inputCount - 1].header, inputs[inputCount - 1].headerLength)) {
+		j9tty_err_printf(PORTLIB, "phdmerge: cannot write %s\n", argv[1]);
+		goto done;
+	}
+
+	for (i = 0; i < segmentCount; i++) {
+		PHDMergeSegment *segment = &segments[i];
+
+		if (((i + 1) < segmentCount) && (segments[i + 1].base == segment->base)) {
+			/* Superseded by a later delta */
+			continue;
+		}
+		if (0 == segment->recordsLength) {
+			/* The chunk no longer holds any objects */
+			continue;
+		}
+		if (!copySegment(&state, &inputs[segment->input], segment->offset)) {
+			goto done;
+		}
+	}
+
+	/* The classes are written in full by every delta, so take the latest */
+	if (!copySegment(&state, &inputs[inputCount - 1], inputs[inputCount - 1].classesSegment)) {
+		goto done;
+	}
+
+	{
+		U_8 end = PHDMERGE_DUMP_END;
+		if (1 != j9file_write(state.output, &end, 1)) {
+			j9tty_err_printf(PORTLIB, "phdmerge: cannot write %s\n", argv[1]);
+			goto done;
+		}
+	}
+
+	j9tty_printf(PORTLIB, "phdmerge: wrote %s from %u delta heap dump(s)\n", argv[1], (U_32)inputCount);
+	rc = 0;
+
+done:
+	if (-1 != state.output) {
+		j9file_close(state.output);
+		if (0 != rc) {
+			j9file_unlink(argv[1]);
+		}
+	}
+	for (i = 0; i < inputCount; i++) {
+		if (-1 != inputs[i].fd) {
+			j9file_close(inputs[i].fd);
+		}
+		j9mem_free_memory(inputs[i].header);
+	}
+	j9mem_free_memory(inputs);
+	j9mem_free_memory(segments);
+
+	return rc;
+}
+
+static BOOLEAN
+readBytes(J9PortLibrary *portLibrary, PHDMergeInput *input, void *buffer, UDATA length)
+{
+	PORT_ACCESS_FROM_PORT(portLibrary);
+	U_8 *cursor = buffer;
+
+	while (0 != length) {
+		IDATA bytesRead = j9file_read(input->fd, cursor, (IDATA)length);
+		if (bytesRead <= 0) {
+			j9tty_err_printf(PORTLIB, "phdmerge: %s is truncated or unreadable\n", input->fileName);
+			return FALSE;
+		}
+		cursor += bytesRead;
+		length -= (UDATA)bytesRead;
+	}
+
+	return TRUE;
+}
+
+static BOOLEAN
+readNumber(J9PortLibrary *portLibrary, PHDMergeInput *input, UDATA length, U_64 *value)
+{
+	U_8 bytes[8];
+
+	if (!readBytes(portLibrary, input, bytes, length)) {
+		return FALSE;
+	}
+	*value = decodeNumber(bytes, length);
+
+	return TRUE;
+}
+
+static BOOLEAN
+readInputHeader(J9PortLibrary *portLibrary, PHDMergeInput *input, UDATA *wordSize)
+{
+	PORT_ACCESS_FROM_PORT(portLibrary);
+	char identifier[sizeof(PHDMERGE_DELTA_IDENTIFIER)];
+	U_64 value = 0;
+
+	/* Identifier */
+	if (!readNumber(PORTLIB, input, 2, &value)) {
+		return FALSE;
+	}
+	if ((value != (sizeof(identifier) - 1))
+		|| !readBytes(PORTLIB, input, identifier, sizeof(identifier) - 1)
+		|| (0 != memcmp(identifier, PHDMERGE_DELTA_IDENTIFIER, sizeof(identifier) - 1))
+	) {
+		j9tty_err_printf(PORTLIB, "phdmerge: %s is not a delta heap dump\n", input->fileName);
+		return FALSE;
+	}
+
+	/* Version */
+	if (!readNumber(PORTLIB, input, 4, &value)) {
+		return FALSE;
+	}
+	if (PHDMERGE_DELTA_VERSION != value) {
+		j9tty_err_printf(PORTLIB, "phdmerge: %s has unsupported version %u\n", input->fileName, (U_32)value);
+		return FALSE;
+	}
+
+	/* Word size, which must be the same for every input */
+	if (!readNumber(PORTLIB, input, 1, &value)) {
+		return FALSE;
+	}
+	if (((4 != value) && (8 != value)) || ((0 != *wordSize) && (*wordSize != (UDATA)value))) {
+		j9tty_err_printf(PORTLIB, "phdmerge: %s has an unexpected word size\n", input->fileName);
+		return FALSE;
+	}
+	*wordSize = (UDATA)value;
+
+	/* Generation and flags */
+	if (!readNumber(PORTLIB, input, 8, &input->generation)) {
+		return FALSE;
+	}
+	if (!readNumber(PORTLIB, input, 4, &value)) {
+		return FALSE;
+	}
+	input->flags = (U_32)value;
+
+	/* The PHD file header */
+	if (!readNumber(PORTLIB, input, 4, &value)) {
+		return FALSE;
+	}
+	input->headerLength = (U_32)value;
+	input->header = j9mem_allocate_memory(input->headerLength + 1, OMRMEM_CATEGORY_VM);
+	if (NULL == input->header) {
+		j9tty_err_printf(PORTLIB, "phdmerge: out of memory\n");
+		return FALSE;
+	}
+
+	return readBytes(PORTLIB, input, input->header, input->headerLength);
+}
+
+static BOOLEAN
+scanInputSegments(J9PortLibrary *portLibrary, PHDMergeInput *input, UDATA inputIndex, UDATA wordSize, PHDMergeSegment **segments, UDATA *segmentCount, UDATA *segmentCapacity)
+{
+	PORT_ACCESS_FROM_PORT(portLibrary);
+
+	for (;;) {
+		I_64 offset = j9file_seek(input->fd, 0, EsSeekCur);
+		U_64 tag = 0;
+		U_64 base = 0;
+		U_64 value = 0;
+
+		if (!readNumber(PORTLIB, input, 1, &tag)) {
+			return FALSE;
+		}
+		if (PHDMERGE_DELTA_END == tag) {
+			return TRUE;
+		}
+		if ((PHDMERGE_DELTA_OBJECTS_SEGMENT != tag) && (PHDMERGE_DELTA_CLASSES_SEGMENT != tag)) {
+			j9tty_err_printf(PORTLIB, "phdmerge: %s has an unknown segment at offset %lld\n", input->fileName, offset);
+			return FALSE;
+		}
+
+		/* Chunk base, last object and class cache index */
+		if (!readNumber(PORTLIB, input, wordSize, &base)
+			|| !readNumber(PORTLIB, input, wordSize, &value)
+			|| !readNumber(PORTLIB, input, 1, &value)
+		) {
+			return FALSE;
+		}
+
+		/* Skip the short record offsets and the records */
+		if (!readNumber(PORTLIB, input, 4, &value)) {
+			return FALSE;
+		}
+		if (-1 == j9file_seek(input->fd, (I_64)(value * 4), EsSeekCur)) {
+			return FALSE;
+		}
+		if (!readNumber(PORTLIB, input, 4, &value)) {
+			return FALSE;
+		}
+		if (-1 == j9file_seek(input->fd, (I_64)value, EsSeekCur)) {
+			return FALSE;
+		}
+
+		if (PHDMERGE_DELTA_CLASSES_SEGMENT == tag) {
+			input->classesSegment = offset;
+			continue;
+		}
+
+		if (*segmentCount == *segmentCapacity) {
+			UDATA capacity = (0 == *segmentCapacity) ? 1024 : (*segmentCapacity * 2);
+			PHDMergeSegment *grown = j9mem_reallocate_memory(*segments, capacity * sizeof(PHDMergeSegment), OMRMEM_CATEGORY_VM);
+			if (NULL == grown) {
+				j9tty_err_printf(PORTLIB, "phdmerge: out of memory\n");
+				return FALSE;
+			}
+			*segments = grown;
+			*segmentCapacity = capacity;
+		}
+		(*segments)[*segmentCount].base = base;
+		(*segments)[*segmentCount].input = inputIndex;
+		(*segments)[*segmentCount].offset = offset;
+		(*segments)[*segmentCount].recordsLength = (U_32)value;
+		*segmentCount += 1;
+	}
+}
+
+static BOOLEAN
+copySegment(PHDMergeState *state, PHDMergeInput *input, I_64 offset)
+{
+	PORT_ACCESS_FROM_PORT(state->portLibrary);
+	U_32 *shortRecords = NULL;
+	U_8 *records = NULL;
+	U_64 base = 0;
+	U_64 lastObject = 0;
+	U_64 classCacheIndex = 0;
+	U_64 shortRecordCount = 0;
+	U_64 recordsLength = 0;
+	BOOLEAN result = FALSE;
+	U_64 i = 0;
+
+	/* Skip the segment tag, the caller knows which kind of segment it is */
+	if ((offset + 1) != j9file_seek(input->fd, offset + 1, EsSeekSet)) {
+		j9tty_err_printf(PORTLIB, "phdmerge: cannot seek in %s\n", input->fileName);
+		return FALSE;
+	}
+
+	if (!readNumber(PORTLIB, input, state->wordSize, &base)
+		|| !readNumber(PORTLIB, input, state->wordSize, &lastObject)
+		|| !readNumber(PORTLIB, input, 1, &classCacheIndex)
+		|| !readNumber(PORTLIB, input, 4, &shortRecordCount)
+	) {
+		return FALSE;
+	}
+
+	if (0 != shortRecordCount) {
+		U_8 *bytes = NULL;
+
+		shortRecords = j9mem_allocate_memory((UDATA)shortRecordCount * sizeof(U_32), OMRMEM_CATEGORY_VM);
+		if (NULL == shortRecords) {
+			j9tty_err_printf(PORTLIB, "phdmerge: out of memory\n");
+			goto done;
+		}
+		bytes = (U_8 *)shortRecords;
+		if (!readBytes(PORTLIB, input, bytes, (UDATA)shortRecordCount * 4)) {
+			goto done;
+		}
+		for (i = 0; i < shortRecordCount; i++) {
+			shortRecords[i] = (U_32)decodeNumber(bytes + (i * 4), 4);
+		}
+	}
+
+	if (!readNumber(PORTLIB, input, 4, &recordsLength)) {
+		goto done;
+	}
+	if (0 == recordsLength) {
+		result = TRUE;
+		goto done;
+	}
+	records = j9mem_allocate_memory((UDATA)recordsLength, OMRMEM_CATEGORY_VM);
+	if (NULL == records) {
+		j9tty_err_printf(PORTLIB, "phdmerge: out of memory\n");
+		goto done;
+	}
+	if (!readBytes(PORTLIB, input, records, (UDATA)recordsLength)) {
+		goto done;
+	}
+
+	/* The first record's gap was written relative to address zero */
+	if (!rebaseFirstRecord(records, (U_32)recordsLength, state->wordSize, state->previousObject)) {
+		j9tty_err_printf(PORTLIB, "phdmerge: %s has an unexpected record at offset %lld\n", input->fileName, offset);
+		goto done;
+	}
+
+	/* The segment was formatted with an empty class cache, so shift its slots past the ones in use */
+	for (i = 0; i < shortRecordCount; i++) {
+		U_32 recordOffset = shortRecords[i];
+		if (recordOffset < recordsLength) {
+			U_8 flags = records[recordOffset];
+			UDATA slot = ((flags >> 5) + state->classCacheIndex) & 3;
+			records[recordOffset] = (U_8)((flags & ~0x60) | (slot << 5));
+		}
+	}
+
+	if ((IDATA)recordsLength != j9file_write(state->output, records, (IDATA)recordsLength)) {
+		j9tty_err_printf(PORTLIB, "phdmerge: cannot write the merged heap dump\n");
+		goto done;
+	}
+
+	state->previousObject = lastObject;
+	state->classCacheIndex = (state->classCacheIndex + (UDATA)classCacheIndex) & 3;
+	result = TRUE;
+
+done:
+	j9mem_free_memory(records);
+	j9mem_free_memory(shortRecords);
+	return result;
+}
+
+static BOOLEAN
+rebaseFirstRecord(U_8 *records, U_32 recordsLength, UDATA wordSize, U_64 previousObject)
+{
+	UDATA gapOffset = 0;
+	I_64 gap = 0;
+	U_8 tag = records[0];
+
+	if (0x20 == (tag & 0xE0)) {
+		/* Primitive array: tag, gap */
+		gapOffset = 1;
+	} else if ((0x04 == tag) || (0x06 == tag) || (0x07 == tag) || (0x08 == tag)) {
+		/* Long object, class, long primitive array or object array: tag, flags, gap */
+		gapOffset = 2;
+	} else {
+		return FALSE;
+	}
+	if ((gapOffset + wordSize) > recordsLength) {
+		return FALSE;
+	}
+
+	/* The gap is in 32 bit words regardless of the word size */
+	gap = (I_64)decodeNumber(records + gapOffset, wordSize);
+	if (4 == wordSize) {
+		gap = (I_32)gap;
+	}
+	gap -= (I_64)(previousObject / 4);
+	encodeNumber(records + gapOffset, wordSize, (U_64)gap);
+
+	return TRUE;
+}
+
+static U_64
+decodeNumber(const U_8 *bytes, UDATA length)
+{
+	U_64 value = 0;
+	UDATA i = 0;
+
+	/* Big endian, as written by FileStream */
+	for (i = 0; i < length; i++) {
+		value = (value << 8) | bytes[i];
+	}
+
+	return value;
+}
+
+static void
+encodeNumber(U_8 *bytes, UDATA length, U_64 value)
+{
+	UDATA i = length;
+
+	while (0 != i) {
+		i -= 1;
+		bytes[i] = (U_8)value;
+		value >>= 8;
+	}
+}
+
+static int
+compareSegments(const void *left, const void *right)
+{
+	const PHDMergeSegment *leftSegment = left;
+	const PHDMergeSegment *rightSegment = right;
+
+	if (leftSegment->base != rightSegment->base) {
+		return (leftSegment->base < rightSegment->base) ? -1 : 1;
+	}
+	if (leftSegment->input != rightSegment->input) {
+		return (leftSegment->input < rightSegment->input) ? -1 : 1;
+	}
+	if (leftSegment->offset != rightSegment->offset) {
+		return (leftSegment->offset < rightSegment->offset) ? -1 : 1;
+	}
+	return 0;
+}
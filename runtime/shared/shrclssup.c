@@ -154,6 +154,18 @@ IDATA J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 				if (argIndex2 > argIndex1) {
 					runtimeFlags &= (~J9SHR_RUNTIMEFLAG_ENABLE_SHAREUNSAFECLASSES);
 				}
+
+				/* Check for -XX:+ShareClassesUseHugePages and -XX:+ShareClassesNUMAInterleave, and their - forms; whichever comes later wins. Both are disabled by default. */
+				argIndex1 = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXSHARECLASSESUSEHUGEPAGES, NULL);
+				argIndex2 = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOSHARECLASSESUSEHUGEPAGES, NULL);
+				if (argIndex1 > argIndex2) {
+					vm->sharedCacheAPI->mappingFlags |= J9SHR_MAPPINGFLAG_HUGEPAGES;
+				}
+				argIndex1 = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXSHARECLASSESNUMAINTERLEAVE, NULL);
+				argIndex2 = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXNOSHARECLASSESNUMAINTERLEAVE, NULL);
+				if (argIndex1 > argIndex2) {
+					vm->sharedCacheAPI->mappingFlags |= J9SHR_MAPPINGFLAG_NUMA_INTERLEAVE;
+				}
 								
 				vm->sharedCacheAPI->parseResult = parseArgs(vm, optionsBufferPtr, &runtimeFlags, &verboseFlags, &cacheName, &modContext,
 								&expireTime, &ctrlDirName, &cacheDirPermStr, &methodSpecs, &printStatsOptions, &storageKeyTesting);
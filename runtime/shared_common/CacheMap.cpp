@@ -63,6 +63,7 @@ extern "C" {
 
 static char* formatAttachedDataString(J9VMThread* currentThread, U_8 *attachedData, UDATA attachedDataLength, char *attachedDataStringBuffer, UDATA bufferLength);
 static void checkROMClassUTF8SRPs(J9ROMClass *romClass);
+static bool lookupIndexNeedsRebuild(const LookupIndexHeader* index, UDATA itemCount);
 /* If you make this sleep a lot longer, it almost eliminates store contention
  * because the VMs get out of step with each other, but you delay excessively */
 #define WRITE_HASH_WAIT_MAX_MICROS 80000
@@ -85,6 +86,11 @@ static void checkROMClassUTF8SRPs(J9ROMClass *romClass);
 
 #define MAX_INT 0x7fffffff
 
+/* Don't build a lookup index for caches with fewer items than this */
+#define LOOKUPINDEX_MIN_ITEMS 1024
+/* Rebuild the lookup index when the items it doesn't cover reach this fraction of those it does */
+#define LOOKUPINDEX_REBUILD_DIVISOR 4
+
 #define FIND_ATTACHED_DATA_RETRY_COUNT 1
 #define FIND_ATTACHED_DATA_CORRUPT_WAIT_TIME 1
 
@@ -661,6 +667,37 @@ error:
 		}
 	}
 
+	/* With more than one layer to read, the layers are read together and the hashtables populated on startup helper threads */
+	IDATA layerResults[J9SH_LAYER_NUM_MAX_VALUE + 1];
+	UDATA layerIndex = 0;
+	bool readLayersInParallel = (ccToUse == _ccTail) && (_ccTail != _ccHead) && (UnitTest::LAYERED_CACHE_SERIAL_READ_TEST != UnitTest::unitTest);
+
+	if (readLayersInParallel) {
+		SH_CompositeCacheImpl* lastEntered = NULL;
+		bool hasAllWriteMutexes = true;
+
+		memset(layerResults, 0, sizeof(layerResults));
+		/* THREADING: We want the mutex of every layer here, for the same reason as when reading a single layer below */
+		for (SH_CompositeCacheImpl* cc = _ccTail; NULL != cc; cc = cc->getPrevious()) {
+			if (cc->enterWriteMutex(currentThread, false, fnName) != 0) {
+				hasAllWriteMutexes = false;
+				break;
+			}
+			lastEntered = cc;
+		}
+		if (hasAllWriteMutexes) {
+			readCacheLayersInParallel(currentThread, layerResults);
+		}
+		for (SH_CompositeCacheImpl* cc = lastEntered; NULL != cc; cc = cc->getNext()) {
+			cc->exitWriteMutex(currentThread, fnName);
+		}
+		if (!hasAllWriteMutexes) {
+			CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_FAILED_ENTER_WRITE_MUTEX_STARTUP);
+			Trc_SHR_CM_startup_Exit7(currentThread);
+			return -1;
+		}
+	}
+
 	do {
 		if (ccToUse == _ccHead) {
 			runtimeFlags = _runtimeFlags;
@@ -672,7 +709,11 @@ error:
 
 		if (ccToUse->enterWriteMutex(currentThread, false, fnName) == 0) {
 			/* populate the hashtables */
-			itemsRead = readCache(currentThread, ccToUse, -1, false);
+			if (readLayersInParallel) {
+				itemsRead = layerResults[layerIndex];
+			} else {
+				itemsRead = readCache(currentThread, ccToUse, -1, false);
+			}
 			ccToUse->protectPartiallyFilledPages(currentThread);
 			/* Two reasons for moving the code to check for full cache from SH_CompositeCacheImpl::startup()
 			 * to SH_CacheMap::startup():
@@ -715,6 +756,7 @@ error:
 				ccToUse->markReadOnlyCacheFull();
 			}
 			ccToUse = ccToUse->getPrevious();
+			layerIndex += 1;
 		}
 	} while (NULL != ccToUse && CC_STARTUP_OK == rc);
 
@@ -1160,6 +1202,19 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 
 	Trc_SHR_CM_readCache_Entry(currentThread, expectedUpdates);
 
+	if ((-1 == expectedUpdates) && !startupForStats) {
+		/* Items covered by a lookup index are stored when first looked up, and items added after it are read below */
+		result = readLookupIndex(currentThread, cache);
+		if ((CM_READ_CACHE_FAILED == result) || (CM_CACHE_CORRUPT == result)) {
+			if (CM_CACHE_CORRUPT == result) {
+				reportCorruptCache(currentThread, cache);
+			}
+			cache->doneReadUpdates(currentThread, 0);
+			Trc_SHR_CM_readCache_Exit(currentThread, expectedUpdates, result);
+			return result;
+		}
+	}
+
 	/* For each cached item, find a suitable manager and store it */
 	do {
 		it = (ShcItem*)cache->nextEntry(currentThread, NULL);		/* IMPORTANT: Do not skip stale entries (can end up with lone orphans) */
@@ -1220,6 +1275,648 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 	return result;
 }
 
+/**
+ * Reads all the layers of a multi-layer cache at startup. The layers are walked on the current thread, then the items
+ * found are stored in the manager hashtables by up to CM_STARTUP_HELPER_THREADS_MAX threads. Each thread stores the items
+ * of the managers assigned to it, lowest layer first, so every manager is given its items in the order readCache()
+ * would give them. The current thread stores the items of the first share of the managers, and returns once all the
+ * items are stored, so that no class is loaded before the hashtables are complete.
+ *
+ * THREADING: The current thread must hold the write mutex of every layer. Startup helper threads store items on its
+ * behalf, and only touch the hashtables of the managers assigned to them.
+ *
+ * @param[in] currentThread The current thread
+ * @param[out] layerResults For each layer, lowest first, the number of items read, or
+ * 			CM_READ_CACHE_FAILED or CM_CACHE_CORRUPT if the layer could not be read
+ *
+ * @return	0 on success, or CM_READ_CACHE_FAILED or CM_CACHE_CORRUPT if a layer could not be read
+ */
+IDATA
+SH_CacheMap::readCacheLayersInParallel(J9VMThread* currentThread, IDATA* layerResults)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+	StartupScan scan;
+	SH_Manager* managerList[NUM_MANAGERS];
+	UDATA managersUsed = 0;
+	UDATA helperCount = 0;
+	SH_CompositeCacheImpl* cache = NULL;
+	I_64 startTime = 0;
+	IDATA result = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	memset(&scan, 0, sizeof(scan));
+	scan.cacheMap = this;
+	scan.vm = vm;
+	for (cache = _ccTail; NULL != cache; cache = cache->getPrevious()) {
+		scan.layerCount += 1;
+	}
+
+	Trc_SHR_CM_readCacheLayersInParallel_Entry(currentThread, scan.layerCount);
+
+	scan.layers = (StartupScanLayer*)j9mem_allocate_memory(scan.layerCount * sizeof(StartupScanLayer), J9MEM_CATEGORY_CLASSES);
+	if (NULL == scan.layers) {
+		CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_MEMORY_ALLOC_FAILED, scan.layerCount * sizeof(StartupScanLayer));
+		Trc_SHR_CM_readCacheLayersInParallel_Exit(currentThread, CM_READ_CACHE_FAILED);
+		return CM_READ_CACHE_FAILED;
+	}
+	memset(scan.layers, 0, scan.layerCount * sizeof(StartupScanLayer));
+
+	startTime = j9time_hires_clock();
+
+	/* Walk the layers, lowest first. The managers of the items found are started as they are seen. */
+	cache = _ccTail;
+	for (UDATA i = 0; i < scan.layerCount; i++) {
+		scan.layers[i].cache = cache;
+		scan.layers[i].result = scanLayerForStartup(currentThread, &scan.layers[i]);
+		if (scan.layers[i].result < 0) {
+			result = scan.layers[i].result;
+			break;
+		}
+		cache = cache->getPrevious();
+	}
+
+	/* Share the started managers between the helpers */
+	helperCount = OMR_MIN((UDATA)CM_STARTUP_HELPER_THREADS_MAX, j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_TARGET));
+	if (0 == helperCount) {
+		helperCount = 1;
+	}
+	for (UDATA type = TYPE_UNINITIALIZED + 1; type <= MAX_DATA_TYPES; type++) {
+		SH_Manager* manager = managers()->getManagerForDataType(type);
+		UDATA m = 0;
+
+		if ((NULL == manager) || (MANAGER_STATE_STARTED != manager->getState())) {
+			continue;
+		}
+		while ((m < managersUsed) && (managerList[m] != manager)) {
+			m += 1;
+		}
+		if (m == managersUsed) {
+			managerList[managersUsed++] = manager;
+		}
+		scan.helpers[m % helperCount].storeTypes[type] = true;
+	}
+	scan.helperCount = OMR_MAX(1, OMR_MIN(helperCount, managersUsed));
+	for (UDATA i = 0; i < scan.helperCount; i++) {
+		scan.helpers[i].scan = &scan;
+		scan.helpers[i].helperID = i;
+		scan.helpers[i].failedLayer = -1;
+	}
+
+	if ((0 == result) && (1 < scan.helperCount) && (0 == omrthread_monitor_init(&scan.monitor, 0))) {
+		omrthread_monitor_enter(scan.monitor);
+		for (UDATA i = 1; i < scan.helperCount; i++) {
+			omrthread_t helperOSThread = NULL;
+
+			if (0 == vm->internalVMFunctions->createThreadWithCategory(&helperOSThread, vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, FALSE,
+					startupHelperThreadMain, &scan.helpers[i], J9THREAD_CATEGORY_SYSTEM_THREAD)
+			) {
+				scan.helpersRunning += 1;
+			} else {
+				Trc_SHR_CM_readCacheLayersInParallel_HelperNotStarted(currentThread, i);
+			}
+		}
+		omrthread_monitor_exit(scan.monitor);
+	}
+
+	if (0 == result) {
+		storeStartupItems(currentThread, &scan, &scan.helpers[0]);
+		scan.helpers[0].done = true;
+	}
+
+	/* Wait for the helpers before any class is loaded */
+	if (NULL != scan.monitor) {
+		omrthread_monitor_enter(scan.monitor);
+		while (0 < scan.helpersRunning) {
+			omrthread_monitor_wait(scan.monitor);
+		}
+		omrthread_monitor_exit(scan.monitor);
+		omrthread_monitor_destroy(scan.monitor);
+	}
+
+	if (0 == result) {
+		/* Store the items of any helper that could not run */
+		for (UDATA i = 1; i < scan.helperCount; i++) {
+			if (!scan.helpers[i].done) {
+				storeStartupItems(currentThread, &scan, &scan.helpers[i]);
+			}
+		}
+		for (UDATA i = 0; i < scan.helperCount; i++) {
+			if (-1 != scan.helpers[i].failedLayer) {
+				scan.layers[scan.helpers[i].failedLayer].result = CM_READ_CACHE_FAILED;
+				result = CM_READ_CACHE_FAILED;
+			}
+		}
+	}
+
+	for (UDATA i = 0; i < scan.layerCount; i++) {
+		StartupScanLayer* layer = &scan.layers[i];
+		U_64 storeMicros = 0;
+
+		if (NULL == layer->cache) {
+			break;
+		}
+		/* No items are stored for any layer once one has failed, so none of them has read anything */
+		if ((result < 0) && (0 <= layer->result)) {
+			layer->result = result;
+		}
+		layerResults[i] = layer->result;
+		layer->cache->doneReadUpdates(currentThread, layer->result);
+		if (0 <= layer->result) {
+			for (UDATA h = 0; h < scan.helperCount; h++) {
+				storeMicros = OMR_MAX(storeMicros, layer->storeMicros[h]);
+			}
+			CACHEMAP_TRACE4(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_STARTUP_LAYER_READ_TIME, layer->cache->getLayer(), layer->result, layer->readMicros, storeMicros);
+		}
+		if (NULL != layer->items) {
+			j9mem_free_memory((void*)layer->items);
+		}
+	}
+	if (0 == result) {
+		CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_STARTUP_LAYERS_READ_TIME, scan.layerCount, scan.helperCount,
+				j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+	}
+	j9mem_free_memory(scan.layers);
+
+	Trc_SHR_CM_readCacheLayersInParallel_Exit(currentThread, result);
+	return result;
+}
+
+/**
+ * Walks the items of a cache layer at startup, as readCache() does, and records the items found in the layer
+ * so they can be stored by storeStartupItems().
+ *
+ * THREADING: The current thread must hold the cache write mutex
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] layer The layer to walk
+ *
+ * @return	number of items read, or
+ * 			CM_READ_CACHE_FAILED if the call fails for some reason, or
+ * 			CM_CACHE_CORRUPT if cache is corrupt
+ */
+IDATA
+SH_CacheMap::scanLayerForStartup(J9VMThread* currentThread, StartupScanLayer* layer)
+{
+	SH_CompositeCacheImpl* cache = layer->cache;
+	UDATA capacity = cache->checkUpdates(currentThread) + 1;
+	ShcItem* it = NULL;
+	SH_Manager* manager = NULL;
+	I_64 startTime = 0;
+	IDATA result = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	startTime = j9time_hires_clock();
+
+	result = useLookupIndex(currentThread, cache, &layer->index);
+	if (CM_CACHE_CORRUPT == result) {
+		reportCorruptCache(currentThread, cache);
+		return result;
+	}
+
+	layer->items = (const ShcItem**)j9mem_allocate_memory(capacity * sizeof(ShcItem*), J9MEM_CATEGORY_CLASSES);
+	if (NULL == layer->items) {
+		CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_MEMORY_ALLOC_FAILED, capacity * sizeof(ShcItem*));
+		return CM_READ_CACHE_FAILED;
+	}
+
+	while (NULL != (it = (ShcItem*)cache->nextEntry(currentThread, NULL))) {		/* IMPORTANT: Do not skip stale entries (can end up with lone orphans) */
+		UDATA itemType = ITEMTYPE(it);
+		IDATA rc = 0;
+
+		if ((itemType <= TYPE_UNINITIALIZED) || (itemType > MAX_DATA_TYPES)) {
+			CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_READ_CORRUPT_DATA, it);
+			cache->setCorruptCache(currentThread, ITEM_TYPE_CORRUPT, (UDATA)it);
+			Trc_SHR_CM_readCache_Exit1(currentThread, it);
+			result = CM_CACHE_CORRUPT;
+			break;
+		}
+
+		rc = getAndStartManagerForType(currentThread, itemType, &manager);
+		if (rc == -1) {
+			/* Manager failed to start - ignore */
+			Trc_SHR_CM_readCache_EventFailedStore(currentThread, it);
+		} else if ((rc > 0) && ((UDATA)rc == itemType)) {
+			if (layer->itemCount == capacity) {
+				const ShcItem** newItems = (const ShcItem**)j9mem_allocate_memory(2 * capacity * sizeof(ShcItem*), J9MEM_CATEGORY_CLASSES);
+
+				if (NULL == newItems) {
+					CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_MEMORY_ALLOC_FAILED, 2 * capacity * sizeof(ShcItem*));
+					result = CM_READ_CACHE_FAILED;
+					break;
+				}
+				memcpy((void*)newItems, layer->items, capacity * sizeof(ShcItem*));
+				j9mem_free_memory((void*)layer->items);
+				layer->items = newItems;
+				capacity *= 2;
+			}
+			layer->items[layer->itemCount++] = it;
+		} else {
+			/* We found a manager, but for the wrong data type */
+			Trc_SHR_Assert_ShouldNeverHappen();
+			result = CM_READ_CACHE_FAILED;
+			break;
+		}
+		++result;
+	}
+
+	if (cache->isCacheCorrupt()) {
+		reportCorruptCache(currentThread, cache);
+		if (NULL == it) {
+			/* This happens when nextEntry() finds cache to be corrupt and return NULL */
+			result = CM_CACHE_CORRUPT;
+		}
+	}
+
+	layer->readMicros = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	return result;
+}
+
+/**
+ * Stores the items read from the cache layers, lowest layer first, in the hashtables of the managers assigned to a helper.
+ *
+ * THREADING: Called by the thread reading the cache layers, which holds the write mutex of every layer, or by a startup
+ * helper thread on its behalf. Each manager is assigned to a single helper.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] scan The startup scan
+ * @param[in] helper The helper whose managers are given the items
+ *
+ * @return	0 on success, or CM_READ_CACHE_FAILED if an item could not be stored
+ */
+IDATA
+SH_CacheMap::storeStartupItems(J9VMThread* currentThread, StartupScan* scan, StartupScanHelper* helper)
+{
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	for (UDATA i = 0; i < scan->layerCount; i++) {
+		StartupScanLayer* layer = &scan->layers[i];
+		I_64 startTime = j9time_hires_clock();
+
+		if ((NULL != layer->index) && (0 != storeIndexedItems(currentThread, layer->cache, layer->index, helper->storeTypes))) {
+			helper->failedLayer = (IDATA)i;
+			return CM_READ_CACHE_FAILED;
+		}
+		for (UDATA j = 0; j < layer->itemCount; j++) {
+			const ShcItem* it = layer->items[j];
+			UDATA itemType = ITEMTYPE(it);
+
+			if (helper->storeTypes[itemType]
+				&& !managers()->getManagerForDataType(itemType)->storeNew(currentThread, it, layer->cache)
+			) {
+				CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_HASHTABLE_ADD_FAILURE);
+				Trc_SHR_CM_readCache_Exit2(currentThread);
+				helper->failedLayer = (IDATA)i;
+				return CM_READ_CACHE_FAILED;
+			}
+		}
+		layer->storeMicros[helper->helperID] = j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	}
+	return 0;
+}
+
+/**
+ * Entry point of a startup helper thread. Attaches to the VM, stores the items of the managers assigned to the helper,
+ * and notifies the thread reading the cache layers when done. If the thread cannot attach, the items are stored by the
+ * thread reading the cache layers.
+ *
+ * @param[in] arg The StartupScanHelper for the thread
+ *
+ * @return 0
+ */
+int J9THREAD_PROC
+SH_CacheMap::startupHelperThreadMain(void* arg)
+{
+	StartupScanHelper* helper = (StartupScanHelper*)arg;
+	StartupScan* scan = helper->scan;
+	J9JavaVM* vm = scan->vm;
+	J9VMThread* helperThread = NULL;
+
+	/* The cache is read before bootstrap, so the helper is attached without a java.lang.Thread */
+	if (JNI_OK == vm->internalVMFunctions->internalAttachCurrentThread(vm, &helperThread, NULL,
+			J9_PRIVATE_FLAGS_DAEMON_THREAD | J9_PRIVATE_FLAGS_NO_OBJECT | J9_PRIVATE_FLAGS_SYSTEM_THREAD | J9_PRIVATE_FLAGS_ATTACHED_THREAD,
+			omrthread_self())
+	) {
+		scan->cacheMap->storeStartupItems(helperThread, scan, helper);
+		helper->done = true;
+		vm->internalVMFunctions->DetachCurrentThread((JavaVM*)vm);
+	}
+
+	omrthread_monitor_enter(scan->monitor);
+	scan->helpersRunning -= 1;
+	omrthread_monitor_notify_all(scan->monitor);
+	omrthread_monitor_exit(scan->monitor);
+	return 0;
+}
+
+/**
+ * Registers the lookup index of a cache with the managers whose items it keys, replays the other items it covers,
+ * and moves the cache past the items covered.
+ *
+ * THREADING: MUST be single-threaded - protected by refreshMutex or cache write mutex
+ *
+ * @return	number of items covered by the index, 0 if there is no index to use, or
+ * 			CM_READ_CACHE_FAILED if the call fails for some reason, or
+ * 			CM_CACHE_CORRUPT if cache is corrupt
+ */
+IDATA
+SH_CacheMap::readLookupIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache)
+{
+	const LookupIndexHeader* index = NULL;
+	IDATA result = useLookupIndex(currentThread, cache, &index);
+
+	if ((result > 0) && (0 != storeIndexedItems(currentThread, cache, index, NULL))) {
+		result = CM_READ_CACHE_FAILED;
+	}
+	return result;
+}
+
+/**
+ * Checks the lookup index of a cache, starts the managers of the items it covers, and moves the cache
+ * past the items covered. The items are stored by storeIndexedItems().
+ *
+ * THREADING: MUST be single-threaded - protected by refreshMutex or cache write mutex
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cache The cache to read
+ * @param[out] indexToUse The lookup index, or NULL if there is no index to use
+ *
+ * @return	number of items covered by the index, 0 if there is no index to use, or
+ * 			CM_CACHE_CORRUPT if cache is corrupt
+ */
+IDATA
+SH_CacheMap::useLookupIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, const LookupIndexHeader** indexToUse)
+{
+	const LookupIndexHeader* index = cache->getLookupIndex(currentThread);
+	SH_Manager* manager = NULL;
+	const U_32* replay = NULL;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	*indexToUse = NULL;
+	if ((NULL == index) || (UnitTest::LOOKUP_INDEX_UNUSED_TEST == UnitTest::unitTest)) {
+		return 0;
+	}
+	if ((0 != index->keyedCount) && (TYPE_ROMCLASS != getAndStartManagerForType(currentThread, TYPE_ROMCLASS, &manager))) {
+		return 0;
+	}
+
+	replay = LIREPLAY(index);
+	for (U_32 i = 0; i < index->replayCount; i++) {
+		const ShcItem* it = cache->getItemFromLookupIndexOffset(replay[i]);
+		UDATA itemType = (NULL == it) ? TYPE_UNINITIALIZED : ITEMTYPE(it);
+
+		if ((itemType <= TYPE_UNINITIALIZED) || (itemType > MAX_DATA_TYPES)) {
+			CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_READ_CORRUPT_DATA, it);
+			cache->setCorruptCache(currentThread, ITEM_TYPE_CORRUPT, (UDATA)it);
+			Trc_SHR_CM_readCache_Exit1(currentThread, it);
+			return CM_CACHE_CORRUPT;
+		}
+		getAndStartManagerForType(currentThread, itemType, &manager);
+	}
+
+	if (!cache->skipIndexedEntries(currentThread, index)) {
+		return 0;
+	}
+	Trc_SHR_CM_readLookupIndex_Event(currentThread, index, index->keyedCount, index->replayCount);
+
+	*indexToUse = index;
+	return index->itemCount;
+}
+
+/**
+ * Registers a lookup index returned by useLookupIndex() with the ROMClass manager and replays the other items it covers.
+ *
+ * THREADING: Protected by refreshMutex or cache write mutex. When reading the cache layers in parallel at startup, a startup
+ * helper thread stores the items of the managers assigned to it on behalf of the thread holding the cache write mutex.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cache The cache containing the index
+ * @param[in] index The lookup index
+ * @param[in] storeTypes The item types to store, indexed by type, or NULL to store all items
+ *
+ * @return	0 on success, or CM_READ_CACHE_FAILED if the call fails for some reason
+ */
+IDATA
+SH_CacheMap::storeIndexedItems(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, const LookupIndexHeader* index, const bool* storeTypes)
+{
+	SH_Manager* manager = NULL;
+	const U_32* replay = LIREPLAY(index);
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if ((0 != index->keyedCount) && ((NULL == storeTypes) || storeTypes[TYPE_ROMCLASS])) {
+		manager = managers()->getManagerForDataType(TYPE_ROMCLASS);
+		if (0 != manager->addLookupIndex(currentThread, index, cache)) {
+			CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_HASHTABLE_ADD_FAILURE);
+			Trc_SHR_CM_readLookupIndex_Failed(currentThread, index);
+			return CM_READ_CACHE_FAILED;
+		}
+	}
+
+	for (U_32 i = 0; i < index->replayCount; i++) {
+		const ShcItem* it = cache->getItemFromLookupIndexOffset(replay[i]);
+		UDATA itemType = ITEMTYPE(it);
+		IDATA rc = 0;
+
+		if ((NULL != storeTypes) && !storeTypes[itemType]) {
+			continue;
+		}
+		rc = getAndStartManagerForType(currentThread, itemType, &manager);
+		if (rc == -1) {
+			/* Manager failed to start - ignore */
+			Trc_SHR_CM_readCache_EventFailedStore(currentThread, it);
+		} else if ((rc > 0) && ((UDATA)rc == itemType)) {
+			if (!manager->storeNew(currentThread, it, cache)) {
+				CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_HASHTABLE_ADD_FAILURE);
+				Trc_SHR_CM_readCache_Exit2(currentThread);
+				return CM_READ_CACHE_FAILED;
+			}
+		} else {
+			/* We found a manager, but for the wrong data type */
+			Trc_SHR_Assert_ShouldNeverHappen();
+			return CM_READ_CACHE_FAILED;
+		}
+	}
+	return 0;
+}
+
+/**
+ * Decides whether a cache with the given number of items needs a new lookup index.
+ *
+ * @param [in] index  The current lookup index, or NULL if there isn't one
+ * @param [in] itemCount  The number of items in the cache, or an upper bound on it
+ *
+ * @return true if there are enough items not covered by the index to build a new one
+ */
+static bool
+lookupIndexNeedsRebuild(const LookupIndexHeader* index, UDATA itemCount)
+{
+	if (NULL == index) {
+		return itemCount >= LOOKUPINDEX_MIN_ITEMS;
+	}
+	return (itemCount > index->itemCount) && ((itemCount - index->itemCount) >= (index->itemCount / LOOKUPINDEX_REBUILD_DIVISOR));
+}
+
+/**
+ * Writes a lookup index covering the items in the top layer cache, if the cache has enough items that
+ * are not covered by its current index. Later JVMs use the index to start without walking those items.
+ *
+ * The index it replaces is marked stale, but its bytes stay in the cache, which only grows. A new index is
+ * only written once the cache has 1/LOOKUPINDEX_REBUILD_DIVISOR more items than the old one covers, so the
+ * sizes of the stale indexes shrink geometrically. Together they take roughly LOOKUPINDEX_REBUILD_DIVISOR
+ * times the space of the current index.
+ *
+ * THREADING: Should only be called on JVM exit. Gets the cache write mutex.
+ */
+void
+SH_CacheMap::buildLookupIndex(J9VMThread* currentThread)
+{
+	const char* fnName = "buildLookupIndex";
+	const LookupIndexHeader* oldIndex = NULL;
+	ShcItemHdr* ih = NULL;
+	ShcItemHdr* first = NULL;
+	ShcItemHdr* last = NULL;
+	U_32 itemCount = 0;
+	U_32 keyedCount = 0;
+	U_32 bucketCount = 1;
+	SH_ByteDataManager* localBDM = NULL;
+	LookupIndexHeader* newIndex = NULL;
+	LookupIndexEntry* unsortedEntries = NULL;
+	J9SharedDataDescriptor data;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if ((NULL == _ccHead) || !_ccHead->isStarted() || _ccHead->isRunningReadOnly() || _ccHead->isCacheCorrupt()
+		|| J9_ARE_ANY_BITS_SET(*_runtimeFlags, RUNTIME_FLAGS_PREVENT_BLOCK_DATA_UPDATE | J9SHR_RUNTIMEFLAG_ENABLE_STATS)
+	) {
+		return;
+	}
+	if (!(localBDM = getByteDataManager(currentThread))) {
+		return;
+	}
+	/* The update count is at least the number of items, so if it doesn't call for a new index neither will the
+	 * item walk. Check it before taking the cache lock, which otherwise every JVM would do on exit. */
+	if (!lookupIndexNeedsRebuild(_ccHead->getLookupIndex(currentThread), _ccHead->getUpdateCount())) {
+		return;
+	}
+	if (_ccHead->enterWriteMutex(currentThread, false, fnName) != 0) {
+		return;
+	}
+	if (runEntryPointChecks(currentThread, NULL, NULL) == -1) {
+		goto _done;
+	}
+
+	/* The item naming the prerequisite cache of a layer is read before the others, so is not covered */
+	first = _ccHead->nextItemHeader(currentThread, NULL);
+	if ((NULL != first) && (TYPE_PREREQ_CACHE == ITEMTYPE((ShcItem*)CCITEM(first)))) {
+		first = _ccHead->nextItemHeader(currentThread, first);
+	}
+	for (ih = first; NULL != ih; ih = _ccHead->nextItemHeader(currentThread, ih)) {
+		SH_Manager* manager = managers()->getManagerForDataType(ITEMTYPE((ShcItem*)CCITEM(ih)));
+		const U_8* key = NULL;
+		U_16 keySize = 0;
+
+		if (NULL == manager) {
+			/* Leave caches containing items we don't understand to be walked */
+			goto _done;
+		}
+		if ((manager == (SH_Manager*)_rcm) && manager->getLookupKey((ShcItem*)CCITEM(ih), &key, &keySize)) {
+			keyedCount += 1;
+		}
+		itemCount += 1;
+		last = ih;
+	}
+
+	oldIndex = _ccHead->getLookupIndex(currentThread);
+	if (!lookupIndexNeedsRebuild(oldIndex, itemCount)) {
+		goto _done;
+	}
+
+	while (bucketCount < keyedCount) {
+		bucketCount <<= 1;
+	}
+	data.length = LILEN(bucketCount, keyedCount, itemCount - keyedCount);
+	newIndex = (LookupIndexHeader*)j9mem_allocate_memory(data.length, J9MEM_CATEGORY_CLASSES);
+	unsortedEntries = (LookupIndexEntry*)j9mem_allocate_memory((keyedCount + 1) * sizeof(LookupIndexEntry), J9MEM_CATEGORY_CLASSES);
+	if ((NULL == newIndex) || (NULL == unsortedEntries)) {
+		Trc_SHR_CM_buildLookupIndex_Failed(currentThread, itemCount);
+		goto _done;
+	}
+
+	newIndex->eyecatcher = LOOKUPINDEX_EYECATCHER;
+	newIndex->version = LOOKUPINDEX_VERSION;
+	newIndex->itemCount = itemCount;
+	newIndex->startOffset = _ccHead->getLookupIndexOffset(first);
+	newIndex->scanOffset = _ccHead->getLookupIndexOffset(CCITEMNEXT(last));
+	newIndex->bucketCount = bucketCount;
+	newIndex->keyedCount = keyedCount;
+	newIndex->replayCount = itemCount - keyedCount;
+	memset(LIBUCKETS(newIndex), 0, (bucketCount + 1) * sizeof(U_32));
+
+	{
+		U_32* buckets = LIBUCKETS(newIndex);
+		LookupIndexEntry* entries = LIENTRIES(newIndex);
+		U_32* replay = LIREPLAY(newIndex);
+		U_32 keyed = 0;
+		U_32 replayed = 0;
+
+		/* Collect the keyed items in cache order and count the entries in each bucket */
+		for (ih = first; NULL != ih; ih = (ih == last) ? NULL : _ccHead->nextItemHeader(currentThread, ih)) {
+			SH_Manager* manager = managers()->getManagerForDataType(ITEMTYPE((ShcItem*)CCITEM(ih)));
+			const U_8* key = NULL;
+			U_16 keySize = 0;
+
+			if ((manager == (SH_Manager*)_rcm) && manager->getLookupKey((ShcItem*)CCITEM(ih), &key, &keySize)) {
+				unsortedEntries[keyed].hashValue = (U_32)manager->getLookupHash(currentThread, key, keySize);
+				unsortedEntries[keyed].itemOffset = _ccHead->getLookupIndexOffset(CCITEM(ih));
+				buckets[(unsortedEntries[keyed].hashValue & (bucketCount - 1)) + 1] += 1;
+				keyed += 1;
+			} else {
+				replay[replayed] = _ccHead->getLookupIndexOffset(CCITEM(ih));
+				replayed += 1;
+			}
+		}
+		/* Turn the counts into the index of the first entry of each bucket, keeping cache order within each bucket */
+		for (U_32 i = 0; i < bucketCount; i++) {
+			buckets[i + 1] += buckets[i];
+		}
+		for (U_32 i = 0; i < keyed; i++) {
+			U_32 bucket = unsortedEntries[i].hashValue & (bucketCount - 1);
+
+			entries[buckets[bucket]] = unsortedEntries[i];
+			buckets[bucket] += 1;
+		}
+		for (U_32 i = bucketCount; i > 0; i--) {
+			buckets[i] = buckets[i - 1];
+		}
+		buckets[0] = 0;
+	}
+
+	data.address = (U_8*)newIndex;
+	data.type = J9SHR_DATA_TYPE_UNKNOWN;
+	data.flags = J9SHRDATA_NOT_INDEXED;
+	{
+		const LookupIndexHeader* indexInCache = (const LookupIndexHeader*)addByteDataToCache(currentThread, localBDM, NULL, &data, _ccHead, false);
+
+		if (NULL == indexInCache) {
+			Trc_SHR_CM_buildLookupIndex_Failed(currentThread, itemCount);
+		} else {
+			_ccHead->setLookupIndex(currentThread, indexInCache);
+			if (NULL != oldIndex) {
+				/* The old index is stored as unindexed byte data, so its item header comes just before it */
+				markItemStale(currentThread, (const ShcItem*)((const U_8*)oldIndex - sizeof(ShcItem)), false);
+			}
+			Trc_SHR_CM_buildLookupIndex_Event(currentThread, indexInCache, itemCount, bucketCount);
+		}
+	}
+
+_done:
+	if (NULL != newIndex) {
+		j9mem_free_memory(newIndex);
+	}
+	if (NULL != unsortedEntries) {
+		j9mem_free_memory(unsortedEntries);
+	}
+	_ccHead->exitWriteMutex(currentThread, fnName);
+}
+
 /* THREADING: MUST be protected by cache write mutex - therefore single-threaded within this JVM */
 IDATA
 SH_CacheMap::checkForCrash(J9VMThread* currentThread, bool hasClassSegmentMutex)
@@ -4237,6 +4934,10 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 				descriptor->numStartupHints = _bdm->getNumOfType(type);
 				descriptor->startupHintBytes = _bdm->getDataBytesForType(type);
 				break;
+			case J9SHR_DATA_TYPE_STARTUP_CLASSES:
+				descriptor->numStartupClassTraces = _bdm->getNumOfType(type);
+				descriptor->startupClassTraceBytes = _bdm->getDataBytesForType(type);
+				break;
 			default:
 				descriptor->indexedDataBytes += _bdm->getDataBytesForType(type);
 			}
@@ -4251,6 +4952,7 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 		descriptor->aotClassChainDataBytes = 0;
 		descriptor->aotThunkDataBytes = 0;
 		descriptor->startupHintBytes = 0;
+		descriptor->startupClassTraceBytes = 0;
 		descriptor->numJclEntries = 0;
 		descriptor->numZipCaches = 0;
 		descriptor->numJitHints = 0;
@@ -4259,6 +4961,7 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 		descriptor->numAotClassChains = 0;
 		descriptor->numAotThunks = 0;
 		descriptor->numStartupHints = 0;
+		descriptor->numStartupClassTraces = 0;
 	}
 
 	descriptor->objectBytes = 0;
@@ -4294,6 +4997,7 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 					descriptor->romClassBytes - descriptor->readWriteBytes - 
 					descriptor->zipCacheDataBytes -
 					descriptor->startupHintBytes-
+					descriptor->startupClassTraceBytes -
 					descriptor->jclDataBytes -
 					descriptor->jitHintDataBytes -
 					descriptor->jitProfileDataBytes -
@@ -4585,8 +5289,14 @@ SH_CacheMap::printAllCacheStats(J9VMThread* currentThread, UDATA showFlags, SH_C
 	ShcItem* it;
 	bool showAllStaleFlag = J9_ARE_ALL_BITS_SET(showFlags, PRINTSTATS_SHOW_ALL_STALE);
 	bool isStale = false;
+	OSCachePageMappingStats mappingStats;
 	PORT_ACCESS_FROM_PORT(_portlib);
 
+	if (J9_ARE_ALL_BITS_SET(showFlags, PRINTSTATS_SHOW_ALL)) {
+		/* Sample the page tables before the walk below maps more of the cache */
+		cache->startPageMappingStats(currentThread, &mappingStats);
+	}
+
 	if (cache->enterWriteMutex(currentThread, false, fnName) != 0) {
 		return -1;
 	}
@@ -4934,6 +5644,13 @@ SH_CacheMap::printAllCacheStats(J9VMThread* currentThread, UDATA showFlags, SH_C
 	} while (it); 
 
 	cache->exitWriteMutex(currentThread, fnName);
+
+	if (J9_ARE_ALL_BITS_SET(showFlags, PRINTSTATS_SHOW_ALL)) {
+		if (cache->getPageMappingStats(currentThread, &mappingStats)) {
+			CACHEMAP_PRINT4(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_PAGE_MAPPING, cache->getLayer(),
+					mappingStats.hugePageBytes, mappingStats.pageTableBytes, mappingStats.dtlbMisses);
+		}
+	}
 	return 0;
 }
 
@@ -5121,6 +5838,7 @@ SH_CacheMap::printCacheStatsAllLayersStatsHelper(J9VMThread* currentThread, UDAT
 	}
 	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_ZIP_CACHE_DATA_BYTES_V2, javacoreData->zipCacheDataBytes);
 	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_STARTUP_HINT_BYTES, javacoreData->startupHintBytes);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_STARTUP_CLASS_TRACE_BYTES, javacoreData->startupClassTraceBytes);
 
 	if (J9_ARE_ALL_BITS_SET(runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_DETAILED_STATS)) {
 		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_JCL_DATA_BYTES, javacoreData->jclDataBytes);
@@ -5156,6 +5874,7 @@ SH_CacheMap::printCacheStatsAllLayersStatsHelper(J9VMThread* currentThread, UDAT
 	}
 	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_NUM_ZIP_CACHES_V2, javacoreData->numZipCaches);
 	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_NUM_STARTUP_HINTS, javacoreData->numStartupHints);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_NUM_STARTUP_CLASS_TRACES, javacoreData->numStartupClassTraces);
 	if (J9_ARE_ALL_BITS_SET(runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_DETAILED_STATS)) {
 		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_SUMMARY_NUM_JCL_ENTRIES, javacoreData->numJclEntries);
 	}
@@ -5263,6 +5982,7 @@ SH_CacheMap::runExitCode(J9VMThread* currentThread)
 	SH_CompositeCacheImpl* cache = _ccHead;
 
 	printShutdownStats();
+	buildLookupIndex(currentThread);
 	
 	walkManager = managers()->startDo(currentThread, 0, &state);
 	while (walkManager) {
@@ -70,6 +70,43 @@ typedef struct CacheAddressRange {
 	void* cacheEnd;
 } CacheAddressRange;
 
+/* Maximum number of threads, including the thread starting the cache, used to read a multi-layer cache at startup */
+#define CM_STARTUP_HELPER_THREADS_MAX 4
+
+class SH_CacheMap;
+struct StartupScan;
+
+/* A cache layer being read at startup */
+typedef struct StartupScanLayer {
+	SH_CompositeCacheImpl* cache;
+	const LookupIndexHeader* index;		/* NULL if the layer is read without its lookup index */
+	const ShcItem** items;				/* Items not covered by the lookup index, in the order they were added */
+	UDATA itemCount;
+	IDATA result;						/* Number of items read, or CM_READ_CACHE_FAILED or CM_CACHE_CORRUPT */
+	U_64 readMicros;
+	U_64 storeMicros[CM_STARTUP_HELPER_THREADS_MAX];
+} StartupScanLayer;
+
+/* A thread storing the items of the managers assigned to it */
+typedef struct StartupScanHelper {
+	struct StartupScan* scan;
+	UDATA helperID;
+	bool storeTypes[MAX_DATA_TYPES + 1];
+	bool done;
+	IDATA failedLayer;					/* Index of the layer that could not be stored, or -1 */
+} StartupScanHelper;
+
+typedef struct StartupScan {
+	SH_CacheMap* cacheMap;
+	J9JavaVM* vm;
+	StartupScanLayer* layers;			/* Lowest layer first */
+	UDATA layerCount;
+	StartupScanHelper helpers[CM_STARTUP_HELPER_THREADS_MAX];
+	UDATA helperCount;
+	omrthread_monitor_t monitor;
+	UDATA helpersRunning;
+} StartupScan;
+
 /* 
  * Implementation of SH_SharedCache interface
  */
@@ -332,6 +369,22 @@ private:
 
 	IDATA readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, IDATA expectedUpdates, bool startupForStats);
 
+	IDATA readLookupIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache);
+
+	IDATA useLookupIndex(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, const LookupIndexHeader** indexToUse);
+
+	IDATA storeIndexedItems(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, const LookupIndexHeader* index, const bool* storeTypes);
+
+	IDATA readCacheLayersInParallel(J9VMThread* currentThread, IDATA* layerResults);
+
+	IDATA scanLayerForStartup(J9VMThread* currentThread, StartupScanLayer* layer);
+
+	IDATA storeStartupItems(J9VMThread* currentThread, StartupScan* scan, StartupScanHelper* helper);
+
+	static int J9THREAD_PROC startupHelperThreadMain(void* arg);
+
+	void buildLookupIndex(J9VMThread* currentThread);
+
 	IDATA refreshHashtables(J9VMThread* currentThread, bool hasClassSegmentMutex);
 
 	ClasspathWrapper* addClasspathToCache(J9VMThread* currentThread, ClasspathItem* obj);
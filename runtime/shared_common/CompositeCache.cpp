@@ -156,7 +156,7 @@ SH_CompositeCacheImpl::SH_SharedCacheHeaderInit::init(BlockPtr data, U_32 len, I
 	ca->writerCount = 0;
 	ca->softMaxBytes = softMaxBytes;
 	ca->cacheFullFlags = 0;
-	ca->unused8 = 0;
+	ca->lookupIndexOffset = 0;
 	ca->unused9 = 0;
 	ca->unused10 = 0;
 	/* Note that the updateCountLockWord is only ever used single threaded, so no need to dereference this */
@@ -2013,17 +2013,19 @@ SH_CompositeCacheImpl::doLockCache(J9VMThread* currentThread)
 	/* TODO: This will not work for cachelets - need to reorganised how the CRCing is done */
 	_theca->crcValid = 0;
 	protectHeaderReadWriteArea(currentThread, false);
-	while ((patienceCntr < CACHE_LOCK_PATIENCE_COUNTER) && (_theca->readerCount>0)) {
+	while ((patienceCntr < CACHE_LOCK_PATIENCE_COUNTER) && (getReaderCount(currentThread) > 0)) {
 		omrthread_sleep(5);
 		++patienceCntr;
 	}
 	if ((CACHE_LOCK_PATIENCE_COUNTER == patienceCntr) 
-		&& (_theca->readerCount > 0)
+		&& (getReaderCount(currentThread) > 0)
 	) {
 		/* Reader has almost certainly died. Cannot wait forever. Whack to zero and proceed. */
 		Trc_SHR_CC_doLockCache_EventWhackedToZero(currentThread);
 		unprotectHeaderReadWriteArea(currentThread, false);
-		_theca->readerCount = 0;
+		for (UDATA i = 0; i < J9SH_READER_SLOT_COUNT; i++) {
+			_theca->readerSlots[i].readerCount = 0;
+		}
 		protectHeaderReadWriteArea(currentThread, false);
 	}
 
@@ -2214,17 +2216,33 @@ SH_CompositeCacheImpl::setWriteHash(J9VMThread *currentThread, UDATA hashValue)
 	Trc_SHR_CC_setWriteHash_Exit(_commonCCInfo->vmID, oldNum, value, compareSwapResult, _theca->writeHash);
 }
 
+/**
+ * Returns the reader count of this JVM. Readers in other JVMs are counted in other slots, unless
+ * there are more JVMs than slots, so readers do not write the cache lines that other JVMs write.
+ */
+volatile UDATA*
+SH_CompositeCacheImpl::getReaderCountForVM(void)
+{
+	if (UnitTest::READER_SLOT_SHARED_TEST == UnitTest::unitTest) {
+		/* Count every JVM in the first slot, as the single reader count did */
+		return &(_theca->readerSlots[0].readerCount);
+	}
+	return &(_theca->readerSlots[_commonCCInfo->vmID % J9SH_READER_SLOT_COUNT].readerCount);
+}
+
 void
 SH_CompositeCacheImpl::incReaderCount(J9VMThread* currentThread)
 {
 	UDATA oldNum, value;
+	volatile UDATA* readerCount = NULL;
 
 	if (!_started || _readOnlyOSCache) {
 		Trc_SHR_Assert_ShouldNeverHappen();
 		return;
 	}
 
-	oldNum = _theca->readerCount;
+	readerCount = getReaderCountForVM();
+	oldNum = *readerCount;
 	Trc_SHR_CC_incReaderCount_Entry(oldNum);
 
 	value = 0;
@@ -2232,25 +2250,27 @@ SH_CompositeCacheImpl::incReaderCount(J9VMThread* currentThread)
 
 	do {
 		value = oldNum + 1;
-		oldNum = VM_AtomicSupport::lockCompareExchange((UDATA*)&(_theca->readerCount), oldNum, value);
+		oldNum = VM_AtomicSupport::lockCompareExchange((UDATA*)readerCount, oldNum, value);
 	} while ((UDATA)value != (oldNum + 1));
 
 	protectHeaderReadWriteArea(currentThread, false);
 
-	Trc_SHR_CC_incReaderCount_Exit(_theca->readerCount);
+	Trc_SHR_CC_incReaderCount_Exit(*readerCount);
 }
 
 void
 SH_CompositeCacheImpl::decReaderCount(J9VMThread* currentThread)
 {
 	UDATA oldNum, value;
+	volatile UDATA* readerCount = NULL;
 
 	if (!_started || _readOnlyOSCache) {
 		Trc_SHR_Assert_ShouldNeverHappen();
 		return;
 	}
 
-	oldNum = _theca->readerCount;
+	readerCount = getReaderCountForVM();
+	oldNum = *readerCount;
 	Trc_SHR_CC_decReaderCount_Entry(oldNum);
 
 	value = 0;
@@ -2258,18 +2278,18 @@ SH_CompositeCacheImpl::decReaderCount(J9VMThread* currentThread)
 
 	do {
 		if (0 == oldNum) {
-			/* This can happen if _theca->readerCount is whacked to 0 by doLockCache() */
+			/* This can happen if the reader counts are whacked to 0 by doLockCache() */
 			PORT_ACCESS_FROM_PORT(_portlib);
 			CC_ERR_TRACE(J9NLS_SHRC_CC_NEGATIVE_READER_COUNT);
 			break;
 		}
 		value = oldNum - 1;
-		oldNum = VM_AtomicSupport::lockCompareExchange((UDATA*)&(_theca->readerCount), oldNum, value);
+		oldNum = VM_AtomicSupport::lockCompareExchange((UDATA*)readerCount, oldNum, value);
 	} while ((UDATA)value != (oldNum - 1));
 
 	protectHeaderReadWriteArea(currentThread, false);
 
-	Trc_SHR_CC_decReaderCount_Exit(_theca->readerCount);
+	Trc_SHR_CC_decReaderCount_Exit(*readerCount);
 }
 
 /**
@@ -2315,7 +2335,8 @@ SH_CompositeCacheImpl::enterReadMutex(J9VMThread* currentThread, const char* cal
 	}
 
 	/* THREADING: Important to increment readerCount before checking isLocked(), as the incremented
-	 * reader count prevents a lock from occurring.
+	 * reader count prevents a lock from occurring. The count is in this JVM's reader slot, so in the
+	 * common case of an unlocked cache we don't write to memory written by other JVMs.
 	 */
 	incReaderCount(currentThread);
 
@@ -3202,6 +3223,199 @@ SH_CompositeCacheImpl::findStart(J9VMThread* currentThread)
 	Trc_SHR_CC_findStart_Event(currentThread, _scan);
 }
 
+/**
+ * Returns the lookup index recorded in the cache header, if it is intact.
+ *
+ * @param [in] currentThread  The current thread
+ *
+ * @return The index, or NULL if the cache has none or the one it has does not fit the cache
+ */
+const LookupIndexHeader*
+SH_CompositeCacheImpl::getLookupIndex(J9VMThread* currentThread)
+{
+	const LookupIndexHeader* index = NULL;
+	UDATA indexOffset = 0;
+
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return NULL;
+	}
+
+	indexOffset = _theca->lookupIndexOffset;
+	if (0 != indexOffset) {
+		BlockPtr metaStart = UPDATEPTR(_theca);
+		BlockPtr metaEnd = CCFIRSTENTRY(_theca);
+		BlockPtr start = NULL;
+		BlockPtr scan = NULL;
+		UDATA* updateCountAddress = WSRP_GET(_theca->updateCountPtr, UDATA*);
+
+		index = (const LookupIndexHeader*)((BlockPtr)_theca + indexOffset);
+		if (((BlockPtr)index < metaStart)
+			|| (((BlockPtr)index + sizeof(LookupIndexHeader)) > metaEnd)
+			|| (LOOKUPINDEX_EYECATCHER != index->eyecatcher)
+			|| (LOOKUPINDEX_VERSION != index->version)
+			|| (0 == index->bucketCount)
+			|| (0 != (index->bucketCount & (index->bucketCount - 1)))
+			|| (((BlockPtr)index + LILEN(index->bucketCount, index->keyedCount, index->replayCount)) > metaEnd)
+			|| ((index->keyedCount + index->replayCount) > index->itemCount)
+			|| (index->itemCount > *updateCountAddress)
+		) {
+			Trc_SHR_CC_getLookupIndex_Invalid(currentThread, index);
+			return NULL;
+		}
+
+		/* The index is stored after the items it covers */
+		start = (BlockPtr)_theca + index->startOffset;
+		scan = (BlockPtr)_theca + index->scanOffset;
+		if ((scan <= (BlockPtr)index) || (scan > start) || (start > metaEnd)) {
+			Trc_SHR_CC_getLookupIndex_Invalid(currentThread, index);
+			return NULL;
+		}
+	}
+
+	return index;
+}
+
+/**
+ * Returns the number of updates made to the cache since it was created.
+ * Every item added to the cache counts as an update, so this is at least the number of items in it.
+ *
+ * @return The update count from the cache header
+ */
+UDATA
+SH_CompositeCacheImpl::getUpdateCount(void)
+{
+	UDATA* updateCountAddress = NULL;
+
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return 0;
+	}
+	updateCountAddress = WSRP_GET(_theca->updateCountPtr, UDATA*);
+
+	return *updateCountAddress;
+}
+
+/**
+ * Records the lookup index in the cache header.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] index  The index, which must be in this cache, or NULL to forget the current one
+ *
+ * @pre The caller must hold the shared classes cache write mutex
+ */
+void
+SH_CompositeCacheImpl::setLookupIndex(J9VMThread* currentThread, const LookupIndexHeader* index)
+{
+	if (!_started || _readOnlyOSCache) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return;
+	}
+	Trc_SHR_Assert_True(hasWriteMutex(currentThread));
+
+	unprotectHeaderReadWriteArea(currentThread, false);
+	_theca->lookupIndexOffset = (NULL == index) ? 0 : ((UDATA)index - (UDATA)_theca);
+	protectHeaderReadWriteArea(currentThread, false);
+
+	Trc_SHR_CC_setLookupIndex_Event(currentThread, index);
+}
+
+/**
+ * Moves the nextEntry() pointer past the items covered by the lookup index, as if they had been read.
+ * This is only done if the pointer is at the first item the index covers.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] index  The index returned by getLookupIndex()
+ *
+ * @return true if the items were skipped, false if nextEntry() is elsewhere
+ *
+ * @pre Local or cache mutex must be obtained to use this function
+ */
+bool
+SH_CompositeCacheImpl::skipIndexedEntries(J9VMThread* currentThread, const LookupIndexHeader* index)
+{
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return false;
+	}
+	Trc_SHR_Assert_True((currentThread == _commonCCInfo->hasRefreshMutexThread) || hasWriteMutex(currentThread));
+
+	if (_scan != (ShcItemHdr*)((BlockPtr)_theca + index->startOffset)) {
+		return false;
+	}
+
+	_prevScan = _scan;
+	_scan = (ShcItemHdr*)((BlockPtr)_theca + index->scanOffset);
+	if (_doMetaProtect) {
+		/* Protect the skipped items as next() would have done */
+		notifyPagesRead((BlockPtr)_prevScan, (BlockPtr)_scan + sizeof(ShcItemHdr), DIRECTION_BACKWARD, true);
+	}
+
+	Trc_SHR_CC_skipIndexedEntries_Event(currentThread, index->itemCount, _scan);
+	return true;
+}
+
+/**
+ * Converts an item offset taken from a lookup index to the item.
+ *
+ * @param [in] itemOffset  The offset from the cache header of the item
+ *
+ * @return The item, or NULL if the offset is not in the metadata area
+ */
+const ShcItem*
+SH_CompositeCacheImpl::getItemFromLookupIndexOffset(U_32 itemOffset)
+{
+	BlockPtr item = (BlockPtr)_theca + itemOffset;
+
+	if ((item < UPDATEPTR(_theca)) || ((item + sizeof(ShcItem)) > CCFIRSTENTRY(_theca))) {
+		return NULL;
+	}
+	return (const ShcItem*)item;
+}
+
+/**
+ * Returns the offset of an address in this cache from the cache header, as stored in a lookup index.
+ *
+ * @param [in] address  An address in this cache
+ *
+ * @return The offset
+ */
+U_32
+SH_CompositeCacheImpl::getLookupIndexOffset(const void* address)
+{
+	return (U_32)((UDATA)address - (UDATA)_theca);
+}
+
+/**
+ * Walks the item headers in the order the items were added, without moving the nextEntry() pointer.
+ * Stale items are included.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] previous  NULL to start the walk, otherwise the header returned by the previous call
+ *
+ * @return The next item header, or NULL if there are no more items.
+ * The header of the next item to be added is at CCITEMNEXT() of the last header returned.
+ *
+ * @pre The caller must hold the shared classes cache write mutex
+ */
+ShcItemHdr*
+SH_CompositeCacheImpl::nextItemHeader(J9VMThread* currentThread, ShcItemHdr* previous)
+{
+	ShcItemHdr* ih = (NULL == previous) ? (ShcItemHdr*)CCFIRSTENTRY(_theca) : CCITEMNEXT(previous);
+	BlockPtr free = UPDATEPTR(_theca);
+
+	Trc_SHR_Assert_True(hasWriteMutex(currentThread));
+
+	if ((BlockPtr)ih > free) {
+		UDATA maxCCItemLen = (((UDATA)ih) - ((UDATA)free)) + sizeof(struct ShcItemHdr);
+
+		if ((CCITEMLEN(ih) > 0) && (CCITEMLEN(ih) <= maxCCItemLen)) {
+			return ih;
+		}
+	}
+	return NULL;
+}
+
 /**
  * Utility function for finding the address of the start of the cache data.
  *
@@ -4001,7 +4215,12 @@ SH_CompositeCacheImpl::getReaderCount(J9VMThread* currentThread)
 		return 0;
 	}
 	if (!_readOnlyOSCache) {
-		return _theca->readerCount;
+		UDATA readerCount = 0;
+
+		for (UDATA i = 0; i < J9SH_READER_SLOT_COUNT; i++) {
+			readerCount += _theca->readerSlots[i].readerCount;
+		}
+		return readerCount;
 	} else {
 		return _readOnlyReaderCount;			/* Maintained so that our assertions still work */
 	}
@@ -5729,6 +5948,42 @@ SH_CompositeCacheImpl::dontNeedMetadata(J9VMThread *currentThread)
 		_oscache->dontNeedMetadata(currentThread, (const void *)min, length);
 	}
 }
+
+/**
+ * Start measuring the cost of mapping the shared classes cache in this process.
+ * Call this before reading the cache for the measurement, then call getPageMappingStats() with the same stats.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [out] stats  The state of the measurement
+ */
+void
+SH_CompositeCacheImpl::startPageMappingStats(J9VMThread *currentThread, OSCachePageMappingStats *stats)
+{
+	if (NULL == _oscache) {
+		stats->hugePageBytes = -1;
+		stats->pageTableBytes = -1;
+		stats->dtlbMisses = -1;
+		return;
+	}
+	_oscache->startPageMappingStats(currentThread, stats);
+}
+
+/**
+ * Measure the cost of mapping the shared classes cache in this process
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in,out] stats  The state set by startPageMappingStats(), and on return the cost of the mapping
+ *
+ * @return true if the cost was measured, false if it cannot be measured for this cache
+ */
+bool
+SH_CompositeCacheImpl::getPageMappingStats(J9VMThread *currentThread, OSCachePageMappingStats *stats)
+{
+	if (NULL == _oscache) {
+		return false;
+	}
+	return _oscache->getPageMappingStats(currentThread, stats);
+}
 /**
  * This function changes the permission of the page containing given address by marking the page as read-only or read-write.
  * The address may belong to either segment region, metadata region or class debug data region.
@@ -149,6 +149,20 @@ public:
 	UDATA stale(BlockPtr block);
 	
 	void findStart(J9VMThread* currentThread);
+
+	const LookupIndexHeader* getLookupIndex(J9VMThread* currentThread);
+
+	UDATA getUpdateCount(void);
+
+	void setLookupIndex(J9VMThread* currentThread, const LookupIndexHeader* index);
+
+	bool skipIndexedEntries(J9VMThread* currentThread, const LookupIndexHeader* index);
+
+	const ShcItem* getItemFromLookupIndexOffset(U_32 itemOffset);
+
+	U_32 getLookupIndexOffset(const void* address);
+
+	ShcItemHdr* nextItemHeader(J9VMThread* currentThread, ShcItemHdr* previous);
 	
 	void* getBaseAddress(void);
 
@@ -361,6 +375,10 @@ public:
 	IDATA restoreFromSnapshot(J9JavaVM* vm, const char* cacheName, bool* cacheExist);
 	void dontNeedMetadata(J9VMThread *currentThread);
 
+	void startPageMappingStats(J9VMThread *currentThread, OSCachePageMappingStats *stats);
+
+	bool getPageMappingStats(J9VMThread *currentThread, OSCachePageMappingStats *stats);
+
 	void changePartialPageProtection(J9VMThread *currentThread, void *addr, bool readOnly, bool phaseCheck = true);
 
 	void protectPartiallyFilledPages(J9VMThread *currentThread, bool protectSegmentPage = true, bool protectMetadataPage = true, bool protectDebugDataPages = true, bool phaseCheck = true);
@@ -500,6 +518,7 @@ private:
 	
 	BlockPtr next(J9VMThread* currentThread);
 
+	volatile UDATA* getReaderCountForVM(void);
 	void incReaderCount(J9VMThread* currentThread);
 	void decReaderCount(J9VMThread* currentThread);
 
@@ -45,7 +45,11 @@ SH_Manager::SH_Manager()
    _htEntries(0),
    _runtimeFlagsPtr(0),
    _verboseFlags(0),
-   _state(0)
+   _state(0),
+   _lookupIndexes(0),
+   _retiredLookupIndexes(0),
+   _lookupIndexMutex(0),
+   _lookupIndexLoader(0)
 {
 }
 
@@ -133,6 +137,7 @@ SH_Manager::tearDownHashTable(J9VMThread* currentThread)
 		hashTableFree(_hashTable);
 		_hashTable = NULL;
 	}
+	retireLookupIndexes(currentThread);
 
 	Trc_SHR_M_tearDownHashTable_Exit(currentThread);
 }
@@ -270,11 +275,16 @@ SH_Manager::cleanup(J9VMThread* currentThread)
 			localPostCleanup(currentThread);
 			_cache->exitLocalMutex(currentThread, _htMutex, "_htMutex", "cleanup");
 		}
+		freeRetiredLookupIndexes(currentThread);
 
 		if (_htMutex) {
 			omrthread_monitor_destroy(_htMutex);
 			_htMutex = NULL;
 		}
+		if (_lookupIndexMutex) {
+			omrthread_monitor_destroy(_lookupIndexMutex);
+			_lookupIndexMutex = NULL;
+		}
 	}
 
 	_state = MANAGER_STATE_INITIALIZED;
@@ -408,6 +418,10 @@ SH_Manager::hllTableLookup(J9VMThread* currentThread, const char* name, U_16 nam
 
 	Trc_SHR_M_hllTableLookup_Entry(currentThread, nameLen, name);
 
+	if ((NULL != _lookupIndexes) && (NULL != currentThread)) {
+		loadIndexedItems(currentThread, getLookupHash(currentThread, (const U_8*)name, nameLen));
+	}
+
 	if (lockHashTable(currentThread, "hllTableLookup")) {
 		result = hllTableLookupHelper(currentThread, (U_8*)name, nameLen, 0, NULL);
 		unlockHashTable(currentThread, "hllTableLookup");
@@ -456,6 +470,10 @@ SH_Manager::hllTableUpdate(J9VMThread* currentThread, const J9Pool* linkPool, co
 	 * @bug Incorrect synchronization of hashtable. Another thread could walk the linked list 
 	 * as we're modifying it. Unlikely to occur because most callers require the VM class segment mutex.
 	 */
+	if ((NULL != _lookupIndexes) && (NULL != currentThread)) {
+		/* Indexed items with the same key were added to the cache first, so must be first in the list */
+		loadIndexedItems(currentThread, getLookupHash(currentThread, J9UTF8_DATA(key), J9UTF8_LENGTH(key)));
+	}
 	if (!(newLink = hllTableAdd(currentThread, linkPool, key, item, 0, cachelet, &addToList))) {
 		Trc_SHR_M_hllTableUpdate_Exit1(currentThread);
 		return NULL;
@@ -572,6 +590,7 @@ SH_Manager::getNumItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA*
 		}
 		*nonStaleItems = countData._nonStaleItems;
 		*staleItems = countData._staleItems;
+		countUnloadedItems(nonStaleItems, staleItems);
 	} else {
 		*nonStaleItems = *staleItems = 0;
 	}
@@ -607,3 +626,220 @@ SH_Manager::isDataTypeRepresended(UDATA type)
 	return false;
 }
 
+/**
+ * Returns the hash value a lookup index records for a key.
+ * This is the value generateHash() gives for the key the item is stored under in the hashtable.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] key The key
+ * @param[in] keySize The length of the key
+ *
+ * @return The hash value
+ */
+UDATA
+SH_Manager::getLookupHash(J9VMThread* currentThread, const U_8* key, U_16 keySize)
+{
+	char *end = getLastDollarSignOfLambdaClassName((const char *)key, keySize);
+
+	if (NULL != end) {
+		/* Lambda classes are stored under the part of the class name before the index number, see HashLinkedListImpl::initialize() */
+		keySize = (U_16)(end - (const char *)key + 1);
+	}
+	return generateHash(currentThread->javaVM->internalVMFunctions, (U_8*)key, keySize);
+}
+
+/**
+ * Registers a lookup index with the manager. The keyed items it covers are not stored in the hashtable
+ * until they are looked up. Indexes must be added in the order their items were added to the caches.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] index The lookup index
+ * @param[in] cachelet The cache containing the index
+ *
+ * @return 0 for success, -1 for failure
+ */
+/* THREADING: Must be protected by the cache write mutex or refresh mutex */
+IDATA
+SH_Manager::addLookupIndex(J9VMThread* currentThread, const LookupIndexHeader* index, SH_CompositeCacheImpl* cachelet)
+{
+	LookupIndexRef* newRef = NULL;
+	UDATA bitmapSize = (index->keyedCount + 7) / 8;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if (getState() != MANAGER_STATE_STARTED) {
+		return -1;
+	}
+	if (NULL == _lookupIndexMutex) {
+		if (omrthread_monitor_init(&_lookupIndexMutex, 0)) {
+			M_ERR_TRACE(J9NLS_SHRC_M_FAILED_CREATE_MUTEX);
+			return -1;
+		}
+	}
+
+	newRef = (LookupIndexRef*)j9mem_allocate_memory(sizeof(LookupIndexRef) + bitmapSize, J9MEM_CATEGORY_CLASSES);
+	if (NULL == newRef) {
+		return -1;
+	}
+	newRef->_index = index;
+	newRef->_cachelet = cachelet;
+	newRef->_next = NULL;
+	newRef->_retired = false;
+	newRef->_loaded = (U_8*)(newRef + 1);
+	memset(newRef->_loaded, 0, bitmapSize);
+
+	/* Lookups walk the list without a lock, so it must be complete before it is seen */
+	VM_AtomicSupport::writeBarrier();
+	if (NULL == _lookupIndexes) {
+		_lookupIndexes = newRef;
+	} else {
+		LookupIndexRef* walk = _lookupIndexes;
+
+		while (NULL != walk->_next) {
+			walk = walk->_next;
+		}
+		walk->_next = newRef;
+	}
+	return 0;
+}
+
+/**
+ * Stores the items in the lookup indexes whose keys have the hash value given, if they have not been stored already.
+ * Items are stored in the order they were added to the caches.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] hashValue The hash value of the key being looked up
+ */
+/* THREADING: Must not be called with the hashtable mutex held. Loading is serialized by _lookupIndexMutex.
+ * The list is walked without a lock. A reset retires the indexes rather than freeing them, see retireLookupIndexes(). */
+void
+SH_Manager::loadIndexedItems(J9VMThread* currentThread, UDATA hashValue)
+{
+	U_32 indexHash = (U_32)hashValue;
+	bool locked = false;
+
+	if (currentThread == _lookupIndexLoader) {
+		/* Nested lookups from storeNew() see the items stored so far, as they would when walking the cache */
+		return;
+	}
+
+	for (LookupIndexRef* ref = _lookupIndexes; NULL != ref; ref = ref->_next) {
+		const LookupIndexHeader* index = ref->_index;
+		const U_32* buckets = LIBUCKETS(index);
+		const LookupIndexEntry* entries = LIENTRIES(index);
+		U_32 bucket = indexHash & (index->bucketCount - 1);
+		U_32 end = OMR_MIN(buckets[bucket + 1], index->keyedCount);
+
+		if (ref->_retired) {
+			/* The hashtable was reset since this index was registered, so its items must not be stored */
+			continue;
+		}
+
+		for (U_32 i = buckets[bucket]; i < end; i++) {
+			const ShcItem* item = NULL;
+
+			if ((indexHash != entries[i].hashValue) || (0 != (ref->_loaded[i / 8] & (1 << (i % 8))))) {
+				continue;
+			}
+			if (!locked) {
+				if (0 != _cache->enterLocalMutex(currentThread, _lookupIndexMutex, "lookupIndexMutex", "loadIndexedItems")) {
+					return;
+				}
+				locked = true;
+				_lookupIndexLoader = currentThread;
+			}
+			/* Another thread may have stored the item, or reset the hashtable, while we waited */
+			if (ref->_retired) {
+				break;
+			}
+			if (0 != (ref->_loaded[i / 8] & (1 << (i % 8)))) {
+				continue;
+			}
+
+			item = ref->_cachelet->getItemFromLookupIndexOffset(entries[i].itemOffset);
+			if ((NULL == item) || !isDataTypeRepresended(ITEMTYPE(item))) {
+				Trc_SHR_M_loadIndexedItems_InvalidItem(currentThread, entries[i].itemOffset, index);
+			} else if (!storeNew(currentThread, item, ref->_cachelet)) {
+				Trc_SHR_M_loadIndexedItems_StoreFailed(currentThread, item, index);
+			}
+			/* Readers that see the bit without the mutex must also see the stored item */
+			VM_AtomicSupport::writeBarrier();
+			ref->_loaded[i / 8] |= (1 << (i % 8));
+		}
+	}
+
+	if (locked) {
+		_lookupIndexLoader = NULL;
+		_cache->exitLocalMutex(currentThread, _lookupIndexMutex, "lookupIndexMutex", "loadIndexedItems");
+	}
+}
+
+/**
+ * Unpublishes the lookup indexes when the hashtable is torn down. Lookups walk the list without a lock, so
+ * the references are kept on a retired list until cleanup() rather than being freed here. They are only
+ * retired when the hashtable is reset, which happens when a crashed JVM is detected or the cache is destroyed,
+ * so the retired list stays short.
+ */
+/* THREADING: Must be protected by hashtable mutex */
+void
+SH_Manager::retireLookupIndexes(J9VMThread* currentThread)
+{
+	LookupIndexRef* retired = _lookupIndexes;
+	LookupIndexRef* last = retired;
+
+	if (NULL == retired) {
+		return;
+	}
+	_lookupIndexes = NULL;
+	for (LookupIndexRef* ref = retired; NULL != ref; ref = ref->_next) {
+		ref->_retired = true;
+		last = ref;
+	}
+	/* Lookups still walking the list see the retired flags, then the older retired references, which are flagged too */
+	VM_AtomicSupport::writeBarrier();
+	last->_next = _retiredLookupIndexes;
+	_retiredLookupIndexes = retired;
+}
+
+/* THREADING: Must only be called single-threaded and not concurrent with any other functions */
+void
+SH_Manager::freeRetiredLookupIndexes(J9VMThread* currentThread)
+{
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	while (NULL != _retiredLookupIndexes) {
+		LookupIndexRef* next = _retiredLookupIndexes->_next;
+
+		j9mem_free_memory(_retiredLookupIndexes);
+		_retiredLookupIndexes = next;
+	}
+}
+
+/**
+ * Adds the items in the lookup indexes which have not been stored yet to the counts given.
+ * Orphans are not counted, as most are reunited with their ROMClass item when stored.
+ */
+void
+SH_Manager::countUnloadedItems(UDATA* nonStaleItems, UDATA* staleItems)
+{
+	for (LookupIndexRef* ref = _lookupIndexes; NULL != ref; ref = ref->_next) {
+		const LookupIndexEntry* entries = LIENTRIES(ref->_index);
+
+		if (ref->_retired) {
+			continue;
+		}
+
+		for (U_32 i = 0; i < ref->_index->keyedCount; i++) {
+			if (0 == (ref->_loaded[i / 8] & (1 << (i % 8)))) {
+				const ShcItem* item = ref->_cachelet->getItemFromLookupIndexOffset(entries[i].itemOffset);
+
+				if ((NULL != item) && (TYPE_ORPHAN != ITEMTYPE(item))) {
+					if (_cache->isStale(item)) {
+						++(*staleItems);
+					} else {
+						++(*nonStaleItems);
+					}
+				}
+			}
+		}
+	}
+}
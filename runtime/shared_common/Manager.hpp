@@ -149,6 +149,14 @@ public:
 
 	bool isDataTypeRepresended(UDATA type);
 
+	/* This function should be implemented by managers whose items can be found through a lookup index.
+	 * It returns the key the item given is stored under in the hashtable. */
+	virtual bool getLookupKey(const ShcItem* itemInCache, const U_8** key, U_16* keySize) { return false; }
+
+	UDATA getLookupHash(J9VMThread* currentThread, const U_8* key, U_16 keySize);
+
+	IDATA addLookupIndex(J9VMThread* currentThread, const LookupIndexHeader* index, SH_CompositeCacheImpl* cachelet);
+
 protected:
 	J9HashTable* _hashTable;
 	SH_SharedCache* _cache;
@@ -211,10 +219,39 @@ protected:
 	static UDATA hllHashEqualFn(void* left, void* right, void *userData);
 
 private:
+	/**
+	 * A lookup index registered with addLookupIndex().
+	 * The items it covers are stored in the hashtable the first time their key is looked up.
+	 *
+	 * @ingroup Shared_Common
+	 */
+	class LookupIndexRef
+	{
+	public:
+		const LookupIndexHeader* _index;
+		SH_CompositeCacheImpl* _cachelet;
+		LookupIndexRef* _next;
+		U_8* _loaded;		/* One bit per keyed entry, set once the item has been stored */
+		volatile bool _retired;		/* Set when the hashtable is reset, after which the items are not stored */
+	};
+
 	UDATA _state;
 
 	const char* _managerType;
 
+	LookupIndexRef* volatile _lookupIndexes;
+	LookupIndexRef* _retiredLookupIndexes;
+	omrthread_monitor_t _lookupIndexMutex;
+	J9VMThread* volatile _lookupIndexLoader;
+
+	void loadIndexedItems(J9VMThread* currentThread, UDATA hashValue);
+
+	void retireLookupIndexes(J9VMThread* currentThread);
+
+	void freeRetiredLookupIndexes(J9VMThread* currentThread);
+
+	void countUnloadedItems(UDATA* nonStaleItems, UDATA* staleItems);
+
 	IDATA initializeHashTable(J9VMThread* currentThread);
 
 	void tearDownHashTable(J9VMThread* currentThread);
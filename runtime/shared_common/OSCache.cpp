@@ -455,6 +455,20 @@ SH_OSCache::dontNeedMetadata(J9VMThread* currentThread, const void* startAddress
 	return;
 }
 
+/* override if the cost of mapping the cache can be measured */
+void
+SH_OSCache::startPageMappingStats(J9VMThread* currentThread, OSCachePageMappingStats* stats) {
+	stats->hugePageBytes = -1;
+	stats->pageTableBytes = -1;
+	stats->dtlbMisses = -1;
+}
+
+/* override if the cost of mapping the cache can be measured */
+bool
+SH_OSCache::getPageMappingStats(J9VMThread* currentThread, OSCachePageMappingStats* stats) {
+	return false;
+}
+
 /* Function that initializes class variables common to OSCache subclasses */
 void
 SH_OSCache::commonInit(J9PortLibrary* portLibrary, UDATA generation, I_8 layer)
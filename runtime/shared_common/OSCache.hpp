@@ -61,7 +61,7 @@
 #define OSCACHE_LOWEST_ACTIVE_GEN 1
 
 /* Always increment this value by 2. For testing we use the (current generation - 1) and expect the cache contents to be compatible. */
-#define OSCACHE_CURRENT_CACHE_GEN 41
+#define OSCACHE_CURRENT_CACHE_GEN 43
 #define OSCACHE_CURRENT_LAYER_LAYER 0
 
 #define J9SH_VERSION(versionMajor, versionMinor) (versionMajor*100 + versionMinor)
@@ -161,6 +161,13 @@ typedef struct LastErrorInfo {
 	const char *lastErrorMsg;
 } LastErrorInfo;
 
+/* Cost of mapping a cache, measured by SH_OSCache::startPageMappingStats() and getPageMappingStats(). -1 if a value could not be measured. */
+typedef struct OSCachePageMappingStats {
+	I_64 hugePageBytes;
+	I_64 pageTableBytes;
+	I_64 dtlbMisses;
+} OSCachePageMappingStats;
+
 /**
  * A class to manage Shared Classes on Operating System level
  * 
@@ -269,6 +276,10 @@ public:
 	virtual SH_CacheAccess isCacheAccessible(void) const { return J9SH_CACHE_ACCESS_ALLOWED; }
 
 	virtual void  dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
+
+	virtual void startPageMappingStats(J9VMThread* currentThread, OSCachePageMappingStats* stats);
+
+	virtual bool getPageMappingStats(J9VMThread* currentThread, OSCachePageMappingStats* stats);
 	
 	virtual IDATA detach(void) = 0;
 
@@ -34,6 +34,48 @@
 #include "j9shrnls.h"
 #include "util_api.h"
 
+#if defined(LINUX)
+#include <errno.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/vfs.h>
+#include <linux/magic.h>
+#include <linux/perf_event.h>
+
+/* From numaif.h, which is not installed everywhere */
+#if !defined(MPOL_INTERLEAVE)
+#define MPOL_INTERLEAVE 3
+#endif /* !defined(MPOL_INTERLEAVE) */
+#if !defined(MPOL_F_MEMS_ALLOWED)
+#define MPOL_F_MEMS_ALLOWED (1 << 2)
+#endif /* !defined(MPOL_F_MEMS_ALLOWED) */
+
+#define OSCACHEMMAP_MAX_NUMA_NODES 1024
+#define OSCACHEMMAP_DEFAULT_HUGE_PAGE_SIZE ((UDATA)2 * 1024 * 1024)
+#define OSCACHEMMAP_PROC_LINE_LENGTH 512
+
+/* Called for each line of a file read by readProcFileLines(), returns false to stop reading */
+typedef bool (*ProcFileLineFunction)(char* line, void* userData);
+
+/* State of the search for a mapping in /proc/self/smaps */
+typedef struct SmapsSearch {
+	UDATA address;
+	bool inMapping;
+	I_64 hugePageBytes;
+} SmapsSearch;
+
+static bool readProcFileLines(J9PortLibrary* portLibrary, const char* fileName, ProcFileLineFunction lineFunction, void* userData);
+static bool scanKiloBytes(char* line, const char* key, I_64* bytes);
+static bool hugePageSizeLine(char* line, void* userData);
+static bool pageTableBytesLine(char* line, void* userData);
+static bool smapsLine(char* line, void* userData);
+static UDATA getTransparentHugePageSize(J9PortLibrary* portLibrary);
+static I_64 getPageTableBytes(J9PortLibrary* portLibrary);
+static I_64 getHugePageBytesForMapping(J9PortLibrary* portLibrary, const void* address);
+#endif /* defined(LINUX) */
+
 #include "OSCachemmap.hpp"
 #include "CompositeCacheImpl.hpp"
 #include "UnitTest.hpp"
@@ -103,6 +145,7 @@ SH_OSCachemmap::initialize(J9PortLibrary* portLibrary, char* memForConstructor,
 	_corruptionCode = NO_CORRUPTION;
 	_corruptValue = NO_CORRUPTION;
 	_cacheFileAccess = J9SH_CACHE_FILE_ACCESS_ALLOWED;
+	_mappingFlags = 0;
 	Trc_SHR_OSC_Mmap_initialize_Exit();
 }
 
@@ -194,6 +237,7 @@ SH_OSCachemmap::startup(J9JavaVM* vm, const char* ctrlDirName, UDATA cacheDirPer
 		goto _errorPreFileOpen;
 	}
 	Trc_SHR_OSC_Mmap_startup_commonStartupSuccess();
+	_mappingFlags = vm->sharedCacheAPI->mappingFlags;
 
 	/* Detect remote filesystem */
 	if (openMode & J9OSCACHE_OPEN_MODE_CHECK_NETWORK_CACHE) {
@@ -463,6 +507,346 @@ SH_OSCachemmap::dontNeedMetadata(J9VMThread* currentThread, const void* startAdd
 #endif
 }
 
+/**
+ * Applies the mapping options set with -XX:+ShareClassesUseHugePages and -XX:+ShareClassesNUMAInterleave to the cache.
+ * Only the part of the mapping aligned to huge pages is advised, which covers the ROM class and AOT areas of any cache
+ * larger than a few huge pages. A failure is reported and otherwise ignored, as the cache works the same without it.
+ * Linux only honours huge page advice and a NUMA policy on a shared mapping of a file held in shared memory (tmpfs),
+ * so the options are reported as having no effect when the cache file is on any other file system.
+ */
+void
+SH_OSCachemmap::adviseMapping(void)
+{
+#if defined(LINUX)
+	UDATA hugePageSize = 0;
+	UDATA start = 0;
+	UDATA end = 0;
+	struct statfs fileSystem;
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	if (0 == _mappingFlags) {
+		return;
+	}
+	/* The page cache of other file systems uses default pages allocated on the faulting node, whatever the advice */
+	if ((0 == statfs(_cachePathName, &fileSystem)) && (TMPFS_MAGIC != (UDATA)fileSystem.f_type)) {
+		Trc_SHR_OSC_Mmap_adviseMapping_NotShmem(_cachePathName, (UDATA)fileSystem.f_type);
+		OSC_WARNING_TRACE1(J9NLS_SHRC_OSCACHE_MMAP_ADVICE_NOT_SHMEM, _cachePathName);
+		return;
+	}
+	hugePageSize = getTransparentHugePageSize(PORTLIB);
+	start = ROUND_UP_TO(hugePageSize, (UDATA)_headerStart);
+	end = ROUND_DOWN_TO(hugePageSize, (UDATA)_headerStart + (UDATA)_actualFileLength);
+	if (end <= start) {
+		Trc_SHR_OSC_Mmap_adviseMapping_TooSmall(_headerStart, _actualFileLength, hugePageSize);
+		return;
+	}
+
+	if (J9_ARE_ALL_BITS_SET(_mappingFlags, J9SHR_MAPPINGFLAG_HUGEPAGES)) {
+		if (0 == madvise((void*)start, end - start, MADV_HUGEPAGE)) {
+			Trc_SHR_OSC_Mmap_adviseMapping_HugePages((void*)start, end - start);
+			if (J9_ARE_ALL_BITS_SET(_verboseFlags, J9SHR_VERBOSEFLAG_ENABLE_VERBOSE)) {
+				OSC_TRACE2(J9NLS_SHRC_OSCACHE_MMAP_HUGEPAGES_ADVISED, end - start, hugePageSize);
+			}
+		} else {
+			Trc_SHR_OSC_Mmap_adviseMapping_HugePagesFailed((void*)start, end - start, errno);
+			OSC_WARNING_TRACE1(J9NLS_SHRC_OSCACHE_MMAP_HUGEPAGES_FAILED, errno);
+		}
+	}
+
+	if (J9_ARE_ALL_BITS_SET(_mappingFlags, J9SHR_MAPPINGFLAG_NUMA_INTERLEAVE)) {
+		unsigned long nodeMask[OSCACHEMMAP_MAX_NUMA_NODES / (8 * sizeof(unsigned long))];
+
+		memset(nodeMask, 0, sizeof(nodeMask));
+		/* Interleave over the nodes this process may allocate from */
+		if ((0 == syscall(SYS_get_mempolicy, NULL, nodeMask, OSCACHEMMAP_MAX_NUMA_NODES, NULL, MPOL_F_MEMS_ALLOWED))
+			&& (0 == syscall(SYS_mbind, (void*)start, end - start, MPOL_INTERLEAVE, nodeMask, OSCACHEMMAP_MAX_NUMA_NODES, 0))
+		) {
+			Trc_SHR_OSC_Mmap_adviseMapping_NUMAInterleave((void*)start, end - start);
+			if (J9_ARE_ALL_BITS_SET(_verboseFlags, J9SHR_VERBOSEFLAG_ENABLE_VERBOSE)) {
+				OSC_TRACE1(J9NLS_SHRC_OSCACHE_MMAP_NUMA_INTERLEAVED, end - start);
+			}
+		} else {
+			Trc_SHR_OSC_Mmap_adviseMapping_NUMAInterleaveFailed((void*)start, end - start, errno);
+			OSC_WARNING_TRACE1(J9NLS_SHRC_OSCACHE_MMAP_NUMA_INTERLEAVE_FAILED, errno);
+		}
+	}
+#endif /* defined(LINUX) */
+}
+
+/**
+ * Starts measuring the cost of mapping the cache in this process by sampling the size of the page tables.
+ * This is called before anything else reads the cache for the measurement.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [out] stats  The page table bytes used by the process, or -1 if they cannot be read
+ */
+void
+SH_OSCachemmap::startPageMappingStats(J9VMThread* currentThread, OSCachePageMappingStats* stats)
+{
+	stats->hugePageBytes = -1;
+	stats->pageTableBytes = -1;
+	stats->dtlbMisses = -1;
+#if defined(LINUX)
+	stats->pageTableBytes = getPageTableBytes(_portLibrary);
+#endif /* defined(LINUX) */
+}
+
+/**
+ * Measures the cost of mapping the cache in this process. Every page of the cache is read once so that it is mapped,
+ * and the growth of the page tables since startPageMappingStats() is measured. The cache is then read again, and the
+ * dTLB misses taken are counted.
+ *
+ * The page table bytes are a lower bound: the pages read before startPageMappingStats(), such as those read when
+ * the JVM started the cache, are already mapped.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in,out] stats  On entry, the sample taken by startPageMappingStats(). On return, the bytes of the cache
+ * 		mapped with huge pages, the page table bytes used to map the cache, and the dTLB misses taken reading it.
+ * 		A value that cannot be measured is set to -1.
+ *
+ * @return true if the cost was measured, false if it cannot be measured on this platform
+ */
+bool
+SH_OSCachemmap::getPageMappingStats(J9VMThread* currentThread, OSCachePageMappingStats* stats)
+{
+#if defined(LINUX)
+	const U_8* cacheStart = (const U_8*)_headerStart;
+	const U_8* cacheEnd = cacheStart + _actualFileLength;
+	UDATA pageSize = 0;
+	I_64 pageTableBytesBefore = stats->pageTableBytes;
+	I_64 pageTableBytesAfter = 0;
+	struct perf_event_attr attr;
+	int perfFd = -1;
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	if (NULL == _headerStart) {
+		return false;
+	}
+	pageSize = j9vmem_supported_page_sizes()[0];
+
+	for (const U_8* page = cacheStart; page < cacheEnd; page += pageSize) {
+		(void)*(volatile const U_8*)page;
+	}
+	pageTableBytesAfter = getPageTableBytes(PORTLIB);
+	if ((-1 != pageTableBytesBefore) && (-1 != pageTableBytesAfter)) {
+		stats->pageTableBytes = pageTableBytesAfter - pageTableBytesBefore;
+	} else {
+		stats->pageTableBytes = -1;
+	}
+
+	stats->dtlbMisses = -1;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HW_CACHE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	/* Not available in many containers, in which case the misses are reported as unknown */
+	perfFd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	if (-1 != perfFd) {
+		U_64 misses = 0;
+
+		ioctl(perfFd, PERF_EVENT_IOC_RESET, 0);
+		ioctl(perfFd, PERF_EVENT_IOC_ENABLE, 0);
+		for (const U_8* page = cacheStart; page < cacheEnd; page += pageSize) {
+			(void)*(volatile const U_8*)page;
+		}
+		ioctl(perfFd, PERF_EVENT_IOC_DISABLE, 0);
+		if (sizeof(misses) == read(perfFd, &misses, sizeof(misses))) {
+			stats->dtlbMisses = (I_64)misses;
+		}
+		close(perfFd);
+	}
+
+	stats->hugePageBytes = getHugePageBytesForMapping(PORTLIB, _headerStart);
+	Trc_SHR_OSC_Mmap_getPageMappingStats(_headerStart, stats->hugePageBytes, stats->pageTableBytes, stats->dtlbMisses);
+	return true;
+#else /* defined(LINUX) */
+	return false;
+#endif /* defined(LINUX) */
+}
+
+#if defined(LINUX)
+/**
+ * Reads a file line by line with the port library. Lines longer than OSCACHEMMAP_PROC_LINE_LENGTH are skipped.
+ *
+ * @param [in] portLibrary  The port library
+ * @param [in] fileName  The file to read
+ * @param [in] lineFunction  Called with each line, without its newline, until it returns false
+ * @param [in] userData  Passed to lineFunction
+ *
+ * @return true if the file was read, false if it could not be opened
+ */
+static bool
+readProcFileLines(J9PortLibrary* portLibrary, const char* fileName, ProcFileLineFunction lineFunction, void* userData)
+{
+	char buffer[OSCACHEMMAP_PROC_LINE_LENGTH + 1];
+	UDATA length = 0;
+	bool skipLine = false;
+	IDATA fd = -1;
+	PORT_ACCESS_FROM_PORT(portLibrary);
+
+	fd = j9file_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		return false;
+	}
+	while (true) {
+		IDATA bytesRead = j9file_read(fd, buffer + length, OSCACHEMMAP_PROC_LINE_LENGTH - length);
+		char* line = buffer;
+		char* newline = NULL;
+
+		if (bytesRead <= 0) {
+			/* The last line may not end with a newline */
+			if ((0 != length) && !skipLine) {
+				buffer[length] = '\0';
+				lineFunction(buffer, userData);
+			}
+			break;
+		}
+		length += (UDATA)bytesRead;
+		buffer[length] = '\0';
+
+		while (NULL != (newline = strchr(line, '\n'))) {
+			*newline = '\0';
+			if (!skipLine && !lineFunction(line, userData)) {
+				goto done;
+			}
+			skipLine = false;
+			line = newline + 1;
+		}
+		length -= (UDATA)(line - buffer);
+		memmove(buffer, line, length);
+		if (OSCACHEMMAP_PROC_LINE_LENGTH == length) {
+			/* Drop the rest of a line that doesn't fit the buffer */
+			skipLine = true;
+			length = 0;
+		}
+	}
+done:
+	j9file_close(fd);
+	return true;
+}
+
+/**
+ * Parses a line of the form "<key> <number> kB".
+ *
+ * @param [in] line  The line
+ * @param [in] key  The key, including its colon
+ * @param [out] bytes  The number of bytes, if the line has the key
+ *
+ * @return true if the line has the key and a number
+ */
+static bool
+scanKiloBytes(char* line, const char* key, I_64* bytes)
+{
+	UDATA keyLength = strlen(key);
+	UDATA kiloBytes = 0;
+	char* cursor = line + keyLength;
+
+	if (0 != strncmp(line, key, keyLength)) {
+		return false;
+	}
+	while ((' ' == *cursor) || ('\t' == *cursor)) {
+		cursor += 1;
+	}
+	if (0 != scan_udata(&cursor, &kiloBytes)) {
+		return false;
+	}
+	*bytes = (I_64)kiloBytes * 1024;
+	return true;
+}
+
+static bool
+hugePageSizeLine(char* line, void* userData)
+{
+	UDATA value = 0;
+
+	if ((0 == scan_udata(&line, &value)) && (0 != value)) {
+		*(UDATA*)userData = value;
+	}
+	return false;
+}
+
+static bool
+pageTableBytesLine(char* line, void* userData)
+{
+	return !scanKiloBytes(line, "VmPTE:", (I_64*)userData);
+}
+
+static bool
+smapsLine(char* line, void* userData)
+{
+	SmapsSearch* search = (SmapsSearch*)userData;
+	char* cursor = line;
+	UDATA start = 0;
+	UDATA end = 0;
+	I_64 bytes = 0;
+
+	/* Each mapping starts with a line "<start>-<end> <permissions> ..." */
+	if ((0 == scan_hex(&cursor, &start)) && ('-' == *cursor)) {
+		cursor += 1;
+		if ((0 == scan_hex(&cursor, &end)) && (' ' == *cursor)) {
+			if (search->inMapping) {
+				return false;
+			}
+			search->inMapping = (search->address == start);
+			if (search->inMapping) {
+				search->hugePageBytes = 0;
+			}
+			return true;
+		}
+	}
+	if (search->inMapping
+		&& (scanKiloBytes(line, "AnonHugePages:", &bytes)
+			|| scanKiloBytes(line, "ShmemPmdMapped:", &bytes)
+			|| scanKiloBytes(line, "FilePmdMapped:", &bytes))
+	) {
+		search->hugePageBytes += bytes;
+	}
+	return true;
+}
+
+/**
+ * Returns the size of a transparent huge page, or 2MB if the kernel does not report it.
+ */
+static UDATA
+getTransparentHugePageSize(J9PortLibrary* portLibrary)
+{
+	UDATA hugePageSize = OSCACHEMMAP_DEFAULT_HUGE_PAGE_SIZE;
+
+	readProcFileLines(portLibrary, "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", hugePageSizeLine, &hugePageSize);
+	return hugePageSize;
+}
+
+/**
+ * Returns the memory used by the page tables of this process, or -1 if it cannot be read.
+ */
+static I_64
+getPageTableBytes(J9PortLibrary* portLibrary)
+{
+	I_64 pageTableBytes = -1;
+
+	readProcFileLines(portLibrary, "/proc/self/status", pageTableBytesLine, &pageTableBytes);
+	return pageTableBytes;
+}
+
+/**
+ * Returns the bytes mapped with huge pages in the mapping starting at an address, or -1 if they cannot be read.
+ */
+static I_64
+getHugePageBytesForMapping(J9PortLibrary* portLibrary, const void* address)
+{
+	SmapsSearch search;
+
+	search.address = (UDATA)address;
+	search.inMapping = false;
+	search.hugePageBytes = -1;
+	readProcFileLines(portLibrary, "/proc/self/smaps", smapsLine, &search);
+	return search.hugePageBytes;
+}
+#endif /* defined(LINUX) */
+
 /**
  * Destroy a persistent shared classes cache
  *
@@ -1000,6 +1384,7 @@ SH_OSCachemmap::internalAttach(bool isNewCache, UDATA generation)
 	}
 	_headerStart = _mapFileHandle->pointer;
 	Trc_SHR_OSC_Mmap_internalAttach_goodmapfile(_headerStart);
+	adviseMapping();
 
 	if (!isNewCache) {
 		J9SRP* dataStartField;
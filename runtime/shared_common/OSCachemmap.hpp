@@ -94,6 +94,8 @@ public:
 
 	SH_CacheAccess isCacheAccessible(void) const;
 	virtual void dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
+	virtual void startPageMappingStats(J9VMThread* currentThread, OSCachePageMappingStats* stats);
+	virtual bool getPageMappingStats(J9VMThread* currentThread, OSCachePageMappingStats* stats);
 
 protected:
 	virtual void * getAttachedMemory();
@@ -108,11 +110,14 @@ private:
 	
 	SH_CacheFileAccess _cacheFileAccess;
 
+	UDATA _mappingFlags;
+
 	IDATA acquireAttachReadLock(UDATA generation, LastErrorInfo *lastErrorInfo);
 	IDATA releaseAttachReadLock(UDATA generation);
 
 	IDATA internalAttach(bool isNewCache, UDATA generation);
 	void internalDetach(UDATA generation);
+	void adviseMapping(void);
 	
 	I_32 updateLastAttachedTime(OSCachemmap_header_version_current *cacheHeader);
 	I_32 updateLastDetachedTime();
@@ -203,6 +203,36 @@ SH_ROMClassManagerImpl::storeNew(J9VMThread* currentThread, const ShcItem* itemI
  	return true;
 }
 
+/**
+ * Returns the class name of the ROMClass an item refers to, which is the key storeNew() uses.
+ *
+ * @param[in] itemInCache The address of the item in the cache
+ * @param[out] key The class name
+ * @param[out] keySize The length of the class name
+ *
+ * @return true if successful, false otherwise
+ */
+bool
+SH_ROMClassManagerImpl::getLookupKey(const ShcItem* itemInCache, const U_8** key, U_16* keySize)
+{
+	J9ROMClass* romClass = NULL;
+	J9UTF8* utf8Name = NULL;
+
+	if (ITEMTYPE(itemInCache) == TYPE_ORPHAN) {
+		romClass = (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((OrphanWrapper*)ITEMDATA(itemInCache))->romClassOffset));
+	} else {
+		romClass = (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(itemInCache))->romClassOffset));
+	}
+	if (NULL == romClass) {
+		return false;
+	}
+
+	utf8Name = J9ROMCLASS_CLASSNAME(romClass);
+	*key = J9UTF8_DATA(utf8Name);
+	*keySize = J9UTF8_LENGTH(utf8Name);
+	return true;
+}
+
 /* When an orphan is encountered in the cache, this is added to the hashtable with isOrphan==true. 
  * If a ROMClass entry is found which points to the same ROMClass as the orphan,
  * the hashtable entry should be re-used: The fact that we have an orphan is no longer relevant.
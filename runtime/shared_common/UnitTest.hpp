@@ -45,7 +45,11 @@ public:
 		CACHE_FULL_TEST,
 		PROTECTA_SHARED_CACHE_DATA_TEST,
 		STARTUP_HINTS_TEST,
-		OSCACHE_TEST
+		STARTUP_CLASS_TRACE_TEST,
+		OSCACHE_TEST,
+		LAYERED_CACHE_SERIAL_READ_TEST,
+		LOOKUP_INDEX_UNUSED_TEST,
+		READER_SLOT_SHARED_TEST
 	};
 
 	static IDATA unitTest;
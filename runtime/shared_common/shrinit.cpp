@@ -402,6 +402,9 @@ static J9Module* getModule(J9VMThread* vmThread, U_8* className, UDATA className
 static bool isFreeDiskSpaceLow(J9JavaVM *vm, U_64* maxsize, U_64 runtimeFlags);
 static char* generateStartupHintsKey(J9JavaVM *vm);
 static void fetchStartupHintsFromSharedCache(J9VMThread* vmThread);
+static J9SharedClassCacheDescriptor* findCacheDescriptorForAddress(J9JavaVM* vm, const void* address, U_32* layer);
+static J9SharedClassCacheDescriptor* getCacheDescriptorForLayer(J9JavaVM* vm, U_32 layer);
+static int J9THREAD_PROC startupClassPrefaultThreadMain(void* arg);
 static void findExistingCacheLayerNumbers(J9JavaVM* vm, const char* ctrlDirName, const char* cacheName, U_64 runtimeFlags, I_8 *maxLayerNo);
 
 typedef struct J9SharedVerifyStringTable {
@@ -1584,6 +1587,12 @@ hookFindSharedClass(J9HookInterface** hookInterface, UDATA eventNum, void* voidD
 		}
 	}
 
+	if ((NULL != eventData->result)
+		&& J9_ARE_ALL_BITS_SET(sharedClassConfig->localStartupClassTrace.flags, J9SHR_LOCAL_STARTUPCLASSTRACE_FLAG_RECORD)
+	) {
+		recordStartupClass(currentThread, eventData->result);
+	}
+
 	if (eventData->doPreventStore && (NULL == eventData->result)) {
 		if (0 == omrthread_monitor_owned_by_self(classSegmentMutex)) {
 			omrthread_monitor_enter(classSegmentMutex);
@@ -3743,6 +3752,11 @@ j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal)
 		returnVal = J9VMDLLMAIN_SILENT_EXIT_VM;
 	}
 
+	/* Only a normal run goes on to load classes. The utilities above have all set J9VMDLLMAIN_SILENT_EXIT_VM by now */
+	if (J9VMDLLMAIN_OK == returnVal) {
+		startStartupClassTrace(currentThread);
+	}
+
 	return returnVal;
 
 _error:
@@ -4092,6 +4106,8 @@ j9shr_guaranteed_exit(J9JavaVM *vm, BOOLEAN exitForDebug)
 			}
 		}
 
+		stopStartupClassPrefault(vm);
+
 		/*Perform the shutdown*/
 		((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->runExitCode(vm->mainThread);
 	}
@@ -4162,6 +4178,12 @@ j9shr_shutdown(J9JavaVM *vm)
 		if (config->configMonitor) {
 			omrthread_monitor_destroy(config->configMonitor);
 		}
+		if (NULL != config->localStartupClassTrace.prefaultMonitor) {
+			omrthread_monitor_destroy(config->localStartupClassTrace.prefaultMonitor);
+		}
+		if (NULL != config->localStartupClassTrace.entries) {
+			j9mem_free_memory(config->localStartupClassTrace.entries);
+		}
 		if (config->jclCacheMutex) {
 			omrthread_monitor_destroy(config->jclCacheMutex);
 		}
@@ -4917,6 +4939,7 @@ j9shr_jvmPhaseChange(J9VMThread *currentThread, UDATA phase)
 		/* OpenJ9 issue; https://github.com/eclipse/openj9/issues/3743
 		 * GC decides whether to calls vm->sharedClassConfig->storeGCHints() to store the GC hints into the shared cache. */
 		storeStartupHintsToSharedCache(currentThread);
+		storeStartupClassTraceToSharedCache(currentThread);
 		if (J9_ARE_NO_BITS_SET(vm->sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_MPROTECT_PARTIAL_PAGES_ON_STARTUP)) {
 			((SH_CacheMap*)vm->sharedClassConfig->sharedClassCache)->protectPartiallyFilledPages(currentThread);
 		}
@@ -5266,6 +5289,263 @@ j9shr_findGCHints(J9VMThread* currentThread, UDATA *heapSize1, UDATA *heapSize2)
 	return returnVal;
 }
 
+/**
+ * Finds the layer of the shared cache holding an address.
+ * @param[in] vm  The current J9JavaVM
+ * @param[in] address  The address to look for
+ * @param[out] layer  The layer holding the address, counting from 0 for the lowest layer
+ *
+ * @return The descriptor of the layer holding the address, NULL if the address is not in the shared cache.
+ */
+static J9SharedClassCacheDescriptor*
+findCacheDescriptorForAddress(J9JavaVM* vm, const void* address, U_32* layer)
+{
+	J9SharedClassCacheDescriptor* lowestLayer = vm->sharedClassConfig->cacheDescriptorList->previous;
+	J9SharedClassCacheDescriptor* cacheDesc = lowestLayer;
+	U_32 i = 0;
+
+	do {
+		U_8* cacheStart = (U_8*)cacheDesc->cacheStartAddress;
+
+		if ((cacheStart <= (U_8*)address) && ((U_8*)address < (cacheStart + cacheDesc->cacheSizeBytes))) {
+			*layer = i;
+			return cacheDesc;
+		}
+		cacheDesc = cacheDesc->previous;
+		i += 1;
+	} while (lowestLayer != cacheDesc);
+
+	return NULL;
+}
+
+/**
+ * Gets the descriptor of a layer of the shared cache.
+ * @param[in] vm  The current J9JavaVM
+ * @param[in] layer  The layer, counting from 0 for the lowest layer
+ *
+ * @return The descriptor of the layer, NULL if the shared cache has no such layer.
+ */
+static J9SharedClassCacheDescriptor*
+getCacheDescriptorForLayer(J9JavaVM* vm, U_32 layer)
+{
+	J9SharedClassCacheDescriptor* lowestLayer = vm->sharedClassConfig->cacheDescriptorList->previous;
+	J9SharedClassCacheDescriptor* cacheDesc = lowestLayer;
+
+	for (U_32 i = 0; i < layer; i++) {
+		cacheDesc = cacheDesc->previous;
+		if (lowestLayer == cacheDesc) {
+			return NULL;
+		}
+	}
+	return cacheDesc;
+}
+
+/**
+ * This function looks up the startup class trace stored in the shared cache by a previous run with the same command line.
+ * If there is one, a thread is started to prefault the pages of the ROM classes it lists, in the order they were loaded.
+ * If there is none, the ROM classes found in the shared cache are recorded until the end of startup, and stored
+ * in the shared cache by storeStartupClassTraceToSharedCache().
+ * @param[in] currentThread  The current VM thread
+ */
+void
+startStartupClassTrace(J9VMThread* currentThread)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+	J9SharedLocalStartupClassTrace* trace = &vm->sharedClassConfig->localStartupClassTrace;
+	J9SharedDataDescriptor dataDescriptor = {0};
+	char* key = generateStartupHintsKey(vm);
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL == key) {
+		Trc_SHR_INIT_startStartupClassTrace_Null_key(currentThread);
+		return;
+	}
+
+	if (0 < j9shr_findSharedData(currentThread, key, strlen(key), J9SHR_DATA_TYPE_STARTUP_CLASSES, 0, &dataDescriptor, NULL)) {
+		Trc_SHR_Assert_True(J9SHR_DATA_TYPE_STARTUP_CLASSES == dataDescriptor.type);
+		trace->prefaultEntries = (const J9SharedStartupClassTraceEntry*)dataDescriptor.address;
+		trace->prefaultCount = dataDescriptor.length / sizeof(J9SharedStartupClassTraceEntry);
+		Trc_SHR_INIT_startStartupClassTrace_Found(currentThread, trace->prefaultCount);
+		if (0 == omrthread_monitor_init(&trace->prefaultMonitor, 0)) {
+			omrthread_t prefaultOSThread = NULL;
+
+			omrthread_monitor_enter(trace->prefaultMonitor);
+			trace->prefaultThreadRunning = 1;
+			if (0 != vm->internalVMFunctions->createThreadWithCategory(&prefaultOSThread, vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, FALSE,
+					startupClassPrefaultThreadMain, vm, J9THREAD_CATEGORY_SYSTEM_THREAD)
+			) {
+				trace->prefaultThreadRunning = 0;
+				Trc_SHR_INIT_startStartupClassTrace_PrefaultThreadNotStarted(currentThread);
+			}
+			omrthread_monitor_exit(trace->prefaultMonitor);
+		}
+	} else if (J9_ARE_NO_BITS_SET(vm->sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_READONLY)) {
+		trace->entries = (J9SharedStartupClassTraceEntry*)j9mem_allocate_memory(J9SHR_STARTUPCLASSTRACE_MAX_ENTRIES * sizeof(J9SharedStartupClassTraceEntry), J9MEM_CATEGORY_CLASSES);
+		if (NULL != trace->entries) {
+			memset(trace->entries, 0, J9SHR_STARTUPCLASSTRACE_MAX_ENTRIES * sizeof(J9SharedStartupClassTraceEntry));
+			trace->flags |= J9SHR_LOCAL_STARTUPCLASSTRACE_FLAG_RECORD;
+			Trc_SHR_INIT_startStartupClassTrace_Record(currentThread);
+		}
+	}
+	j9mem_free_memory(key);
+}
+
+/**
+ * Records a ROM class found in the shared cache during startup. The trace is not freed until shutdown, so a class found
+ * while the trace is being stored is recorded harmlessly, or not at all.
+ * @param[in] currentThread  The current VM thread
+ * @param[in] romClass  The ROM class found in the shared cache
+ */
+void
+recordStartupClass(J9VMThread* currentThread, const J9ROMClass* romClass)
+{
+	J9SharedLocalStartupClassTrace* trace = &currentThread->javaVM->sharedClassConfig->localStartupClassTrace;
+	J9SharedClassCacheDescriptor* cacheDesc = NULL;
+	U_32 layer = 0;
+	UDATA oldCount = 0;
+
+	cacheDesc = findCacheDescriptorForAddress(currentThread->javaVM, romClass, &layer);
+	if (NULL == cacheDesc) {
+		return;
+	}
+	do {
+		oldCount = trace->count;
+		if (oldCount >= J9SHR_STARTUPCLASSTRACE_MAX_ENTRIES) {
+			return;
+		}
+	} while (oldCount != VM_AtomicSupport::lockCompareExchange(&trace->count, oldCount, oldCount + 1));
+
+	trace->entries[oldCount].romClassOffset = (U_32)((UDATA)romClass - (UDATA)cacheDesc->cacheStartAddress);
+	trace->entries[oldCount].layer = layer;
+}
+
+/**
+ * This function stores the startup class trace recorded by this JVM to the shared cache, and stops recording.
+ * @param[in] currentThread  The current VM thread
+ * @return  The location of the cached data or null
+ */
+const U_8*
+storeStartupClassTraceToSharedCache(J9VMThread* currentThread)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+	J9SharedLocalStartupClassTrace* trace = &vm->sharedClassConfig->localStartupClassTrace;
+	const U_8* ret = NULL;
+
+	if (J9_ARE_ALL_BITS_SET(trace->flags, J9SHR_LOCAL_STARTUPCLASSTRACE_FLAG_RECORD)) {
+		UDATA count = OMR_MIN(trace->count, J9SHR_STARTUPCLASSTRACE_MAX_ENTRIES);
+
+		trace->flags &= ~(UDATA)J9SHR_LOCAL_STARTUPCLASSTRACE_FLAG_RECORD;
+		if (0 < count) {
+			char* key = generateStartupHintsKey(vm);
+
+			if (NULL != key) {
+				J9SharedDataDescriptor dataDescriptor = {0};
+				PORT_ACCESS_FROM_JAVAVM(vm);
+
+				dataDescriptor.address = (U_8*)trace->entries;
+				dataDescriptor.length = count * sizeof(J9SharedStartupClassTraceEntry);
+				dataDescriptor.type = J9SHR_DATA_TYPE_STARTUP_CLASSES;
+				dataDescriptor.flags = J9SHRDATA_SINGLE_STORE_FOR_KEY_TYPE;
+				ret = j9shr_storeSharedData(currentThread, key, strlen(key), &dataDescriptor);
+				if (NULL == ret) {
+					Trc_SHR_INIT_storeStartupClassTraceToSharedCache_Store_Failed(currentThread);
+				} else {
+					Trc_SHR_INIT_storeStartupClassTraceToSharedCache_Store_Successful(currentThread, count);
+					SHRINIT_TRACE1(J9_ARE_ALL_BITS_SET(vm->sharedClassConfig->verboseFlags, J9SHR_VERBOSEFLAG_ENABLE_VERBOSE), J9NLS_SHRC_SHRINIT_STARTUP_CLASS_TRACE_STORED, count);
+				}
+				j9mem_free_memory(key);
+			} else {
+				Trc_SHR_INIT_storeStartupClassTraceToSharedCache_Null_key(currentThread);
+			}
+		}
+	}
+	return ret;
+}
+
+/**
+ * Stops the startup class prefault thread, if it is running, and waits for it to exit.
+ * @param[in] vm  The current J9JavaVM
+ */
+void
+stopStartupClassPrefault(J9JavaVM* vm)
+{
+	J9SharedLocalStartupClassTrace* trace = &vm->sharedClassConfig->localStartupClassTrace;
+
+	if (NULL != trace->prefaultMonitor) {
+		omrthread_monitor_enter(trace->prefaultMonitor);
+		trace->flags |= J9SHR_LOCAL_STARTUPCLASSTRACE_FLAG_STOP_PREFAULT;
+		while (0 != trace->prefaultThreadRunning) {
+			omrthread_monitor_wait(trace->prefaultMonitor);
+		}
+		omrthread_monitor_exit(trace->prefaultMonitor);
+	}
+}
+
+/**
+ * Entry point of the startup class prefault thread. Reads a byte from each page of the ROM classes listed in the
+ * startup class trace, in the order they were loaded by the run that recorded the trace, so that the pages are
+ * mapped before the classes are loaded. Only the pages of the startup classes are touched, not the whole cache.
+ * @param[in] arg  The J9JavaVM
+ * @return 0
+ */
+static int J9THREAD_PROC
+startupClassPrefaultThreadMain(void* arg)
+{
+	J9JavaVM* vm = (J9JavaVM*)arg;
+	J9SharedLocalStartupClassTrace* trace = &vm->sharedClassConfig->localStartupClassTrace;
+	const U_8* lastPage = NULL;
+	UDATA pageSize = 0;
+	UDATA pagesTouched = 0;
+	UDATA classesTouched = 0;
+	I_64 startTime = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	pageSize = j9vmem_supported_page_sizes()[0];
+	startTime = j9time_hires_clock();
+
+	for (UDATA i = 0; i < trace->prefaultCount; i++) {
+		const J9SharedStartupClassTraceEntry* entry = &trace->prefaultEntries[i];
+		J9SharedClassCacheDescriptor* cacheDesc = NULL;
+
+		if (J9_ARE_ANY_BITS_SET(*(volatile UDATA*)&trace->flags, J9SHR_LOCAL_STARTUPCLASSTRACE_FLAG_STOP_PREFAULT)) {
+			break;
+		}
+		cacheDesc = getCacheDescriptorForLayer(vm, entry->layer);
+		if ((NULL != cacheDesc)
+			&& (entry->romClassOffset < cacheDesc->cacheSizeBytes)
+			&& (sizeof(J9ROMClass) <= (cacheDesc->cacheSizeBytes - entry->romClassOffset))
+		) {
+			const U_8* cacheEnd = (U_8*)cacheDesc->cacheStartAddress + cacheDesc->cacheSizeBytes;
+			const J9ROMClass* romClass = (J9ROMClass*)((U_8*)cacheDesc->cacheStartAddress + entry->romClassOffset);
+			const U_8* romClassEnd = cacheEnd;
+
+			/* The trace may be older than the cache, do not trust romSize to stay in the cache */
+			if (romClass->romSize <= (UDATA)(cacheEnd - (U_8*)romClass)) {
+				romClassEnd = (U_8*)romClass + romClass->romSize;
+			}
+			for (const U_8* page = (U_8*)((UDATA)romClass & ~(pageSize - 1)); page < romClassEnd; page += pageSize) {
+				if (page != lastPage) {
+					(void)*(volatile const U_8*)page;
+					lastPage = page;
+					pagesTouched += 1;
+				}
+			}
+			classesTouched += 1;
+		}
+	}
+
+	Trc_SHR_INIT_startupClassPrefaultThreadMain_Done(pagesTouched, classesTouched, trace->prefaultCount);
+	SHRINIT_TRACE3(J9_ARE_ALL_BITS_SET(vm->sharedClassConfig->verboseFlags, J9SHR_VERBOSEFLAG_ENABLE_VERBOSE), J9NLS_SHRC_SHRINIT_STARTUP_CLASSES_PREFAULTED,
+			pagesTouched, classesTouched, j9time_hires_delta(startTime, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS));
+
+	omrthread_monitor_enter(trace->prefaultMonitor);
+	trace->prefaultThreadRunning = 0;
+	omrthread_monitor_notify_all(trace->prefaultMonitor);
+	omrthread_exit(trace->prefaultMonitor);
+	/* NO GUARANTEED EXECUTION BEYOND THIS POINT */
+	return 0;
+}
+
 /**
  * Determine the directory to use for the cache file or control file(s)
  *
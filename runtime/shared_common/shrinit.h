@@ -72,6 +72,10 @@ void j9shr_jvmPhaseChange(J9VMThread* currentThread, UDATA phase);
 void j9shr_storeGCHints(J9VMThread* currentThread, UDATA heapSize1, UDATA heapSize2, BOOLEAN forceReplace);
 IDATA j9shr_findGCHints(J9VMThread* currentThread, UDATA *heapSize1, UDATA *heapSize2);
 const U_8* storeStartupHintsToSharedCache(J9VMThread* currentThread);
+void startStartupClassTrace(J9VMThread* currentThread);
+void recordStartupClass(J9VMThread* currentThread, const J9ROMClass* romClass);
+const U_8* storeStartupClassTraceToSharedCache(J9VMThread* currentThread);
+void stopStartupClassPrefault(J9JavaVM* vm);
 IDATA j9shr_getCacheDir(J9JavaVM* vm, const char* ctrlDirName, char* buffer, UDATA bufferSize, U_32 cacheType);
 U_32 getCacheTypeFromRuntimeFlags(U_64 runtimeFlags);
 
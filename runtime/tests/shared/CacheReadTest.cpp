@@ -0,0 +1,545 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+extern "C"
+{
+#include "shrinit.h"
+}
+#include "OpenCacheHelper.h"
+#include "Manager.hpp"
+#include "Managers.hpp"
+#include "UnitTest.hpp"
+#include "SCTestCommon.h"
+#include "main.h"
+
+#define CACHEREAD_TEST_CACHE_NAME "shrtestcacheread"
+#define CACHEREAD_TEST_LAYERS 2
+#define CACHEREAD_TEST_ITEMS 16
+#define CACHEREAD_TEST_MAX_RESULTS 4
+#define CACHEREAD_TEST_CLASS_NAME "CacheReadTest/Layer%d/Class%d"
+#define CACHEREAD_TEST_DATA_KEY "CacheReadTest/Layer%d/Data%d"
+#define CACHEREAD_TEST_DATA_VALUE "data %d of layer %d"
+#define CACHEREAD_TEST_COMMON_KEY "CacheReadTest/Common"
+#define CACHEREAD_TEST_COMMON_VALUE "common data of layer %d"
+/* More than the number of items a cache needs before it gets a lookup index */
+#define CACHEREAD_TEST_FILLER_CLASSES 1200
+#define CACHEREAD_TEST_FILLER_CLASS_NAME "CacheReadTest/Filler%d"
+
+extern "C"
+{
+	IDATA testCacheRead(J9JavaVM* vm);
+}
+
+/* The items found for one key */
+typedef struct CacheReadResult {
+	IDATA count;
+	U_32 fingerprints[CACHEREAD_TEST_MAX_RESULTS];
+} CacheReadResult;
+
+/* What the hashtables of a started cache return for the items stored by the test */
+typedef struct CacheReadSnapshot {
+	UDATA nonStaleItems[MAX_DATA_TYPES + 1];
+	UDATA staleItems[MAX_DATA_TYPES + 1];
+	CacheReadResult classes[CACHEREAD_TEST_LAYERS][CACHEREAD_TEST_ITEMS];
+	CacheReadResult data[CACHEREAD_TEST_LAYERS][CACHEREAD_TEST_ITEMS];
+	CacheReadResult commonData;
+	IDATA fillerClassesFound;
+} CacheReadSnapshot;
+
+class CacheReadTest : public OpenCacheHelper {
+public:
+	CacheReadTest(J9JavaVM* vm) :
+		OpenCacheHelper(vm)
+	{
+	}
+
+	IDATA openLayer(I_8 layer, IDATA unitTest);
+	void closeLayer(void);
+	IDATA destroyLayers(UDATA layerCount);
+	IDATA addItems(I_8 layer);
+	IDATA addFillerClasses(void);
+	IDATA takeSnapshot(UDATA layerCount, UDATA fillerClassCount, CacheReadSnapshot* snapshot);
+
+	static IDATA compareSnapshots(J9JavaVM* vm, UDATA layerCount, CacheReadSnapshot* expected, CacheReadSnapshot* actual);
+
+private:
+	void findClass(const char* name, CacheReadResult* result);
+	void findData(const char* key, J9Pool* descriptorPool, CacheReadResult* result);
+
+	static U_32 computeFingerprint(const U_8* data, UDATA length);
+	static IDATA compareResults(J9JavaVM* vm, const char* name, CacheReadResult* expected, CacheReadResult* actual, IDATA expectedCount);
+};
+
+IDATA
+CacheReadTest::openLayer(I_8 layer, IDATA unitTest)
+{
+	const char *testName = "openLayer";
+	J9SharedClassConfig *config = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	config = (J9SharedClassConfig *)j9mem_allocate_memory(sizeof(J9SharedClassConfig) + sizeof(J9SharedClassCacheDescriptor), J9MEM_CATEGORY_CLASSES);
+	if (NULL == config) {
+		ERRPRINTF("failed to allocate memory for J9SharedClassConfig\n");
+		return FAIL;
+	}
+	memset(config, 0, sizeof(J9SharedClassConfig) + sizeof(J9SharedClassCacheDescriptor));
+	config->layer = layer;
+
+	return openTestCache(J9PORT_SHR_CACHE_TYPE_PERSISTENT, CACHE_SIZE, CACHEREAD_TEST_CACHE_NAME, false, NULL, NULL, NULL, 0,
+			(J9SHR_RUNTIMEFLAG_ENABLE_MPROTECT | J9SHR_RUNTIMEFLAG_ENABLE_MPROTECT_RW), unitTest,
+			J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, testName, false, true, NULL, config);
+}
+
+/**
+ * Shuts the cache down without destroying it, so that it can be started again
+ */
+void
+CacheReadTest::closeLayer(void)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (NULL != cacheMap) {
+		cacheMap->cleanup(vm->mainThread);
+		j9mem_free_memory(cacheMap);
+		cacheMap = NULL;
+	}
+	if (NULL != sharedClassConfig) {
+		vm->sharedClassConfig = origSharedClassConfig;
+		j9mem_free_memory(sharedClassConfig);
+		sharedClassConfig = NULL;
+	}
+	if (NULL != piConfig) {
+		vm->sharedClassPreinitConfig = origPiConfig;
+		j9mem_free_memory(piConfig);
+		piConfig = NULL;
+	}
+}
+
+IDATA
+CacheReadTest::destroyLayers(UDATA layerCount)
+{
+	const char *testName = "destroyLayers";
+	IDATA rc = PASS;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	/* Each call destroys the top layer */
+	for (UDATA i = 0; i < layerCount; i++) {
+		IDATA destroyRC = j9shr_destroySharedCache(vm, NULL, CACHEREAD_TEST_CACHE_NAME, J9PORT_SHR_CACHE_TYPE_PERSISTENT, false);
+
+		if (J9SH_DESTROYED_ALL_CACHE != destroyRC) {
+			ERRPRINTF1("j9shr_destroySharedCache()=%zd\n", destroyRC);
+			rc = FAIL;
+		}
+	}
+	return rc;
+}
+
+/**
+ * Stores a ROMClass and a byte data item for each index, and the byte data item stored in every layer
+ */
+IDATA
+CacheReadTest::addItems(I_8 layer)
+{
+	const char *testName = "addItems";
+	char name[64];
+	char value[64];
+	J9SharedDataDescriptor data;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	for (I_32 i = 0; i < CACHEREAD_TEST_ITEMS; i++) {
+		j9str_printf(PORTLIB, name, sizeof(name), CACHEREAD_TEST_CLASS_NAME, layer, i);
+		/* Each ROMClass has a different size, which identifies it when it is found */
+		if (PASS != addDummyROMClass(name, 1024 + (8 * ((layer * CACHEREAD_TEST_ITEMS) + i)))) {
+			ERRPRINTF1("failed to store ROMClass %s\n", name);
+			return FAIL;
+		}
+
+		j9str_printf(PORTLIB, name, sizeof(name), CACHEREAD_TEST_DATA_KEY, layer, i);
+		j9str_printf(PORTLIB, value, sizeof(value), CACHEREAD_TEST_DATA_VALUE, i, layer);
+		data.address = (U_8*)value;
+		data.length = strlen(value);
+		data.type = J9SHR_DATA_TYPE_HELPER;
+		data.flags = 0;
+		if (NULL == cacheMap->storeSharedData(vm->mainThread, name, strlen(name), &data)) {
+			ERRPRINTF1("failed to store data %s\n", name);
+			return FAIL;
+		}
+	}
+
+	j9str_printf(PORTLIB, value, sizeof(value), CACHEREAD_TEST_COMMON_VALUE, layer);
+	data.address = (U_8*)value;
+	data.length = strlen(value);
+	data.type = J9SHR_DATA_TYPE_HELPER;
+	data.flags = 0;
+	if (NULL == cacheMap->storeSharedData(vm->mainThread, CACHEREAD_TEST_COMMON_KEY, strlen(CACHEREAD_TEST_COMMON_KEY), &data)) {
+		ERRPRINTF1("failed to store data %s\n", CACHEREAD_TEST_COMMON_KEY);
+		return FAIL;
+	}
+	return PASS;
+}
+
+/**
+ * Stores enough small ROMClasses for the cache to be given a lookup index
+ */
+IDATA
+CacheReadTest::addFillerClasses(void)
+{
+	const char *testName = "addFillerClasses";
+	char name[64];
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	for (I_32 i = 0; i < CACHEREAD_TEST_FILLER_CLASSES; i++) {
+		j9str_printf(PORTLIB, name, sizeof(name), CACHEREAD_TEST_FILLER_CLASS_NAME, i);
+		if (PASS != addDummyROMClass(name, 256)) {
+			ERRPRINTF1("failed to store ROMClass %s\n", name);
+			return FAIL;
+		}
+	}
+	return PASS;
+}
+
+U_32
+CacheReadTest::computeFingerprint(const U_8* data, UDATA length)
+{
+	U_32 fingerprint = 0;
+
+	for (UDATA i = 0; i < length; i++) {
+		fingerprint = (fingerprint * 31) + data[i];
+	}
+	return fingerprint;
+}
+
+void
+CacheReadTest::findClass(const char* name, CacheReadResult* result)
+{
+	void *findNextIterator = NULL;
+	void *firstFound = NULL;
+	const J9ROMClass *romClass = cacheMap->findNextROMClass(vm->mainThread, findNextIterator, firstFound, (U_16)strlen(name), name);
+
+	while (NULL != romClass) {
+		if (result->count < CACHEREAD_TEST_MAX_RESULTS) {
+			result->fingerprints[result->count] = romClass->romSize;
+		}
+		result->count += 1;
+		romClass = cacheMap->findNextROMClass(vm->mainThread, findNextIterator, firstFound, (U_16)strlen(name), name);
+	}
+}
+
+void
+CacheReadTest::findData(const char* key, J9Pool* descriptorPool, CacheReadResult* result)
+{
+	pool_state state;
+	J9SharedDataDescriptor *walk = NULL;
+	IDATA index = 0;
+
+	pool_clear(descriptorPool);
+	result->count = cacheMap->findSharedData(vm->mainThread, key, strlen(key), 0, FALSE, NULL, descriptorPool);
+
+	walk = (J9SharedDataDescriptor *)pool_startDo(descriptorPool, &state);
+	while ((NULL != walk) && (index < CACHEREAD_TEST_MAX_RESULTS)) {
+		result->fingerprints[index] = computeFingerprint(walk->address, walk->length);
+		index += 1;
+		walk = (J9SharedDataDescriptor *)pool_nextDo(&state);
+	}
+}
+
+/**
+ * Records the number of items in each manager hashtable, and what each lookup of the items stored by addItems() returns
+ */
+IDATA
+CacheReadTest::takeSnapshot(UDATA layerCount, UDATA fillerClassCount, CacheReadSnapshot* snapshot)
+{
+	const char *testName = "takeSnapshot";
+	char name[64];
+	J9Pool *descriptorPool = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	memset(snapshot, 0, sizeof(CacheReadSnapshot));
+	descriptorPool = pool_new(sizeof(J9SharedDataDescriptor), 0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_CLASSES, POOL_FOR_PORT(PORTLIB));
+	if (NULL == descriptorPool) {
+		ERRPRINTF("failed to allocate descriptor pool\n");
+		return FAIL;
+	}
+
+	/* The items found through a lookup are counted first, as a lookup index may load them into the hashtables */
+	omrthread_monitor_enter(vm->classMemorySegments->segmentMutex);
+	for (I_32 layer = 0; layer < (I_32)layerCount; layer++) {
+		for (I_32 i = 0; i < CACHEREAD_TEST_ITEMS; i++) {
+			j9str_printf(PORTLIB, name, sizeof(name), CACHEREAD_TEST_CLASS_NAME, layer, i);
+			findClass(name, &snapshot->classes[layer][i]);
+			j9str_printf(PORTLIB, name, sizeof(name), CACHEREAD_TEST_DATA_KEY, layer, i);
+			findData(name, descriptorPool, &snapshot->data[layer][i]);
+		}
+	}
+	for (I_32 i = 0; i < (I_32)fillerClassCount; i++) {
+		CacheReadResult result;
+
+		memset(&result, 0, sizeof(result));
+		j9str_printf(PORTLIB, name, sizeof(name), CACHEREAD_TEST_FILLER_CLASS_NAME, i);
+		findClass(name, &result);
+		snapshot->fillerClassesFound += result.count;
+	}
+	omrthread_monitor_exit(vm->classMemorySegments->segmentMutex);
+	findData(CACHEREAD_TEST_COMMON_KEY, descriptorPool, &snapshot->commonData);
+	pool_kill(descriptorPool);
+
+	for (UDATA type = TYPE_UNINITIALIZED + 1; type <= MAX_DATA_TYPES; type++) {
+		SH_Manager *manager = cacheMap->managers()->getManagerForDataType(type);
+
+		if (NULL != manager) {
+			manager->getNumItems(vm->mainThread, &snapshot->nonStaleItems[type], &snapshot->staleItems[type]);
+		}
+	}
+	return PASS;
+}
+
+IDATA
+CacheReadTest::compareResults(J9JavaVM* vm, const char* name, CacheReadResult* expected, CacheReadResult* actual, IDATA expectedCount)
+{
+	const char *testName = "compareResults";
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (expectedCount != expected->count) {
+		ERRPRINTF3("%s: expected %zd items, the reference read found %zd\n", name, expectedCount, expected->count);
+		return FAIL;
+	}
+	if (expected->count != actual->count) {
+		ERRPRINTF3("%s: expected %zd items, found %zd\n", name, expected->count, actual->count);
+		return FAIL;
+	}
+	for (IDATA i = 0; (i < expected->count) && (i < CACHEREAD_TEST_MAX_RESULTS); i++) {
+		if (expected->fingerprints[i] != actual->fingerprints[i]) {
+			ERRPRINTF2("%s: item %zd is not the one found by the reference read\n", name, i);
+			return FAIL;
+		}
+	}
+	return PASS;
+}
+
+/**
+ * Checks that a cache returns the same items, in the same order, as the reference read of the same cache
+ */
+IDATA
+CacheReadTest::compareSnapshots(J9JavaVM* vm, UDATA layerCount, CacheReadSnapshot* expected, CacheReadSnapshot* actual)
+{
+	const char *testName = "compareSnapshots";
+	char name[64];
+	IDATA rc = PASS;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	for (UDATA type = TYPE_UNINITIALIZED + 1; type <= MAX_DATA_TYPES; type++) {
+		if ((expected->nonStaleItems[type] != actual->nonStaleItems[type])
+			|| (expected->staleItems[type] != actual->staleItems[type])
+		) {
+			ERRPRINTF5("type %zu: expected %zu items and %zu stale items, found %zu and %zu\n", type,
+					expected->nonStaleItems[type], expected->staleItems[type], actual->nonStaleItems[type], actual->staleItems[type]);
+			rc = FAIL;
+		}
+	}
+	for (I_32 layer = 0; layer < (I_32)layerCount; layer++) {
+		for (I_32 i = 0; i < CACHEREAD_TEST_ITEMS; i++) {
+			j9str_printf(PORTLIB, name, sizeof(name), CACHEREAD_TEST_CLASS_NAME, layer, i);
+			rc |= compareResults(vm, name, &expected->classes[layer][i], &actual->classes[layer][i], 1);
+			j9str_printf(PORTLIB, name, sizeof(name), CACHEREAD_TEST_DATA_KEY, layer, i);
+			rc |= compareResults(vm, name, &expected->data[layer][i], &actual->data[layer][i], 1);
+		}
+	}
+	rc |= compareResults(vm, CACHEREAD_TEST_COMMON_KEY, &expected->commonData, &actual->commonData, (IDATA)layerCount);
+	if (expected->fillerClassesFound != actual->fillerClassesFound) {
+		ERRPRINTF2("expected %zd filler classes, found %zd\n", expected->fillerClassesFound, actual->fillerClassesFound);
+		rc = FAIL;
+	}
+	return rc;
+}
+
+/**
+ * Reads a layered cache with readCache() one layer at a time, then on the startup helper threads,
+ * and checks that the hashtables return the same items.
+ */
+static IDATA
+layeredReadTest(J9JavaVM* vm)
+{
+	const char *testName = "layeredReadTest";
+	CacheReadTest crt(vm);
+	CacheReadSnapshot *serial = NULL;
+	CacheReadSnapshot *parallel = NULL;
+	IDATA rc = PASS;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	serial = (CacheReadSnapshot *)j9mem_allocate_memory(2 * sizeof(CacheReadSnapshot), J9MEM_CATEGORY_CLASSES);
+	if (NULL == serial) {
+		ERRPRINTF("failed to allocate memory for the snapshots\n");
+		return FAIL;
+	}
+	parallel = serial + 1;
+
+	rc = crt.destroyLayers(CACHEREAD_TEST_LAYERS);
+	for (I_8 layer = 0; (PASS == rc) && (layer < CACHEREAD_TEST_LAYERS); layer++) {
+		rc = crt.openLayer(layer, UnitTest::NO_TEST);
+		if (PASS != rc) {
+			ERRPRINTF1("failed to create layer %d\n", layer);
+			goto done;
+		}
+		rc = crt.addItems(layer);
+		crt.closeLayer();
+	}
+	if (PASS != rc) {
+		goto done;
+	}
+
+	rc = crt.openLayer(CACHEREAD_TEST_LAYERS - 1, UnitTest::LAYERED_CACHE_SERIAL_READ_TEST);
+	if (PASS != rc) {
+		ERRPRINTF("failed to start the cache with a serial read\n");
+		goto done;
+	}
+	rc = crt.takeSnapshot(CACHEREAD_TEST_LAYERS, 0, serial);
+	crt.closeLayer();
+	if (PASS != rc) {
+		goto done;
+	}
+
+	rc = crt.openLayer(CACHEREAD_TEST_LAYERS - 1, UnitTest::NO_TEST);
+	if (PASS != rc) {
+		ERRPRINTF("failed to start the cache with startup helper threads\n");
+		goto done;
+	}
+	rc = crt.takeSnapshot(CACHEREAD_TEST_LAYERS, 0, parallel);
+	crt.closeLayer();
+	if (PASS != rc) {
+		goto done;
+	}
+
+	rc = CacheReadTest::compareSnapshots(vm, CACHEREAD_TEST_LAYERS, serial, parallel);
+
+done:
+	UnitTest::unitTest = UnitTest::NO_TEST;
+	if (PASS != crt.destroyLayers(CACHEREAD_TEST_LAYERS)) {
+		rc = FAIL;
+	}
+	j9mem_free_memory(serial);
+	return rc;
+}
+
+/**
+ * Has the exit code build a lookup index for a cache, then reads the cache once ignoring the index and once
+ * through it, and checks that the hashtables return the same items.
+ * The dummy ROMClasses have no classpath, so they are found with findNextROMClass() rather than findROMClass().
+ */
+static IDATA
+lookupIndexTest(J9JavaVM* vm)
+{
+	const char *testName = "lookupIndexTest";
+	CacheReadTest crt(vm);
+	CacheReadSnapshot *unindexed = NULL;
+	CacheReadSnapshot *indexed = NULL;
+	SH_CompositeCacheImpl *cc = NULL;
+	IDATA rc = PASS;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	unindexed = (CacheReadSnapshot *)j9mem_allocate_memory(2 * sizeof(CacheReadSnapshot), J9MEM_CATEGORY_CLASSES);
+	if (NULL == unindexed) {
+		ERRPRINTF("failed to allocate memory for the snapshots\n");
+		return FAIL;
+	}
+	indexed = unindexed + 1;
+
+	rc = crt.destroyLayers(1);
+	if (PASS == rc) {
+		rc = crt.openLayer(0, UnitTest::NO_TEST);
+		if (PASS != rc) {
+			ERRPRINTF("failed to create the cache\n");
+			goto done;
+		}
+		rc = crt.addItems(0);
+		if (PASS == rc) {
+			rc = crt.addFillerClasses();
+		}
+		/* Build the lookup index as a JVM does on exit */
+		if (PASS == rc) {
+			crt.cacheMap->runExitCode(vm->mainThread);
+		}
+		crt.closeLayer();
+	}
+	if (PASS != rc) {
+		goto done;
+	}
+
+	rc = crt.openLayer(0, UnitTest::LOOKUP_INDEX_UNUSED_TEST);
+	if (PASS != rc) {
+		ERRPRINTF("failed to start the cache without its lookup index\n");
+		goto done;
+	}
+	cc = (SH_CompositeCacheImpl *)crt.cacheMap->getCompositeCacheAPI();
+	if (NULL == cc->getLookupIndex(vm->mainThread)) {
+		ERRPRINTF("the exit code did not build a lookup index\n");
+		rc = FAIL;
+	}
+	if (PASS == rc) {
+		rc = crt.takeSnapshot(1, CACHEREAD_TEST_FILLER_CLASSES, unindexed);
+	}
+	crt.closeLayer();
+	if (PASS != rc) {
+		goto done;
+	}
+
+	rc = crt.openLayer(0, UnitTest::NO_TEST);
+	if (PASS != rc) {
+		ERRPRINTF("failed to start the cache with its lookup index\n");
+		goto done;
+	}
+	rc = crt.takeSnapshot(1, CACHEREAD_TEST_FILLER_CLASSES, indexed);
+	crt.closeLayer();
+	if (PASS != rc) {
+		goto done;
+	}
+
+	rc = CacheReadTest::compareSnapshots(vm, 1, unindexed, indexed);
+	if (CACHEREAD_TEST_FILLER_CLASSES != unindexed->fillerClassesFound) {
+		ERRPRINTF2("expected %d filler classes, the unindexed read found %zd\n", CACHEREAD_TEST_FILLER_CLASSES, unindexed->fillerClassesFound);
+		rc = FAIL;
+	}
+
+done:
+	UnitTest::unitTest = UnitTest::NO_TEST;
+	if (PASS != crt.destroyLayers(1)) {
+		rc = FAIL;
+	}
+	j9mem_free_memory(unindexed);
+	return rc;
+}
+
+IDATA
+testCacheRead(J9JavaVM* vm)
+{
+	UDATA success = PASS;
+	UDATA rc = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	REPORT_START("CacheRead");
+
+	SHC_TEST_ASSERT("layeredRead", layeredReadTest(vm), success, rc);
+	SHC_TEST_ASSERT("lookupIndex", lookupIndexTest(vm), success, rc);
+
+	REPORT_SUMMARY("CacheRead", success);
+
+	return success;
+}
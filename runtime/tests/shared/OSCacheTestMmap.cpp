@@ -27,8 +27,11 @@ extern "C" {
 
 #include "main.h"
 #include "OSCachemmap.hpp"
+#include "CompositeCacheImpl.hpp"
 #include "ProcessHelper.h"
+#include "UnitTest.hpp"
 #include "j2sever.h"
+#include "util_api.h"
 #include <string.h>
 
 extern "C" {
@@ -833,6 +836,257 @@ cleanup:
 	return rc;
 }
 
+#define OSCACHETEST_READMUTEX_NAME "testReadMutex"
+#define READMUTEX_LAUNCH_SEMAPHORE "testReadMutex"
+#define READMUTEX_TIMES_FILE "testReadMutex.times"
+#define READMUTEX_ITERATIONS 1000000
+
+/**
+ * Launches the read mutex children, lets them run together and waits for them. Each child appends the
+ * time it took to the times file, and the longest time is returned in slowest.
+ */
+static IDATA
+runReadMutexChildren(J9PortLibrary *portLibrary, struct j9cmdlineOptions *arg, const char *option, IDATA semhandle, const char *timesFile, U_64 *slowest)
+{
+	PORT_ACCESS_FROM_PORT(portLibrary);
+	IDATA rc = PASS;
+	J9ProcessHandle pid[MAX_PROCESS];
+	char * childargv[SHRTEST_MAX_CMD_OPTS];
+	UDATA childargc = 0;
+	char times[256];
+	IDATA fd = -1;
+	IDATA bytesRead = 0;
+	UDATA reported = 0;
+
+	*slowest = 0;
+	j9file_unlink(timesFile);
+
+	childargc = buildChildCmdlineOption(arg->argc, arg->argv, option, childargv);
+	for (UDATA i = 0; i < MAX_PROCESS; i++) {
+		pid[i] = LaunchChildProcess(PORTLIB, "testReadMutex", childargv, childargc);
+		if (NULL == pid[i]) {
+			j9tty_printf(PORTLIB, "testReadMutex: failed to launch child process\n");
+			/* Let the children already launched finish */
+			ReleaseLaunchSemaphore(PORTLIB, semhandle, i);
+			for (UDATA j = 0; j < i; j++) {
+				WaitForTestProcess(PORTLIB, pid[j]);
+			}
+			return FAIL;
+		}
+	}
+
+	/* Let all the children start together */
+	ReleaseLaunchSemaphore(PORTLIB, semhandle, MAX_PROCESS);
+
+	for (UDATA i = 0; i < MAX_PROCESS; i++) {
+		if (PASS != WaitForTestProcess(PORTLIB, pid[i])) {
+			j9tty_printf(PORTLIB, "testReadMutex: child process %zu reported failure\n", i);
+			rc = FAIL;
+		}
+	}
+
+	fd = j9file_open(timesFile, EsOpenRead, 0);
+	if (-1 == fd) {
+		j9tty_printf(PORTLIB, "testReadMutex: cannot open %s\n", timesFile);
+		return FAIL;
+	}
+	bytesRead = j9file_read(fd, times, sizeof(times) - 1);
+	j9file_close(fd);
+	j9file_unlink(timesFile);
+	if (bytesRead > 0) {
+		char *cursor = times;
+
+		times[bytesRead] = '\0';
+		while ('\0' != *cursor) {
+			U_64 elapsed = 0;
+
+			if (0 != scan_u64(&cursor, &elapsed)) {
+				break;
+			}
+			*slowest = OMR_MAX(*slowest, elapsed);
+			reported += 1;
+			while ('\n' == *cursor) {
+				cursor += 1;
+			}
+		}
+	}
+	if (MAX_PROCESS != reported) {
+		j9tty_printf(PORTLIB, "testReadMutex: %zu of %zu children reported their time\n", reported, (UDATA)MAX_PROCESS);
+		rc = FAIL;
+	}
+	return rc;
+}
+
+/**
+ * This test starts multiple child processes which attach to the same cache and repeatedly
+ * enter and exit the composite cache read mutex, timing themselves. The children are run twice:
+ * first with every process counted in the same reader slot, which is how a single reader count
+ * in the cache header behaved, then with each process in its own slot. The slowest child of
+ * each run is reported so the two can be compared. The timings are not checked, as they depend
+ * on the machine. Once all children exit, the reader count must be back to 0.
+ */
+IDATA
+SH_OSCacheTestMmap::testReadMutex(J9PortLibrary *portLibrary, J9JavaVM *vm, struct j9cmdlineOptions *arg, UDATA child, bool sharedSlot)
+{
+	PORT_ACCESS_FROM_PORT(portLibrary);
+	IDATA rc = FAIL;
+	SH_OSCachemmap *osc = NULL;
+	SH_CompositeCacheImpl *cc = NULL;
+	char cacheDir[J9SH_MAXPATH];
+	char timesFile[J9SH_MAXPATH];
+	J9SharedClassPreinitConfig *piconfig = NULL;
+	J9PortShcVersion versionData;
+	IDATA semhandle = -1;
+	BlockPtr data = NULL;
+	U_64 runtimeFlags = 0;
+	UDATA cacheSize = 0;
+	UDATA localCrashCntr = 0;
+	bool cacheHasIntegrity = false;
+	U_64 sharedSlotMicros = 0;
+	U_64 ownSlotMicros = 0;
+	U_32 flags = J9SHMEM_GETDIR_APPEND_BASEDIR;
+
+#if defined(OPENJ9_BUILD)
+	flags |= J9SHMEM_GETDIR_USE_USERHOME;
+#endif /* defined(OPENJ9_BUILD) */
+
+	setCurrentCacheVersion(vm, J2SE_CURRENT_VERSION, &versionData);
+	versionData.cacheType = J9PORT_SHR_CACHE_TYPE_PERSISTENT;
+
+	if (NULL == (piconfig = (J9SharedClassPreinitConfig *)j9mem_allocate_memory(sizeof(J9SharedClassPreinitConfig), J9MEM_CATEGORY_CLASSES))) {
+		j9tty_printf(PORTLIB, "testReadMutex: failed J9SharedClassPreinitConfig malloc\n");
+		goto cleanup;
+	}
+	memset(piconfig, 0, sizeof(*piconfig));
+	piconfig->sharedClassDebugAreaBytes = -1;
+	piconfig->sharedClassCacheSize = SHM_REGIONSIZE;
+
+	if (j9shmem_getDir(NULL, flags, cacheDir, J9SH_MAXPATH) < 0) {
+		goto cleanup;
+	}
+	j9str_printf(PORTLIB, timesFile, J9SH_MAXPATH, "%s%s", cacheDir, READMUTEX_TIMES_FILE);
+
+	semhandle = openLaunchSemaphore(PORTLIB, READMUTEX_LAUNCH_SEMAPHORE, MAX_PROCESS);
+	if (-1 == semhandle) {
+		j9tty_printf(PORTLIB, "testReadMutex: cannot open launch control semaphores\n");
+		goto cleanup;
+	}
+
+	if (child) {
+		/* Wait until the parent has initialized the cache header */
+		WaitForLaunchSemaphore(PORTLIB, semhandle);
+		if (sharedSlot) {
+			UnitTest::unitTest = UnitTest::READER_SLOT_SHARED_TEST;
+		}
+	} else {
+		/* Ensure there is no cache left over from a previous run */
+		osc = new(j9mem_allocate_memory(SH_OSCache::getRequiredConstrBytes(), J9MEM_CATEGORY_CLASSES)) SH_OSCachemmap(PORTLIB, vm, cacheDir, OSCACHETEST_READMUTEX_NAME, piconfig, 1, J9SH_OSCACHE_CREATE, 1, 0, 0, &versionData, NULL);
+		if (osc->getError() != J9SH_OSCACHE_FAILURE) {
+			osc->destroy(false);
+		}
+		j9mem_free_memory(osc);
+	}
+
+	osc = new(j9mem_allocate_memory(SH_OSCache::getRequiredConstrBytes(), J9MEM_CATEGORY_CLASSES)) SH_OSCachemmap(PORTLIB, vm, cacheDir, OSCACHETEST_READMUTEX_NAME, piconfig, 1, J9SH_OSCACHE_CREATE, 1, 0, 0, &versionData, NULL);
+	if (osc->getError() < 0) {
+		j9tty_printf(PORTLIB, "testReadMutex: cannot open oscache area\n");
+		goto cleanup;
+	}
+	if (NULL == (data = (BlockPtr)osc->attach(SH_OSCacheTestMmap::currentThread, &versionData))) {
+		j9tty_printf(PORTLIB, "testReadMutex: cannot attach to cache\n");
+		goto cleanup;
+	}
+
+	/* The composite cache initializes the header on first startup and reuses it in the children */
+	piconfig->sharedClassCacheSize = osc->getDataSize();
+	cc = SH_CompositeCacheImpl::newInstance(vm, NULL, (SH_CompositeCacheImpl *)j9mem_allocate_memory(SH_CompositeCacheImpl::getRequiredConstrBytesWithCommonInfo(false, false), J9MEM_CATEGORY_CLASSES), OSCACHETEST_READMUTEX_NAME, false, false, 0);
+	if (0 != cc->startup(SH_OSCacheTestMmap::currentThread, piconfig, data, &runtimeFlags, 1, OSCACHETEST_READMUTEX_NAME, NULL, J9SH_DIRPERM_ABSENT, &cacheSize, &localCrashCntr, true, &cacheHasIntegrity)) {
+		j9tty_printf(PORTLIB, "testReadMutex: composite cache startup failed\n");
+		goto cleanup;
+	}
+
+	if (child) {
+		I_64 start = 0;
+		U_64 elapsed = 0;
+		char line[32];
+		IDATA fd = -1;
+
+		if (0 != cc->enterReadMutex(SH_OSCacheTestMmap::currentThread, "testReadMutex")) {
+			j9tty_printf(PORTLIB, "testReadMutex: child failed to enter read mutex\n");
+			goto cleanup;
+		}
+		if (0 == cc->getReaderCount(SH_OSCacheTestMmap::currentThread)) {
+			j9tty_printf(PORTLIB, "testReadMutex: reader count is 0 while holding the read mutex\n");
+			cc->exitReadMutex(SH_OSCacheTestMmap::currentThread, "testReadMutex");
+			goto cleanup;
+		}
+		cc->exitReadMutex(SH_OSCacheTestMmap::currentThread, "testReadMutex");
+
+		start = j9time_hires_clock();
+		for (UDATA i = 0; i < READMUTEX_ITERATIONS; i++) {
+			if (0 != cc->enterReadMutex(SH_OSCacheTestMmap::currentThread, "testReadMutex")) {
+				j9tty_printf(PORTLIB, "testReadMutex: child failed to enter read mutex\n");
+				goto cleanup;
+			}
+			cc->exitReadMutex(SH_OSCacheTestMmap::currentThread, "testReadMutex");
+		}
+		elapsed = j9time_hires_delta(start, j9time_hires_clock(), J9PORT_TIME_DELTA_IN_MICROSECONDS);
+		j9tty_printf(PORTLIB, "testReadMutex: child %zu entered the read mutex %zu times in %llu us\n", j9sysinfo_get_pid(), (UDATA)READMUTEX_ITERATIONS, elapsed);
+
+		/* Appends of one short line are atomic, so the children can share the file */
+		fd = j9file_open(timesFile, EsOpenWrite | EsOpenCreate | EsOpenAppend, 0666);
+		if (-1 == fd) {
+			j9tty_printf(PORTLIB, "testReadMutex: cannot open %s\n", timesFile);
+			goto cleanup;
+		}
+		j9str_printf(PORTLIB, line, sizeof(line), "%llu\n", elapsed);
+		if ((IDATA)strlen(line) == j9file_write(fd, line, strlen(line))) {
+			rc = PASS;
+		}
+		j9file_close(fd);
+		goto cleanup;
+	}
+
+	/* Parent */
+	rc = runReadMutexChildren(PORTLIB, arg, (OSCACHETEST_CMDLINE_STARTSWITH OSCACHETESTMMAP_CMDLINE_READMUTEXSHARED), semhandle, timesFile, &sharedSlotMicros);
+	if (PASS == rc) {
+		rc = runReadMutexChildren(PORTLIB, arg, (OSCACHETEST_CMDLINE_STARTSWITH OSCACHETESTMMAP_CMDLINE_READMUTEX), semhandle, timesFile, &ownSlotMicros);
+	}
+	if (PASS == rc) {
+		j9tty_printf(PORTLIB, "testReadMutex: slowest of %zu processes entering the read mutex %zu times: %llu us in one reader slot, %llu us in their own slots\n",
+				(UDATA)MAX_PROCESS, (UDATA)READMUTEX_ITERATIONS, sharedSlotMicros, ownSlotMicros);
+	}
+
+	if (0 != cc->getReaderCount(SH_OSCacheTestMmap::currentThread)) {
+		j9tty_printf(PORTLIB, "testReadMutex: reader count is %zu after all children exited\n", cc->getReaderCount(SH_OSCacheTestMmap::currentThread));
+		rc = FAIL;
+	}
+
+cleanup:
+	if (NULL != cc) {
+		cc->cleanup(SH_OSCacheTestMmap::currentThread);
+		j9mem_free_memory(cc);
+	}
+	if (NULL != osc) {
+		if (!child) {
+			osc->destroy(false);
+		}
+		j9mem_free_memory(osc);
+	}
+	if (-1 != semhandle) {
+		CloseLaunchSemaphore(PORTLIB, semhandle);
+	}
+	j9mem_free_memory(piconfig);
+	if (sharedSlot) {
+		UnitTest::unitTest = UnitTest::OSCACHE_TEST;
+	}
+
+	if (!child) {
+		j9tty_printf(PORTLIB, "testReadMutex: %s\n", PASS==rc?"PASS":"FAIL");
+	}
+	return rc;
+}
+
 IDATA
 SH_OSCacheTestMmap::runTests(J9JavaVM* vm, struct j9cmdlineOptions* arg, const char *cmdline)
 {
@@ -851,6 +1105,10 @@ SH_OSCacheTestMmap::runTests(J9JavaVM* vm, struct j9cmdlineOptions* arg, const c
 			return testMutex(PORTLIB, vm, arg, 1);
 		} else if(NULL != strstr(cmdline, OSCACHETESTMMAP_CMDLINE_DESTROY)) {
 			return testDestroy(PORTLIB, vm, arg, 1);
+		} else if(NULL != strstr(cmdline, OSCACHETESTMMAP_CMDLINE_READMUTEXSHARED)) {
+			return testReadMutex(PORTLIB, vm, arg, 1, true);
+		} else if(NULL != strstr(cmdline, OSCACHETESTMMAP_CMDLINE_READMUTEX)) {
+			return testReadMutex(PORTLIB, vm, arg, 1, false);
 		}
 	}
 	
@@ -880,5 +1138,8 @@ SH_OSCacheTestMmap::runTests(J9JavaVM* vm, struct j9cmdlineOptions* arg, const c
 	j9tty_printf(PORTLIB, "testDestroy begin\n");
 	rc |= testDestroy(PORTLIB, vm, arg, 0);
 
+	j9tty_printf(PORTLIB, "testReadMutex begin\n");
+	rc |= testReadMutex(PORTLIB, vm, arg, 0, false);
+
 	return rc;
 }
@@ -38,6 +38,8 @@ extern "C" {
 #define OSCACHETESTMMAP_CMDLINE_MUTEX OSCACHETESTMMAP_CMDLINE_PREFIX "mutex"
 #define OSCACHETESTMMAP_CMDLINE_MUTEXHANG OSCACHETESTMMAP_CMDLINE_PREFIX "mutexhang"
 #define OSCACHETESTMMAP_CMDLINE_DESTROY OSCACHETESTMMAP_CMDLINE_PREFIX "destroy"
+#define OSCACHETESTMMAP_CMDLINE_READMUTEX OSCACHETESTMMAP_CMDLINE_PREFIX "readmutex"
+#define OSCACHETESTMMAP_CMDLINE_READMUTEXSHARED OSCACHETESTMMAP_CMDLINE_PREFIX "readmutexshared"
 
 #define CACHE_SIZE 1024*1024
 
@@ -59,6 +61,7 @@ private:
 	static IDATA testMutex(J9PortLibrary* portLibrary, J9JavaVM *vm, struct j9cmdlineOptions* arg, UDATA child);
 	static IDATA testMutexHang(J9PortLibrary* portLibrary, J9JavaVM *vm, struct j9cmdlineOptions* arg, UDATA child);
 	static IDATA testDestroy(J9PortLibrary* portLibrary, J9JavaVM *vm, struct j9cmdlineOptions* arg, UDATA child);
+	static IDATA testReadMutex(J9PortLibrary* portLibrary, J9JavaVM *vm, struct j9cmdlineOptions* arg, UDATA child, bool sharedSlot);
 };
 
 #endif /* OSCACHETESTMMAP_HPP_INCLUDED */
@@ -0,0 +1,326 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/* Includes */
+
+extern "C"
+{
+#include "shrinit.h"
+}
+#include "UnitTest.hpp"
+#include "SCTestCommon.h"
+#include "main.h"
+
+typedef char* BlockPtr;
+/* Exports */
+extern "C"
+{
+	IDATA testStartupClassTrace(J9JavaVM* vm);
+}
+
+#define STARTUP_CLASS_TRACE_TEST_VALID_ENTRIES 2
+#define STARTUP_CLASS_TRACE_TEST_GARBAGE_ENTRIES 4
+
+/* Function prototypes */
+IDATA storeAndFindTraceTest(J9JavaVM* vm);
+
+/* Main test function */
+IDATA testStartupClassTrace(J9JavaVM* vm)
+{
+	UDATA rc = FAIL;
+
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	REPORT_START("Test Startup Class Trace");
+
+	UnitTest::unitTest = UnitTest::STARTUP_CLASS_TRACE_TEST;
+
+	rc = storeAndFindTraceTest(vm);
+
+	UnitTest::unitTest = UnitTest::NO_TEST;
+
+	return rc;
+}
+
+/* Individual test functions... */
+IDATA storeAndFindTraceTest(J9JavaVM* vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	const char* testName = "storeAndFindTraceTest";
+	IDATA rc = PASS;
+	BlockPtr cache = NULL;
+	BlockPtr cacheAllocated = NULL;
+	SH_CacheMap* cacheObject = NULL;
+	void* cacheObjectMemory = NULL;
+	J9SharedClassPreinitConfig* origPiConfig = NULL;
+	J9SharedClassPreinitConfig* sharedpiConfig = NULL;
+	J9SharedClassConfig* origSharedClassConfig = NULL;
+	J9SharedClassConfig* sharedConfig = NULL;
+	J9SharedLocalStartupClassTrace* trace = NULL;
+	J9SharedClassCacheDescriptor* cacheDesc = NULL;
+	J9SharedStartupClassTraceEntry expected[STARTUP_CLASS_TRACE_TEST_VALID_ENTRIES + STARTUP_CLASS_TRACE_TEST_GARBAGE_ENTRIES];
+	UDATA expectedCount = 0;
+	UDATA notInCache = 0;
+	bool cacheHasIntegrity = false;
+	const U_8* storeRet = NULL;
+
+
+	J9VMThread* currentThread = vm->internalVMFunctions->currentVMThread(vm);
+
+	IDATA cacheObjectSize = SH_CacheMap::getRequiredConstrBytes(false);
+	/* j9mmap_get_region_granularity returns 0 on zOS */
+	UDATA osPageSize = j9mmap_get_region_granularity(NULL);
+
+	INFOPRINTF("Entering Store And Find Trace Test\n");
+
+	/* Create a shared config object and attach it to the VM */
+	sharedConfig = (J9SharedClassConfig*)j9mem_allocate_memory(sizeof(J9SharedClassConfig) + sizeof(J9SharedClassCacheDescriptor), J9MEM_CATEGORY_CLASSES);
+	if (NULL == sharedConfig) {
+		ERRPRINTF("Failed to allocate memory for sharedConfig\n");
+		rc = FAIL;
+		goto cleanup;
+	}
+
+	memset(sharedConfig, 0, sizeof(J9SharedClassConfig) + sizeof(J9SharedClassCacheDescriptor));
+	sharedConfig->softMaxBytes = -1;
+	sharedConfig->minAOT = -1;
+	sharedConfig->maxAOT = -1;
+	sharedConfig->minJIT = -1;
+	sharedConfig->maxJIT = -1;
+	sharedConfig->cacheDescriptorList = (J9SharedClassCacheDescriptor*)((UDATA)sharedConfig + sizeof(J9SharedClassConfig));
+	sharedConfig->cacheDescriptorList->next = sharedConfig->cacheDescriptorList;
+	sharedConfig->cacheDescriptorList->previous = sharedConfig->cacheDescriptorList;
+	trace = &sharedConfig->localStartupClassTrace;
+
+	sharedpiConfig = (J9SharedClassPreinitConfig*)j9mem_allocate_memory(sizeof(J9SharedClassPreinitConfig), J9MEM_CATEGORY_CLASSES);
+	if (NULL == sharedpiConfig) {
+		ERRPRINTF("Failed to allocate memory for sharedpiConfig\n");
+		rc = FAIL;
+		goto cleanup;
+	}
+
+	memset(sharedpiConfig, 0, sizeof(J9SharedClassPreinitConfig));
+
+	sharedConfig->runtimeFlags =
+		J9SHR_RUNTIMEFLAG_ENABLE_LOCAL_CACHEING          |
+		J9SHR_RUNTIMEFLAG_ENABLE_TIMESTAMP_CHECKS        |
+		J9SHR_RUNTIMEFLAG_ENABLE_REDUCE_STORE_CONTENTION |
+		J9SHR_RUNTIMEFLAG_ENABLE_BYTECODEFIX;
+
+	origSharedClassConfig = vm->sharedClassConfig;
+	origPiConfig = vm->sharedClassPreinitConfig;
+
+	vm->sharedClassConfig = sharedConfig;
+	vm->sharedClassPreinitConfig = sharedpiConfig;
+
+	if (osPageSize != 0) {
+		sharedpiConfig->sharedClassCacheSize = ROUND_UP_TO(osPageSize, SMALL_CACHE_SIZE);
+	} else {
+		sharedpiConfig->sharedClassCacheSize = SMALL_CACHE_SIZE;
+	}
+
+	sharedpiConfig->sharedClassDebugAreaBytes = -1;
+	sharedpiConfig->sharedClassReadWriteBytes = 0;
+	sharedpiConfig->sharedClassMinAOTSize = -1;
+	sharedpiConfig->sharedClassMaxAOTSize = -1;
+	sharedpiConfig->sharedClassMinJITSize = -1;
+	sharedpiConfig->sharedClassMaxJITSize = -1;
+	sharedpiConfig->sharedClassSoftMaxBytes = -1;
+
+	/* Allocate and initialize the required memory */
+	cacheAllocated = (BlockPtr)j9mem_allocate_memory(sharedpiConfig->sharedClassCacheSize + osPageSize, J9MEM_CATEGORY_CLASSES);
+
+	if (NULL == cacheAllocated) {
+		ERRPRINTF("Failed to allocate memory for cacheAllocated\n");
+		rc = FAIL;
+		goto cleanup;
+	}
+	memset(cacheAllocated, 0, sharedpiConfig->sharedClassCacheSize + osPageSize);
+	if (osPageSize != 0) {
+		cache = (BlockPtr) ROUND_UP_TO(osPageSize, (UDATA)cacheAllocated);
+	} else {
+		cache = cacheAllocated;
+	}
+
+	cacheObjectMemory = j9mem_allocate_memory(cacheObjectSize, J9MEM_CATEGORY_CLASSES);
+	if (NULL == cacheObjectMemory) {
+		ERRPRINTF("Failed to allocate memory for cacheObjectMemory\n");
+		rc = FAIL;
+		goto cleanup;
+	}
+
+	memset(cacheObjectMemory, 0, cacheObjectSize);
+
+	/* Create and initialize the cache map object */
+	cacheObject = SH_CacheMap::newInstance(vm, sharedConfig, (SH_CacheMap*)cacheObjectMemory, "cache1", 0);
+
+	/* Start the cache object */
+
+	rc = cacheObject->startup(currentThread, sharedpiConfig, "Root1", NULL, J9SH_DIRPERM_ABSENT, cache, &cacheHasIntegrity);
+
+	/* Report progress so far */
+	INFOPRINTF5("Store And Find Trace Test cos=%d cs=%d co=%x cba=%x rc=%d\n", cacheObjectSize, sharedpiConfig->sharedClassCacheSize, cacheObject, cache, rc);
+	if (0 != rc) {
+		ERRPRINTF("Failed to startup cacheObject\n");
+		rc = FAIL;
+		goto cleanup;
+	}
+	sharedConfig->sharedClassCache = (void*)cacheObject;
+	sharedConfig->runtimeFlags |= J9SHR_RUNTIMEFLAG_CACHE_INITIALIZATION_COMPLETE;
+	cacheDesc = sharedConfig->cacheDescriptorList;
+
+
+	/* First run: there is no trace in the cache, so the classes found in the cache are recorded */
+	startStartupClassTrace(currentThread);
+	if (J9_ARE_NO_BITS_SET(trace->flags, J9SHR_LOCAL_STARTUPCLASSTRACE_FLAG_RECORD) || (NULL == trace->entries)) {
+		ERRPRINTF("startStartupClassTrace did not start recording with no trace in the cache\n");
+		rc = FAIL;
+		goto cleanup;
+	}
+	if (NULL != trace->prefaultMonitor) {
+		ERRPRINTF("startStartupClassTrace started prefaulting with no trace in the cache\n");
+		rc = FAIL;
+		goto cleanup;
+	}
+
+	expected[0].romClassOffset = (U_32)(cacheDesc->cacheSizeBytes / 4);
+	expected[0].layer = 0;
+	expected[1].romClassOffset = (U_32)(cacheDesc->cacheSizeBytes / 2);
+	expected[1].layer = 0;
+	for (UDATA i = 0; i < STARTUP_CLASS_TRACE_TEST_VALID_ENTRIES; i++) {
+		recordStartupClass(currentThread, (J9ROMClass*)((U_8*)cacheDesc->cacheStartAddress + expected[i].romClassOffset));
+	}
+	/* A class that is not in the cache is not recorded */
+	recordStartupClass(currentThread, (J9ROMClass*)&notInCache);
+	if (STARTUP_CLASS_TRACE_TEST_VALID_ENTRIES != trace->count) {
+		ERRPRINTF2("%zu classes were recorded, expected %zu\n", trace->count, (UDATA)STARTUP_CLASS_TRACE_TEST_VALID_ENTRIES);
+		rc = FAIL;
+		goto cleanup;
+	}
+	for (UDATA i = 0; i < STARTUP_CLASS_TRACE_TEST_VALID_ENTRIES; i++) {
+		if ((expected[i].romClassOffset != trace->entries[i].romClassOffset) || (expected[i].layer != trace->entries[i].layer)) {
+			ERRPRINTF3("Entry %zu was recorded as offset %u layer %u\n", i, trace->entries[i].romClassOffset, trace->entries[i].layer);
+			rc = FAIL;
+			goto cleanup;
+		}
+	}
+
+	/* Add the entries of a stale trace: an offset past the layer, an offset that does not fit in the address space
+	 * of the layer, a ROM class running off the end of the layer, and a layer the cache does not have.
+	 */
+	expectedCount = STARTUP_CLASS_TRACE_TEST_VALID_ENTRIES;
+	expected[expectedCount].romClassOffset = (U_32)cacheDesc->cacheSizeBytes;
+	expected[expectedCount++].layer = 0;
+	expected[expectedCount].romClassOffset = U_32_MAX;
+	expected[expectedCount++].layer = 0;
+	expected[expectedCount].romClassOffset = (U_32)(cacheDesc->cacheSizeBytes - (sizeof(J9ROMClass) / 2));
+	expected[expectedCount++].layer = 0;
+	expected[expectedCount].romClassOffset = 0;
+	expected[expectedCount++].layer = J9SH_LAYER_NUM_MAX_VALUE + 1;
+	for (UDATA i = STARTUP_CLASS_TRACE_TEST_VALID_ENTRIES; i < expectedCount; i++) {
+		trace->entries[i] = expected[i];
+	}
+	trace->count = expectedCount;
+
+	storeRet = storeStartupClassTraceToSharedCache(currentThread);
+	if (NULL == storeRet) {
+		ERRPRINTF("storeStartupClassTraceToSharedCache returns NULL. Failed to store the trace to the shared cache\n");
+		rc = FAIL;
+		goto cleanup;
+	}
+	if (J9_ARE_ANY_BITS_SET(trace->flags, J9SHR_LOCAL_STARTUPCLASSTRACE_FLAG_RECORD)) {
+		ERRPRINTF("storeStartupClassTraceToSharedCache did not stop recording\n");
+		rc = FAIL;
+		goto cleanup;
+	}
+
+	/* Second run: start again from a clean local trace, so the trace is found in the cache */
+	j9mem_free_memory(trace->entries);
+	memset(trace, 0, sizeof(J9SharedLocalStartupClassTrace));
+	startStartupClassTrace(currentThread);
+	if (J9_ARE_ANY_BITS_SET(trace->flags, J9SHR_LOCAL_STARTUPCLASSTRACE_FLAG_RECORD) || (NULL != trace->entries)) {
+		ERRPRINTF("startStartupClassTrace started recording with a trace in the cache\n");
+		rc = FAIL;
+		goto cleanup;
+	}
+	if (((const U_8*)trace->prefaultEntries != storeRet) || (expectedCount != trace->prefaultCount)) {
+		ERRPRINTF4("Found %zu entries at %p, expected %zu entries at %p\n", trace->prefaultCount, trace->prefaultEntries, expectedCount, storeRet);
+		rc = FAIL;
+		goto cleanup;
+	}
+	for (UDATA i = 0; i < expectedCount; i++) {
+		if ((expected[i].romClassOffset != trace->prefaultEntries[i].romClassOffset) || (expected[i].layer != trace->prefaultEntries[i].layer)) {
+			ERRPRINTF3("Entry %zu was found as offset %u layer %u\n", i, trace->prefaultEntries[i].romClassOffset, trace->prefaultEntries[i].layer);
+			rc = FAIL;
+			goto cleanup;
+		}
+	}
+	if (NULL == trace->prefaultMonitor) {
+		ERRPRINTF("startStartupClassTrace did not start prefaulting with a trace in the cache\n");
+		rc = FAIL;
+		goto cleanup;
+	}
+
+	/* Let the prefault thread walk the whole trace, the stale entries must be skipped without touching memory outside the cache */
+	omrthread_monitor_enter(trace->prefaultMonitor);
+	while (0 != trace->prefaultThreadRunning) {
+		omrthread_monitor_wait(trace->prefaultMonitor);
+	}
+	omrthread_monitor_exit(trace->prefaultMonitor);
+	stopStartupClassPrefault(vm);
+
+
+cleanup:
+	if (NULL != trace) {
+		if (NULL != trace->prefaultMonitor) {
+			stopStartupClassPrefault(vm);
+			omrthread_monitor_destroy(trace->prefaultMonitor);
+		}
+		if (NULL != trace->entries) {
+			j9mem_free_memory(trace->entries);
+		}
+	}
+	if (NULL != cacheObject) {
+		cacheObject->cleanup(vm->mainThread);
+		j9mem_free_memory(cacheObject);
+		cacheObject = NULL;
+	}
+	if (NULL != sharedConfig) {
+		vm->sharedClassConfig = origSharedClassConfig;
+		j9mem_free_memory(sharedConfig);
+	}
+	if (NULL != sharedpiConfig) {
+		vm->sharedClassPreinitConfig = origPiConfig;
+		j9mem_free_memory(sharedpiConfig);
+	}
+
+	if (NULL != cacheAllocated) {
+		j9mem_free_memory(cacheAllocated);
+		cacheAllocated = NULL;
+		cache = NULL;
+	}
+
+	REPORT_SUMMARY("Startup Class Trace Test", rc);
+
+	return rc;
+}
@@ -70,6 +70,8 @@ IDATA testCacheDirPerm(J9JavaVM *vm);
 IDATA testCacheFull(J9JavaVM *vm);
 IDATA testProtectSharedCacheData(J9JavaVM *vm);
 IDATA testStartupHints(J9JavaVM *vm);
+IDATA testStartupClassTrace(J9JavaVM *vm);
+IDATA testCacheRead(J9JavaVM *vm);
 
 UDATA
 buildChildCmdlineOption(int argc, char **argv, const char *options, char * newargv[SHRTEST_MAX_CMD_OPTS]) {
@@ -351,6 +353,12 @@ signalProtectedMain(struct J9PortLibrary *portLibrary, void * vargs)
 	HEADING(PORTLIB, "Startup Hints Test");
 	rc |= testStartupHints(vm);
 
+	HEADING(PORTLIB, "Startup Class Trace Test");
+	rc |= testStartupClassTrace(vm);
+
+	HEADING(PORTLIB, "CacheRead Test");
+	rc |= testCacheRead(vm);
+
 	if ( (*((JavaVM*)vm))->DestroyJavaVM((JavaVM*)vm) != JNI_OK ) {
 		args->shutdownPortLib = FALSE;
 	}
@@ -2707,6 +2707,10 @@ static UDATA checkArgsConsumed(J9JavaVM * vm, J9PortLibrary* portLibrary, J9VMIn
 		findArgInVMArgs( PORTLIB, j9vm_args, EXACT_MATCH, VMOPT_XXDISABLESHAREANONYMOUSCLASSES, NULL, TRUE);
 		findArgInVMArgs( PORTLIB, j9vm_args, EXACT_MATCH, VMOPT_XXENABLESHAREUNSAFECLASSES, NULL, TRUE);
 		findArgInVMArgs( PORTLIB, j9vm_args, EXACT_MATCH, VMOPT_XXDISABLESHAREUNSAFECLASSES, NULL, TRUE);
+		findArgInVMArgs( PORTLIB, j9vm_args, EXACT_MATCH, VMOPT_XXSHARECLASSESUSEHUGEPAGES, NULL, TRUE);
+		findArgInVMArgs( PORTLIB, j9vm_args, EXACT_MATCH, VMOPT_XXNOSHARECLASSESUSEHUGEPAGES, NULL, TRUE);
+		findArgInVMArgs( PORTLIB, j9vm_args, EXACT_MATCH, VMOPT_XXSHARECLASSESNUMAINTERLEAVE, NULL, TRUE);
+		findArgInVMArgs( PORTLIB, j9vm_args, EXACT_MATCH, VMOPT_XXNOSHARECLASSESNUMAINTERLEAVE, NULL, TRUE);
 	}
 
 	for (i=0; i<j9vm_args->nOptions; i++) {
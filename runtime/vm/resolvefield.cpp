@@ -660,6 +660,7 @@ createClassHotFieldsInfo(J9JavaVM *javaVM, J9Class* clazz, uint8_t fieldOffset,
 		if (NULL != hotFieldsInfo) {
 			hotFieldsInfo->hotFieldListLength = 0;
 			hotFieldsInfo->consecutiveHotFieldSelections = 0;
+			hotFieldsInfo->isBreadthFirstCopyPreferred = FALSE;
 			hotFieldsInfo->hotFieldOffset1 = U_8_MAX;
 			hotFieldsInfo->hotFieldOffset2 = U_8_MAX;
 			hotFieldsInfo->hotFieldOffset3 = U_8_MAX;
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2020, 2021 IBM Corp. and others
+ * Copyright (c) 2020, 2026 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -227,6 +227,77 @@ public class JITServerTest {
 		destroyAndCheckProcess(server, serverBuilder);
 	}
 
+	public void testSharedConnections() throws IOException, InterruptedException {
+		logger.info("running testSharedConnections: INFO and above level logging enabled");
+
+		// Run more compilation threads than the client keeps shared connections to the server
+		final ProcessBuilder sharedClientBuilder = new ProcessBuilder(new ArrayList<String>(clientBuilder.command()));
+		sharedClientBuilder.command().addAll(1, Arrays.asList("-XX:JITServerMaxConnections=1", "-XcompilationThreads4"));
+		sharedClientBuilder.redirectErrorStream(true);
+		sharedClientBuilder.environment().putAll(clientBuilder.environment());
+
+		redirectProcessOutputs(sharedClientBuilder, "testSharedConnections.client");
+		redirectProcessOutputs(serverBuilder, "testSharedConnections.server");
+
+		final Process server = startProcess(serverBuilder, "server");
+
+		Thread.sleep(SERVER_START_WAIT_TIME_MS);
+
+		final Process client = startProcess(sharedClientBuilder, "client");
+
+		logger.info("Waiting for " + CLIENT_TEST_TIME_MS + " millis.");
+		Thread.sleep(CLIENT_TEST_TIME_MS);
+
+		logger.info("Stopping client...");
+		destroyAndCheckProcess(client, sharedClientBuilder);
+
+		logger.info("Stopping server...");
+		destroyAndCheckProcess(server, serverBuilder);
+	}
+
+	public void testServerQueuesManyRequests() throws IOException, InterruptedException {
+		logger.info("running testServerQueuesManyRequests: INFO and above level logging enabled");
+
+		// Several clients with many compilation threads each send more requests than a server with one compilation thread
+		// can process, so the requests pile up in the server compilation queue before their details are read.
+		final int NUM_CLIENTS = 4;
+		final ProcessBuilder queueServerBuilder = new ProcessBuilder(new ArrayList<String>(serverBuilder.command()));
+		queueServerBuilder.command().add(1, "-XcompilationThreads1");
+		queueServerBuilder.redirectErrorStream(true);
+		queueServerBuilder.environment().putAll(serverBuilder.environment());
+		redirectProcessOutputs(queueServerBuilder, "testServerQueuesManyRequests.server");
+
+		final ProcessBuilder[] queueClientBuilders = new ProcessBuilder[NUM_CLIENTS];
+		for (int i = 0; i < NUM_CLIENTS; ++i) {
+			queueClientBuilders[i] = new ProcessBuilder(new ArrayList<String>(clientBuilder.command()));
+			// Keep the command lines distinct so that startProcess() does not kill the clients already started
+			queueClientBuilders[i].command().addAll(1, Arrays.asList("-XcompilationThreads15", "-Dtest.client=" + i));
+			queueClientBuilders[i].redirectErrorStream(true);
+			queueClientBuilders[i].environment().putAll(clientBuilder.environment());
+			redirectProcessOutputs(queueClientBuilders[i], "testServerQueuesManyRequests.client" + i);
+		}
+
+		final Process server = startProcess(queueServerBuilder, "server");
+
+		Thread.sleep(SERVER_START_WAIT_TIME_MS);
+
+		final Process[] clients = new Process[NUM_CLIENTS];
+		for (int i = 0; i < NUM_CLIENTS; ++i) {
+			clients[i] = startProcess(queueClientBuilders[i], "client" + i);
+		}
+
+		logger.info("Waiting for " + CLIENT_TEST_TIME_MS + " millis.");
+		Thread.sleep(CLIENT_TEST_TIME_MS);
+
+		logger.info("Stopping clients...");
+		for (int i = 0; i < NUM_CLIENTS; ++i) {
+			destroyAndCheckProcess(clients[i], queueClientBuilders[i]);
+		}
+
+		logger.info("Stopping server...");
+		destroyAndCheckProcess(server, queueServerBuilder);
+	}
+
 	public void testServerGoesDown() throws IOException, InterruptedException {
 		logger.info("running testServerGoesDown: INFO and above level logging enabled");
 
@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.jvm.ras.tests;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * Run by DumpAPIDeltaHeapDumpTests in a separate VM. It takes the baseline delta heap dump
+ * named by its argument, then changes part of the heap and exits. The VM is started with
+ * a delta heap dump agent and a full PHD agent on vmstop, which see the same heap.
+ */
+public class DeltaHeapDumpProcess {
+
+	private static final int OBJECT_COUNT = 20000;
+
+	private static List<Object> retained = new ArrayList<Object>();
+	private static Map<String, Object> changed = new HashMap<String, Object>();
+
+	public static void main(String[] args) throws Exception {
+		for (int i = 0; i < OBJECT_COUNT; i++) {
+			retained.add(new int[i % 64]);
+			retained.add("retained" + i);
+			changed.put("changed" + i, new Object[] { Integer.valueOf(i), new StringBuilder("value" + i) });
+		}
+
+		com.ibm.jvm.Dump.triggerDump("heap:opts=PHD+DELTA,file=" + args[0]);
+
+		/* Drop some of the objects and add others so the delta holds new, changed and emptied chunks */
+		for (int i = 0; i < OBJECT_COUNT; i += 2) {
+			changed.remove("changed" + i);
+		}
+		for (int i = 0; i < OBJECT_COUNT / 4; i++) {
+			changed.put("added" + i, new long[i % 32]);
+		}
+		System.gc();
+	}
+}
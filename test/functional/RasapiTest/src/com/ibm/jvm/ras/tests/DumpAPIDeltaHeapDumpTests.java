@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * Copyright (c) 2026, 2026 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.jvm.ras.tests;
+
+import static com.ibm.jvm.ras.tests.DumpAPISuite.deleteFile;
+import static com.ibm.jvm.ras.tests.DumpAPISuite.getContentType;
+
+import java.io.File;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.HashSet;
+import java.util.Iterator;
+import java.util.List;
+import java.util.Set;
+
+import junit.framework.TestCase;
+
+import com.ibm.dtfj.image.Image;
+import com.ibm.dtfj.image.ImageAddressSpace;
+import com.ibm.dtfj.image.ImageFactory;
+import com.ibm.dtfj.image.ImageProcess;
+import com.ibm.dtfj.java.JavaHeap;
+import com.ibm.dtfj.java.JavaObject;
+import com.ibm.dtfj.java.JavaReference;
+import com.ibm.dtfj.java.JavaRuntime;
+import com.ibm.jvm.ras.tests.DumpAPISuite.DumpType;
+
+/**
+ * Checks that phdmerge rebuilds a full PHD from a baseline delta heap dump (opts=PHD+DELTA)
+ * and the delta that follows it. DeltaHeapDumpProcess writes the baseline, and the delta and
+ * a full PHD are written by two agents on the same vmstop event so they describe the same heap.
+ */
+public class DumpAPIDeltaHeapDumpTests extends TestCase {
+
+	private long uid = System.currentTimeMillis();
+
+	private Set<String> fileNames;
+
+	@Override
+	protected void setUp() throws Exception {
+		super.setUp();
+		fileNames = new HashSet<String>();
+	}
+
+	@Override
+	protected void tearDown() throws Exception {
+		super.tearDown();
+		for( String fileName: fileNames) {
+			deleteFile(fileName, this.getName());
+		}
+	}
+
+	public void testMergedDeltaMatchesFullDump() throws Exception {
+		String userDir = System.getProperty("user.dir");
+		String baselineName = userDir + File.separator + "heapdump." + getName() + "." + uid + ".baseline.phdd";
+		String deltaName = userDir + File.separator + "heapdump." + getName() + "." + uid + ".delta.phdd";
+		String fullName = userDir + File.separator + "heapdump." + getName() + "." + uid + ".full.phd";
+		String mergedName = userDir + File.separator + "heapdump." + getName() + "." + uid + ".merged.phd";
+
+		File phdmerge = findExecutable(new File(System.getProperty("java.home")), "phdmerge");
+		assertNotNull("Unable to find the phdmerge executable under " + System.getProperty("java.home"), phdmerge);
+
+		String java = System.getProperty("java.home") + File.separator + "bin" + File.separator + "java";
+		runProcess(java,
+				"-Xdump:heap:events=vmstop,opts=PHD+DELTA,file=" + deltaName,
+				"-Xdump:heap:events=vmstop,opts=PHD,file=" + fullName,
+				"-cp", System.getProperty("java.class.path"),
+				DeltaHeapDumpProcess.class.getName(), baselineName);
+		fileNames.add(baselineName);
+		fileNames.add(deltaName);
+		fileNames.add(fullName);
+		for( String fileName: new String[] { baselineName, deltaName, fullName }) {
+			assertTrue("Failed to find dump file " + fileName, new File(fileName).exists());
+		}
+
+		runProcess(phdmerge.getAbsolutePath(), mergedName, baselineName, deltaName);
+		fileNames.add(mergedName);
+		DumpType type = getContentType(new File(mergedName));
+		assertEquals("Expected file " + mergedName + " to contain a heap dump but content type was: " + type, DumpType.PHD_HEAP_TYPE, type);
+
+		List<String> fullObjects = readObjects(fullName);
+		List<String> mergedObjects = readObjects(mergedName);
+		assertTrue("No objects found in " + fullName, fullObjects.size() > 0);
+		assertEquals("Object count of merged dump " + mergedName + " differs from full dump " + fullName, fullObjects.size(), mergedObjects.size());
+		for( int i = 0; i < fullObjects.size(); i++ ) {
+			assertEquals("Merged dump " + mergedName + " differs from full dump " + fullName, fullObjects.get(i), mergedObjects.get(i));
+		}
+	}
+
+	private static File findExecutable(File dir, String name) {
+		File[] files = dir.listFiles();
+		if( files == null ) {
+			return null;
+		}
+		for( File file: files ) {
+			if( file.isFile() && (file.getName().equals(name) || file.getName().equals(name + ".exe")) ) {
+				return file;
+			}
+		}
+		for( File file: files ) {
+			if( file.isDirectory() ) {
+				File found = findExecutable(file, name);
+				if( found != null ) {
+					return found;
+				}
+			}
+		}
+		return null;
+	}
+
+	private static void runProcess(String... command) throws Exception {
+		ProcessBuilder builder = new ProcessBuilder(command);
+		builder.inheritIO();
+		Process process = builder.start();
+		int rc = process.waitFor();
+		assertEquals("Unexpected exit code from " + command[0], 0, rc);
+	}
+
+	/**
+	 * Reads every object in a PHD, returning one line per object with its address, class
+	 * and the addresses it references, sorted by address.
+	 */
+	private static List<String> readObjects(String fileName) throws Exception {
+		List<String> objects = new ArrayList<String>();
+		Class<?> factoryClass = Class.forName("com.ibm.dtfj.phd.PHDImageFactory");
+		ImageFactory factory = (ImageFactory) factoryClass.newInstance();
+		Image image = factory.getImage(new File(fileName));
+		try {
+			for( Iterator<?> asItr = image.getAddressSpaces(); asItr.hasNext(); ) {
+				Object nextAS = asItr.next();
+				if( !(nextAS instanceof ImageAddressSpace) ) {
+					continue;
+				}
+				for( Iterator<?> psItr = ((ImageAddressSpace) nextAS).getProcesses(); psItr.hasNext(); ) {
+					Object nextPS = psItr.next();
+					if( !(nextPS instanceof ImageProcess) ) {
+						continue;
+					}
+					for( Iterator<?> rtItr = ((ImageProcess) nextPS).getRuntimes(); rtItr.hasNext(); ) {
+						Object nextRT = rtItr.next();
+						if( !(nextRT instanceof JavaRuntime) ) {
+							continue;
+						}
+						readHeaps((JavaRuntime) nextRT, objects);
+					}
+				}
+			}
+		} finally {
+			image.close();
+		}
+		Collections.sort(objects);
+		return objects;
+	}
+
+	private static void readHeaps(JavaRuntime runtime, List<String> objects) throws Exception {
+		for( Iterator<?> heapItr = runtime.getHeaps(); heapItr.hasNext(); ) {
+			Object nextHeap = heapItr.next();
+			if( !(nextHeap instanceof JavaHeap) ) {
+				fail("Corrupt heap in dump: " + nextHeap);
+			}
+			for( Iterator<?> objItr = ((JavaHeap) nextHeap).getObjects(); objItr.hasNext(); ) {
+				Object nextObject = objItr.next();
+				if( !(nextObject instanceof JavaObject) ) {
+					fail("Corrupt object in dump: " + nextObject);
+				}
+				JavaObject object = (JavaObject) nextObject;
+				StringBuilder line = new StringBuilder();
+				line.append(String.format("%016x ", object.getID().getAddress()));
+				line.append(object.getJavaClass().getName());
+				List<String> refs = new ArrayList<String>();
+				for( Iterator<?> refItr = object.getReferences(); refItr.hasNext(); ) {
+					Object nextRef = refItr.next();
+					if( nextRef instanceof JavaReference ) {
+						Object target = ((JavaReference) nextRef).getTarget();
+						if( target instanceof JavaObject ) {
+							refs.add(String.format("%016x", ((JavaObject) target).getID().getAddress()));
+						}
+					}
+				}
+				Collections.sort(refs);
+				for( String ref: refs ) {
+					line.append(' ').append(ref);
+				}
+				objects.add(line.toString());
+			}
+		}
+	}
+}